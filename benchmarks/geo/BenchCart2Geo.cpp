@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <mcutils/geo/Cart2Geo.h>
+#include <mcutils/geo/ECEF.h>
+#include <mcutils/geo/WGS84.h>
+
+#include <geo/GeoPoints.h>
+
+namespace {
+
+constexpr size_t kCount = 1 << 14;
+
+// points spread over the whole globe at the given altitude
+GeoPoints makePoints(units::length::meter_t alt)
+{
+    return makeGeoPoints(kCount,
+                         units::angle::radian_t(-0.5 * M_PI), units::angle::radian_t(0.5 * M_PI),
+                         units::angle::radian_t(-M_PI), units::angle::radian_t(M_PI),
+                         alt, alt);
+}
+
+/**
+ * Converts points at the altitude given in kilometers (state.range(0)).
+ * Reports maximum latitude and altitude errors.
+ */
+template <class METHOD>
+void BM_Cart2Geo(benchmark::State& state)
+{
+    const mc::Cart2Geo<METHOD> cart2geo(mc::WGS84::ellipsoid);
+    const GeoPoints p = makePoints(units::length::meter_t(1000.0 * state.range(0)));
+
+    std::vector<units::angle::radian_t> lat(kCount);
+    std::vector<units::angle::radian_t> lon(kCount);
+    std::vector<units::length::meter_t> alt(kCount);
+
+    for (auto _ : state)
+    {
+        cart2geo.convert(p.x, p.y, p.z, lat, lon, alt);
+        benchmark::DoNotOptimize(lat.data());
+        benchmark::ClobberMemory();
+    }
+
+    double max_lat_error = 0.0;
+    double max_alt_error = 0.0;
+    for (size_t i = 0; i < kCount; ++i)
+    {
+        max_lat_error = std::max(max_lat_error, std::fabs(lat[i]() - p.lat[i]()));
+        max_alt_error = std::max(max_alt_error, std::fabs(alt[i]() - p.alt[i]()));
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+    state.counters["max_lat_error"] = max_lat_error;
+    state.counters["max_alt_error"] = max_alt_error;
+}
+
+} // namespace
+
+BENCHMARK(BM_Cart2Geo<mc::Cart2GeoZhu>)
+    ->Name("Cart2Geo/Zhu")->Arg(-1000)->Arg(0)->Arg(100)->Arg(1000)->Arg(36000)->ArgName("alt_km");
+BENCHMARK(BM_Cart2Geo<mc::Cart2GeoBowring<1>>)
+    ->Name("Cart2Geo/Bowring1")->Arg(-1000)->Arg(0)->Arg(100)->Arg(1000)->Arg(36000)->ArgName("alt_km");
+BENCHMARK(BM_Cart2Geo<mc::Cart2GeoBowring<2>>)
+    ->Name("Cart2Geo/Bowring2")->Arg(-1000)->Arg(0)->Arg(100)->Arg(1000)->Arg(36000)->ArgName("alt_km");
+BENCHMARK(BM_Cart2Geo<mc::Cart2GeoOlson>)
+    ->Name("Cart2Geo/Olson")->Arg(-1000)->Arg(0)->Arg(100)->Arg(1000)->Arg(36000)->ArgName("alt_km");
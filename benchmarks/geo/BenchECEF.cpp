@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <mcutils/geo/ECEF.h>
+#include <mcutils/geo/WGS84.h>
+
+#include <geo/GeoPoints.h>
+
+namespace {
+
+constexpr size_t kCount = 1 << 16;
+
+// points spread over the whole globe and altitudes up to 12 km
+GeoPoints makePoints()
+{
+    return makeGeoPoints(kCount,
+                         units::angle::radian_t(-0.49 * M_PI), units::angle::radian_t(0.49 * M_PI),
+                         units::angle::radian_t(-M_PI), units::angle::radian_t(M_PI),
+                         0.0_m, 12000.0_m);
+}
+
+void BM_ECEF_Geo2Cart_Loop(benchmark::State& state)
+{
+    mc::ECEF ecef(mc::WGS84::ellipsoid);
+    GeoPoints p = makePoints();
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < kCount; ++i)
+        {
+            ecef.convertGeo2Cart(p.lat[i], p.lon[i], p.alt[i], &p.x[i], &p.y[i], &p.z[i]);
+        }
+        benchmark::DoNotOptimize(p.x.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_ECEF_Geo2Cart_Batch(benchmark::State& state)
+{
+    const unsigned int threads = static_cast<unsigned int>(state.range(0));
+    mc::ECEF ecef(mc::WGS84::ellipsoid);
+    GeoPoints p = makePoints();
+
+    for (auto _ : state)
+    {
+        ecef.convertGeo2Cart(p.lat, p.lon, p.alt, p.x, p.y, p.z, threads);
+        benchmark::DoNotOptimize(p.x.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+template <bool FAST>
+void BM_ECEF_Cart2Geo_Loop(benchmark::State& state)
+{
+    mc::ECEF ecef(mc::WGS84::ellipsoid);
+    GeoPoints p = makePoints();
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < kCount; ++i)
+        {
+            if constexpr (FAST)
+            {
+                ecef.convertCart2GeoFast(p.x[i], p.y[i], p.z[i], &p.lat[i], &p.lon[i], &p.alt[i]);
+            }
+            else
+            {
+                ecef.convertCart2Geo(p.x[i], p.y[i], p.z[i], &p.lat[i], &p.lon[i], &p.alt[i]);
+            }
+        }
+        benchmark::DoNotOptimize(p.lat.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+template <bool FAST>
+void BM_ECEF_Cart2Geo_Batch(benchmark::State& state)
+{
+    const unsigned int threads = static_cast<unsigned int>(state.range(0));
+    mc::ECEF ecef(mc::WGS84::ellipsoid);
+    GeoPoints p = makePoints();
+
+    for (auto _ : state)
+    {
+        if constexpr (FAST)
+        {
+            ecef.convertCart2GeoFast(p.x, p.y, p.z, p.lat, p.lon, p.alt, threads);
+        }
+        else
+        {
+            ecef.convertCart2Geo(p.x, p.y, p.z, p.lat, p.lon, p.alt, threads);
+        }
+        benchmark::DoNotOptimize(p.lat.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+} // namespace
+
+BENCHMARK(BM_ECEF_Geo2Cart_Loop)->Name("ECEF/Geo2Cart/Loop");
+BENCHMARK(BM_ECEF_Geo2Cart_Batch)->Name("ECEF/Geo2Cart/Batch")->Arg(1)->Arg(4)->ArgName("threads")->UseRealTime();
+BENCHMARK(BM_ECEF_Cart2Geo_Loop<false>)->Name("ECEF/Cart2Geo/Loop");
+BENCHMARK(BM_ECEF_Cart2Geo_Batch<false>)->Name("ECEF/Cart2Geo/Batch")->Arg(1)->Arg(4)->ArgName("threads")->UseRealTime();
+BENCHMARK(BM_ECEF_Cart2Geo_Loop<true>)->Name("ECEF/Cart2GeoFast/Loop");
+BENCHMARK(BM_ECEF_Cart2Geo_Batch<true>)->Name("ECEF/Cart2GeoFast/Batch")->Arg(1)->Arg(4)->ArgName("threads")->UseRealTime();
@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <mcutils/geo/Geodesic.h>
+#include <mcutils/geo/WGS84.h>
+
+#include <geo/GeoPoints.h>
+
+namespace {
+
+constexpr size_t kCount = 1 << 14;
+
+void BM_Geodesic_Direct(benchmark::State& state)
+{
+    mc::Geodesic geodesic(mc::WGS84::ellipsoid);
+    GeoPoints p = makeRandomGeoPoints(kCount, 1);
+    std::vector<units::angle::radian_t> lat(kCount);
+    std::vector<units::angle::radian_t> lon(kCount);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < kCount; ++i)
+        {
+            geodesic.solveDirect(p.lat[i], p.lon[i], p.lon[kCount - i - 1], units::length::meter_t(1000.0 * i),
+                                 &lat[i], &lon[i]);
+        }
+        benchmark::DoNotOptimize(lat.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_Geodesic_Distances(benchmark::State& state)
+{
+    const mc::GeodesicMode mode = static_cast<mc::GeodesicMode>(state.range(0));
+    mc::Geodesic geodesic(mc::WGS84::ellipsoid);
+    GeoPoints p1 = makeRandomGeoPoints(kCount, 1);
+    GeoPoints p2 = makeRandomGeoPoints(kCount, 2);
+    std::vector<units::length::meter_t> distance(kCount);
+
+    for (auto _ : state)
+    {
+        geodesic.getDistances(p1.lat, p1.lon, p2.lat, p2.lon, distance, mode);
+        benchmark::DoNotOptimize(distance.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+// proximity check of all the points without the spherical pre-filter
+void BM_Geodesic_WithinDistance_Inverse(benchmark::State& state)
+{
+    const units::length::meter_t range(1000.0 * state.range(0));
+    mc::Geodesic geodesic(mc::WGS84::ellipsoid);
+    GeoPoints p = makeRandomGeoPoints(kCount, 1);
+    std::vector<size_t> indices;
+
+    for (auto _ : state)
+    {
+        indices.clear();
+        for (size_t i = 0; i < kCount; ++i)
+        {
+            units::length::meter_t distance = 0.0_m;
+            geodesic.solveInverse(52.0_deg, 21.0_deg, p.lat[i], p.lon[i], &distance);
+            if (distance <= range) indices.push_back(i);
+        }
+        benchmark::DoNotOptimize(indices.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+    state.counters["found"] = indices.size();
+}
+
+void BM_Geodesic_WithinDistance_Find(benchmark::State& state)
+{
+    const units::length::meter_t range(1000.0 * state.range(0));
+    mc::Geodesic geodesic(mc::WGS84::ellipsoid);
+    GeoPoints p = makeRandomGeoPoints(kCount, 1);
+    std::vector<size_t> indices;
+
+    for (auto _ : state)
+    {
+        geodesic.findWithinDistance(52.0_deg, 21.0_deg, range, p.lat, p.lon, &indices);
+        benchmark::DoNotOptimize(indices.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+    state.counters["found"] = indices.size();
+}
+
+} // namespace
+
+BENCHMARK(BM_Geodesic_Direct)->Name("Geodesic/Direct");
+BENCHMARK(BM_Geodesic_Distances)->Name("Geodesic/Distances")
+    ->Arg(static_cast<int>(mc::GeodesicMode::Ellipsoidal))
+    ->Arg(static_cast<int>(mc::GeodesicMode::Spherical))->ArgName("mode");
+BENCHMARK(BM_Geodesic_WithinDistance_Inverse)->Name("Geodesic/WithinDistance/Inverse")->Arg(100)->Arg(1000)->Arg(5000)->ArgName("range_km");
+BENCHMARK(BM_Geodesic_WithinDistance_Find)->Name("Geodesic/WithinDistance/Find")->Arg(100)->Arg(1000)->Arg(5000)->ArgName("range_km");
@@ -0,0 +1,199 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <mcutils/geo/ECEF.h>
+#include <mcutils/geo/LocalTangentPlane.h>
+#include <mcutils/geo/WGS84.h>
+
+#include <geo/GeoPoints.h>
+
+namespace {
+
+constexpr size_t kCount = 1 << 16;
+
+// points with their local North-East-Down coordinates
+struct Points : GeoPoints
+{
+    std::vector<units::length::meter_t> n;
+    std::vector<units::length::meter_t> e;
+    std::vector<units::length::meter_t> d;
+};
+
+mc::Geo getOrigin()
+{
+    mc::Geo origin;
+    origin.lat = 52.0_deg;
+    origin.lon = 21.0_deg;
+    origin.alt = 100.0_m;
+    return origin;
+}
+
+// points within 100 km from the origin and altitudes up to 12 km
+Points makePoints()
+{
+    const mc::Geo origin = getOrigin();
+
+    Points points;
+    static_cast<GeoPoints&>(points) = makeGeoPoints(kCount,
+                                                    origin.lat - 0.015_rad, origin.lat + 0.015_rad,
+                                                    origin.lon - 0.025_rad, origin.lon + 0.025_rad,
+                                                    0.0_m, 12000.0_m);
+
+    points.n.resize(kCount);
+    points.e.resize(kCount);
+    points.d.resize(kCount);
+
+    return points;
+}
+
+// converting points the way it is done without LocalTangentPlane
+void BM_Geo2NED_Chained(benchmark::State& state)
+{
+    mc::ECEF ecef(mc::WGS84::ellipsoid);
+    ecef.setPosition(getOrigin());
+    Points p = makePoints();
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < kCount; ++i)
+        {
+            mc::Vector3_m pos_cart = ecef.convertGeo2Cart(p.lat[i], p.lon[i], p.alt[i]);
+            mc::Vector3_m pos_ned = ecef.ecef2ned() * (pos_cart - ecef.pos_cart());
+            p.n[i] = pos_ned.x();
+            p.e[i] = pos_ned.y();
+            p.d[i] = pos_ned.z();
+        }
+        benchmark::DoNotOptimize(p.n.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_Geo2NED_Loop(benchmark::State& state)
+{
+    mc::LocalTangentPlane ltp(mc::WGS84::ellipsoid, getOrigin());
+    Points p = makePoints();
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < kCount; ++i)
+        {
+            mc::Geo pos_geo;
+            pos_geo.lat = p.lat[i];
+            pos_geo.lon = p.lon[i];
+            pos_geo.alt = p.alt[i];
+            mc::Vector3_m pos_ned = ltp.convertGeo2NED(pos_geo);
+            p.n[i] = pos_ned.x();
+            p.e[i] = pos_ned.y();
+            p.d[i] = pos_ned.z();
+        }
+        benchmark::DoNotOptimize(p.n.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_Geo2NED_Batch(benchmark::State& state)
+{
+    const unsigned int threads = static_cast<unsigned int>(state.range(0));
+    mc::LocalTangentPlane ltp(mc::WGS84::ellipsoid, getOrigin());
+    Points p = makePoints();
+
+    for (auto _ : state)
+    {
+        ltp.convertGeo2NED(p.lat, p.lon, p.alt, p.n, p.e, p.d, threads);
+        benchmark::DoNotOptimize(p.n.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_NED2Geo_Chained(benchmark::State& state)
+{
+    mc::ECEF ecef(mc::WGS84::ellipsoid);
+    ecef.setPosition(getOrigin());
+    Points p = makePoints();
+    mc::LocalTangentPlane(mc::WGS84::ellipsoid, getOrigin()).convertGeo2NED(p.lat, p.lon, p.alt, p.n, p.e, p.d);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < kCount; ++i)
+        {
+            mc::Vector3_m pos_cart = ecef.pos_cart() + ecef.ned2ecef() * mc::Vector3_m(p.n[i], p.e[i], p.d[i]);
+            ecef.convertCart2Geo(pos_cart.x(), pos_cart.y(), pos_cart.z(), &p.lat[i], &p.lon[i], &p.alt[i]);
+        }
+        benchmark::DoNotOptimize(p.lat.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_NED2Geo_Batch(benchmark::State& state)
+{
+    const unsigned int threads = static_cast<unsigned int>(state.range(0));
+    mc::LocalTangentPlane ltp(mc::WGS84::ellipsoid, getOrigin());
+    Points p = makePoints();
+    ltp.convertGeo2NED(p.lat, p.lon, p.alt, p.n, p.e, p.d);
+
+    for (auto _ : state)
+    {
+        ltp.convertNED2Geo(p.n, p.e, p.d, p.lat, p.lon, p.alt, threads);
+        benchmark::DoNotOptimize(p.lat.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_ECEF2ENU_Chained(benchmark::State& state)
+{
+    mc::ECEF ecef(mc::WGS84::ellipsoid);
+    ecef.setPosition(getOrigin());
+    Points p = makePoints();
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < kCount; ++i)
+        {
+            mc::Vector3_m pos_enu = ecef.ecef2enu() * (mc::Vector3_m(p.x[i], p.y[i], p.z[i]) - ecef.pos_cart());
+            p.e[i] = pos_enu.x();
+            p.n[i] = pos_enu.y();
+            p.d[i] = pos_enu.z();
+        }
+        benchmark::DoNotOptimize(p.e.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_ECEF2ENU_Batch(benchmark::State& state)
+{
+    mc::LocalTangentPlane ltp(mc::WGS84::ellipsoid, getOrigin());
+    Points p = makePoints();
+
+    for (auto _ : state)
+    {
+        // up coordinates are stored in the down array
+        ltp.convertECEF2ENU(p.x, p.y, p.z, p.e, p.n, p.d);
+        benchmark::DoNotOptimize(p.e.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+} // namespace
+
+BENCHMARK(BM_Geo2NED_Chained )->Name("LocalTangentPlane/Geo2NED/Chained");
+BENCHMARK(BM_Geo2NED_Loop    )->Name("LocalTangentPlane/Geo2NED/Loop");
+BENCHMARK(BM_Geo2NED_Batch   )->Name("LocalTangentPlane/Geo2NED/Batch")->Arg(1)->Arg(4)->ArgName("threads")->UseRealTime();
+BENCHMARK(BM_NED2Geo_Chained )->Name("LocalTangentPlane/NED2Geo/Chained");
+BENCHMARK(BM_NED2Geo_Batch   )->Name("LocalTangentPlane/NED2Geo/Batch")->Arg(1)->Arg(4)->ArgName("threads")->UseRealTime();
+BENCHMARK(BM_ECEF2ENU_Chained)->Name("LocalTangentPlane/ECEF2ENU/Chained");
+BENCHMARK(BM_ECEF2ENU_Batch  )->Name("LocalTangentPlane/ECEF2ENU/Batch");
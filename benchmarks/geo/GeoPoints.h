@@ -0,0 +1,91 @@
+#ifndef BENCHMARKS_GEO_GEOPOINTS_H_
+#define BENCHMARKS_GEO_GEOPOINTS_H_
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <mcutils/geo/ECEF.h>
+#include <mcutils/geo/WGS84.h>
+
+/**
+ * \brief Geodetic points and their WGS84 ECEF coordinates as structure of arrays.
+ */
+struct GeoPoints
+{
+    std::vector<units::angle::radian_t> lat;
+    std::vector<units::angle::radian_t> lon;
+    std::vector<units::length::meter_t> alt;
+
+    std::vector<units::length::meter_t> x;
+    std::vector<units::length::meter_t> y;
+    std::vector<units::length::meter_t> z;
+};
+
+/**
+ * \brief Calculates ECEF coordinates of the points.
+ * \param points points with geodetic coordinates set
+ */
+inline void setGeoPointsCart(GeoPoints* points)
+{
+    const size_t count = points->lat.size();
+    points->x.resize(count);
+    points->y.resize(count);
+    points->z.resize(count);
+    mc::ECEF(mc::WGS84::ellipsoid).convertGeo2Cart(points->lat, points->lon, points->alt,
+                                                   points->x, points->y, points->z);
+}
+
+/**
+ * \brief Makes points evenly spread over the given area.
+ *
+ * Latitudes, longitudes and altitudes are repeated with co-prime periods
+ * (997, 1009 and 13), so consecutive points differ in all of them.
+ */
+inline GeoPoints makeGeoPoints(size_t count,
+                               units::angle::radian_t lat_min, units::angle::radian_t lat_max,
+                               units::angle::radian_t lon_min, units::angle::radian_t lon_max,
+                               units::length::meter_t alt_min, units::length::meter_t alt_max)
+{
+    GeoPoints points;
+    points.lat.resize(count);
+    points.lon.resize(count);
+    points.alt.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        points.lat[i] = lat_min + (lat_max - lat_min) * ((i % 997) / 996.0);
+        points.lon[i] = lon_min + (lon_max - lon_min) * ((i % 1009) / 1008.0);
+        points.alt[i] = alt_min + (alt_max - alt_min) * ((i % 13) / 12.0);
+    }
+
+    setGeoPointsCart(&points);
+
+    return points;
+}
+
+/**
+ * \brief Makes points randomly spread over the whole globe at zero altitude.
+ * The same seed gives the same points.
+ */
+inline GeoPoints makeRandomGeoPoints(size_t count, unsigned int seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist_lat(-0.5 * M_PI, 0.5 * M_PI);
+    std::uniform_real_distribution<double> dist_lon(-M_PI, M_PI);
+
+    GeoPoints points;
+    points.lat.resize(count);
+    points.lon.resize(count);
+    points.alt.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        points.lat[i] = units::angle::radian_t(dist_lat(gen));
+        points.lon[i] = units::angle::radian_t(dist_lon(gen));
+    }
+
+    setGeoPointsCart(&points);
+
+    return points;
+}
+
+#endif // BENCHMARKS_GEO_GEOPOINTS_H_
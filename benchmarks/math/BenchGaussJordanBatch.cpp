@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <mcutils/math/GaussJordanBatch.h>
+
+namespace {
+
+constexpr unsigned int kCount = 4096;
+
+template <unsigned int SIZE>
+void makeSystems(std::vector<mc::MatrixNxN<double, SIZE>>* mtr,
+                 std::vector<mc::VectorN<double, SIZE>>* rhs)
+{
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    mtr->resize(kCount);
+    rhs->resize(kCount);
+    for (unsigned int i = 0; i < kCount; ++i)
+    {
+        for (unsigned int r = 0; r < SIZE; ++r)
+        {
+            for (unsigned int c = 0; c < SIZE; ++c)
+            {
+                (*mtr)[i](r,c) = dist(gen) + (r == c ? 2.0 : 0.0);
+            }
+            (*rhs)[i](r) = dist(gen);
+        }
+    }
+}
+
+// solving systems one by one with solveGaussJordan() is benchmarked
+// in BenchLinearSolvers.cpp (LinearSolvers/N/GaussJordan), items per
+// second of both are comparable
+template <unsigned int SIZE>
+void BM_GaussJordanBatch(benchmark::State& state)
+{
+    const unsigned int threads = static_cast<unsigned int>(state.range(0));
+    std::vector<mc::MatrixNxN<double, SIZE>> mtr;
+    std::vector<mc::VectorN<double, SIZE>> rhs;
+    makeSystems<SIZE>(&mtr, &rhs);
+    std::vector<mc::VectorN<double, SIZE>> x(kCount);
+
+    for (auto _ : state)
+    {
+        mc::solveGaussJordanBatch(mtr.data(), rhs.data(), x.data(), kCount,
+                                  nullptr, 1.0e-9, threads);
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+} // namespace
+
+BENCHMARK(BM_GaussJordanBatch<3>)->Name("GaussJordanBatch/3/Batch")->Arg(1)->Arg(4)->ArgName("threads")->UseRealTime();
+BENCHMARK(BM_GaussJordanBatch<4>)->Name("GaussJordanBatch/4/Batch")->Arg(1)->Arg(4)->ArgName("threads")->UseRealTime();
+BENCHMARK(BM_GaussJordanBatch<6>)->Name("GaussJordanBatch/6/Batch")->Arg(1)->Arg(4)->ArgName("threads")->UseRealTime();
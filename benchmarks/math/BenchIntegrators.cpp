@@ -0,0 +1,272 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <mcutils/math/EulerRect.h>
+#include <mcutils/math/RungeKutta4.h>
+#include <mcutils/math/RungeKutta45.h>
+#include <mcutils/math/RungeKutta78.h>
+#include <mcutils/math/Vector.h>
+
+namespace {
+
+using StateVector = mc::VectorN<double, 13>;
+
+constexpr double kStep = 0.01;
+
+// rigid body state vector
+// 0-2:  position
+// 3-5:  velocity
+// 6-9:  attitude quaternion (e0, ex, ey, ez)
+// 10-12: angular velocity
+StateVector getStateDeriv(const StateVector& s)
+{
+    constexpr double ixx = 1.0;
+    constexpr double iyy = 2.0;
+    constexpr double izz = 3.0;
+    constexpr double drag = 0.1;
+
+    StateVector d;
+
+    // position
+    d(0) = s(3);
+    d(1) = s(4);
+    d(2) = s(5);
+
+    // velocity
+    d(3) = -drag * s(3);
+    d(4) = -drag * s(4);
+    d(5) = -drag * s(5) + 9.81;
+
+    // quaternion derivative
+    const double p = s(10);
+    const double q = s(11);
+    const double r = s(12);
+    d(6) = -0.5 * (s(7) * p + s(8) * q + s(9) * r);
+    d(7) =  0.5 * (s(6) * p - s(9) * q + s(8) * r);
+    d(8) =  0.5 * (s(9) * p + s(6) * q - s(7) * r);
+    d(9) =  0.5 * (s(7) * q - s(8) * p + s(6) * r);
+
+    // Euler's rotation equations
+    d(10) = (iyy - izz) * q * r / ixx;
+    d(11) = (izz - ixx) * r * p / iyy;
+    d(12) = (ixx - iyy) * p * q / izz;
+
+    return d;
+}
+
+StateVector getInitialState()
+{
+    StateVector s;
+    s(3)  = 50.0;
+    s(6)  = 1.0;
+    s(10) = 0.1;
+    s(11) = 0.2;
+    s(12) = 0.3;
+    return s;
+}
+
+template <typename INTEGRATOR>
+void BM_Integrate(benchmark::State& state, INTEGRATOR integrator)
+{
+    StateVector s = getInitialState();
+
+    for (auto _ : state)
+    {
+        s = integrator.integrate(kStep, s);
+        benchmark::DoNotOptimize(s);
+    }
+}
+
+template <typename INTEGRATOR>
+void BM_IntegrateInPlace(benchmark::State& state, INTEGRATOR integrator)
+{
+    StateVector s = getInitialState();
+
+    for (auto _ : state)
+    {
+        integrator.integrate(kStep, &s);
+        benchmark::DoNotOptimize(s);
+    }
+}
+
+void BM_RungeKutta4_StdFunction(benchmark::State& state)
+{
+    mc::RungeKutta4<StateVector, double> rk;
+    rk.setFun(getStateDeriv);
+    BM_Integrate(state, rk);
+}
+
+void BM_RungeKutta4_Templated(benchmark::State& state)
+{
+    auto fun = [](const StateVector& s) { return getStateDeriv(s); };
+    BM_Integrate(state, mc::RungeKutta4<StateVector, double, decltype(fun)>(fun));
+}
+
+void BM_RungeKutta4_TemplatedInPlace(benchmark::State& state)
+{
+    auto fun = [](const StateVector& s) { return getStateDeriv(s); };
+    BM_IntegrateInPlace(state, mc::RungeKutta4<StateVector, double, decltype(fun)>(fun));
+}
+
+void BM_EulerRect_StdFunction(benchmark::State& state)
+{
+    mc::EulerRect<StateVector, double> er;
+    er.setFun(getStateDeriv);
+    BM_Integrate(state, er);
+}
+
+void BM_EulerRect_Templated(benchmark::State& state)
+{
+    auto fun = [](const StateVector& s) { return getStateDeriv(s); };
+    BM_Integrate(state, mc::EulerRect<StateVector, double, decltype(fun)>(fun));
+}
+
+void BM_EulerRect_TemplatedInPlace(benchmark::State& state)
+{
+    auto fun = [](const StateVector& s) { return getStateDeriv(s); };
+    BM_IntegrateInPlace(state, mc::EulerRect<StateVector, double, decltype(fun)>(fun));
+}
+
+// Mass-Spring-Damper cases of the tests DiffEquationSolver
+// m * (d^2 x)/(d t^2)  +  c * dx/dt  +  k * x  =  0
+// state vector
+// index 0: x
+// index 1: dx/dt
+struct MsdCase
+{
+    double m;
+    double k;
+    double c;
+    double x_0;
+    double x_1;
+};
+
+constexpr MsdCase kMsdCases[] = {
+    { 1.0, 1.0, 3.0, 0.0, 1.0 },
+    { 1.0, 1.0, 3.0, 1.0, 0.0 },
+    { 1.0, 1.0, 3.0, 1.0, 1.0 },
+    { 1.0, 1.0, 1.0, 0.0, 1.0 },
+    { 1.0, 1.0, 1.0, 1.0, 0.0 },
+    { 1.0, 1.0, 1.0, 1.0, 1.0 }
+};
+
+constexpr double kMsdTimeMax = 10.0;
+constexpr double kMsdTimeStep = 1.0e-2;     ///< DiffEquationSolver time step
+constexpr double kMsdTolerance = 1.0e-9;    ///< adaptive integrators tolerance
+
+struct MsdDeriv
+{
+    MsdCase msd;
+    unsigned int* evaluations = nullptr;
+
+    mc::Vector3d operator()(const mc::Vector3d& s) const
+    {
+        ++(*evaluations);
+        mc::Vector3d d;
+        d(0) = s(1);
+        d(1) = -(msd.k * s(0) + msd.c * s(1)) / msd.m;
+        return d;
+    }
+};
+
+double getMsdExactSolution(const MsdCase& msd, double t)
+{
+    const double delta = msd.c * msd.c - 4.0 * msd.m * msd.k;
+    if ( delta > 0.0 )
+    {
+        const double sqrt_delta = sqrt(delta);
+        const double r_1 = (-msd.c - sqrt_delta) / (2.0 * msd.m);
+        const double r_2 = (-msd.c + sqrt_delta) / (2.0 * msd.m);
+        const double c_2 = (msd.x_1 - msd.x_0 * r_1) / (r_2 - r_1);
+        const double c_1 = msd.x_0 - c_2;
+        return c_1 * exp(r_1 * t) + c_2 * exp(r_2 * t);
+    }
+
+    const double a = -msd.c / (2.0 * msd.m);
+    const double b = sqrt(-delta) / (2.0 * msd.m);
+    const double c_1 = msd.x_0;
+    const double c_2 = (msd.x_1 - c_1 * a) / b;
+    return exp(a * t) * (c_1 * cos(b * t) + c_2 * sin(b * t));
+}
+
+/**
+ * Integrates all the MSD cases sampling the state every output interval
+ * (state.range(0) in milliseconds). Reports number of derivative function
+ * evaluations and maximum error with respect to the exact solution.
+ */
+template <typename INTEGRATOR>
+void BM_MassSpringDamper(benchmark::State& state, double step, double tolerance)
+{
+    const double interval = 1.0e-3 * static_cast<double>(state.range(0));
+    const unsigned int outputs = static_cast<unsigned int>(std::lround(kMsdTimeMax / interval));
+
+    // fixed step integrators take steps of the given size between outputs,
+    // adaptive ones are asked to cover the whole output interval
+    const unsigned int substeps = step > 0.0
+            ? static_cast<unsigned int>(std::lround(interval / step)) : 1;
+
+    unsigned int evaluations = 0;
+    double max_error = 0.0;
+
+    for (auto _ : state)
+    {
+        evaluations = 0;
+        max_error = 0.0;
+
+        for ( const MsdCase& msd : kMsdCases )
+        {
+            INTEGRATOR integrator(MsdDeriv{ msd, &evaluations });
+            if constexpr ( requires { integrator.setTolerances(tolerance, tolerance); } )
+            {
+                integrator.setTolerances(tolerance, tolerance);
+            }
+
+            mc::Vector3d s;
+            s(0) = msd.x_0;
+            s(1) = msd.x_1;
+
+            for ( unsigned int i = 1; i <= outputs; ++i )
+            {
+                for ( unsigned int j = 0; j < substeps; ++j )
+                {
+                    integrator.integrate(interval / substeps, &s);
+                }
+                const double t = i * interval;
+                max_error = std::max(max_error, fabs(s(0) - getMsdExactSolution(msd, t)));
+            }
+            benchmark::DoNotOptimize(s);
+        }
+    }
+
+    state.counters["evaluations"] = evaluations;
+    state.counters["max_error"] = max_error;
+}
+
+void BM_MassSpringDamper_RungeKutta4(benchmark::State& state)
+{
+    BM_MassSpringDamper<mc::RungeKutta4<mc::Vector3d, double, MsdDeriv>>(state, kMsdTimeStep, 0.0);
+}
+
+void BM_MassSpringDamper_RungeKutta45(benchmark::State& state)
+{
+    BM_MassSpringDamper<mc::RungeKutta45<mc::Vector3d, double, MsdDeriv>>(state, 0.0, kMsdTolerance);
+}
+
+void BM_MassSpringDamper_RungeKutta78(benchmark::State& state)
+{
+    BM_MassSpringDamper<mc::RungeKutta78<mc::Vector3d, double, MsdDeriv>>(state, 0.0, kMsdTolerance);
+}
+
+} // namespace
+
+BENCHMARK(BM_RungeKutta4_StdFunction     )->Name("Integrators/RungeKutta4/StdFunction");
+BENCHMARK(BM_RungeKutta4_Templated       )->Name("Integrators/RungeKutta4/Templated");
+BENCHMARK(BM_RungeKutta4_TemplatedInPlace)->Name("Integrators/RungeKutta4/TemplatedInPlace");
+BENCHMARK(BM_EulerRect_StdFunction       )->Name("Integrators/EulerRect/StdFunction");
+BENCHMARK(BM_EulerRect_Templated         )->Name("Integrators/EulerRect/Templated");
+BENCHMARK(BM_EulerRect_TemplatedInPlace  )->Name("Integrators/EulerRect/TemplatedInPlace");
+BENCHMARK(BM_MassSpringDamper_RungeKutta4 )->Name("Integrators/MassSpringDamper/RungeKutta4" )->Arg(10)->Arg(1000)->ArgName("output_ms");
+BENCHMARK(BM_MassSpringDamper_RungeKutta45)->Name("Integrators/MassSpringDamper/RungeKutta45")->Arg(10)->Arg(1000)->ArgName("output_ms");
+BENCHMARK(BM_MassSpringDamper_RungeKutta78)->Name("Integrators/MassSpringDamper/RungeKutta78")->Arg(10)->Arg(1000)->ArgName("output_ms");
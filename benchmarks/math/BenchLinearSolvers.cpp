@@ -0,0 +1,165 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <mcutils/math/CholeskyDecomposition.h>
+#include <mcutils/math/GaussJordan.h>
+#include <mcutils/math/LUDecomposition.h>
+#include <mcutils/math/QRDecomposition.h>
+
+namespace {
+
+constexpr unsigned int kCount = 256;
+
+template <unsigned int SIZE>
+mc::MatrixNxN<double, SIZE> makeMatrix()
+{
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    // symmetric positive-definite, so it suits all of the solvers
+    mc::MatrixNxN<double, SIZE> a;
+    for (unsigned int i = 0; i < a.kSize; ++i)
+    {
+        a(i) = dist(gen);
+    }
+    return a.getTransposed() * a + mc::MatrixNxN<double, SIZE>::getIdentityMatrix();
+}
+
+template <unsigned int SIZE>
+std::vector<mc::VectorN<double, SIZE>> makeVectors()
+{
+    std::mt19937 gen(2);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    std::vector<mc::VectorN<double, SIZE>> vectors(kCount);
+    for (mc::VectorN<double, SIZE>& v : vectors)
+    {
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            v(i) = dist(gen);
+        }
+    }
+    return vectors;
+}
+
+template <unsigned int SIZE>
+void BM_GaussJordan(benchmark::State& state)
+{
+    const mc::MatrixNxN<double, SIZE> m = makeMatrix<SIZE>();
+    const std::vector<mc::VectorN<double, SIZE>> rhs = makeVectors<SIZE>();
+    std::vector<mc::VectorN<double, SIZE>> x(kCount);
+
+    for (auto _ : state)
+    {
+        for (unsigned int i = 0; i < kCount; ++i)
+        {
+            mc::solveGaussJordan(m, rhs[i], &x[i]);
+        }
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+// decomposition is done once and reused for all of the right hand sides
+template <typename DECOMPOSITION, unsigned int SIZE>
+void BM_Reused(benchmark::State& state)
+{
+    const mc::MatrixNxN<double, SIZE> m = makeMatrix<SIZE>();
+    const std::vector<mc::VectorN<double, SIZE>> rhs = makeVectors<SIZE>();
+    std::vector<mc::VectorN<double, SIZE>> x(kCount);
+
+    for (auto _ : state)
+    {
+        DECOMPOSITION dec(m);
+        for (unsigned int i = 0; i < kCount; ++i)
+        {
+            dec.solve(rhs[i], &x[i]);
+        }
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+// decomposition is done for every right hand side, like solveGaussJordan() does
+template <typename DECOMPOSITION, unsigned int SIZE>
+void BM_SingleShot(benchmark::State& state)
+{
+    const mc::MatrixNxN<double, SIZE> m = makeMatrix<SIZE>();
+    const std::vector<mc::VectorN<double, SIZE>> rhs = makeVectors<SIZE>();
+    std::vector<mc::VectorN<double, SIZE>> x(kCount);
+
+    for (auto _ : state)
+    {
+        for (unsigned int i = 0; i < kCount; ++i)
+        {
+            DECOMPOSITION dec(m);
+            dec.solve(rhs[i], &x[i]);
+        }
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+template <unsigned int SIZE>
+void BM_GaussJordanInverse(benchmark::State& state)
+{
+    const mc::MatrixNxN<double, SIZE> m = makeMatrix<SIZE>();
+    mc::MatrixNxN<double, SIZE> inv;
+
+    for (auto _ : state)
+    {
+        // inverse column by column, as it had to be done without decompositions
+        mc::VectorN<double, SIZE> col;
+        for (unsigned int c = 0; c < SIZE; ++c)
+        {
+            mc::VectorN<double, SIZE> e;
+            e(c) = 1.0;
+            mc::solveGaussJordan(m, e, &col);
+            for (unsigned int r = 0; r < SIZE; ++r)
+            {
+                inv(r,c) = col(r);
+            }
+        }
+        benchmark::DoNotOptimize(inv);
+    }
+}
+
+template <unsigned int SIZE>
+void BM_LUInverse(benchmark::State& state)
+{
+    const mc::MatrixNxN<double, SIZE> m = makeMatrix<SIZE>();
+    mc::MatrixNxN<double, SIZE> inv;
+
+    for (auto _ : state)
+    {
+        mc::invertMatrix(m, &inv);
+        benchmark::DoNotOptimize(inv);
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_GaussJordan<4>)->Name("LinearSolvers/4/GaussJordan");
+BENCHMARK(BM_SingleShot<mc::LUDecomposition<double, 4>, 4>)->Name("LinearSolvers/4/LU/SingleShot");
+BENCHMARK(BM_Reused<mc::LUDecomposition<double, 4>, 4>)->Name("LinearSolvers/4/LU/Reused");
+BENCHMARK(BM_Reused<mc::CholeskyDecomposition<double, 4>, 4>)->Name("LinearSolvers/4/Cholesky/Reused");
+BENCHMARK(BM_Reused<mc::QRDecomposition<double, 4>, 4>)->Name("LinearSolvers/4/QR/Reused");
+
+BENCHMARK(BM_GaussJordan<6>)->Name("LinearSolvers/6/GaussJordan");
+BENCHMARK(BM_SingleShot<mc::LUDecomposition<double, 6>, 6>)->Name("LinearSolvers/6/LU/SingleShot");
+BENCHMARK(BM_SingleShot<mc::CholeskyDecomposition<double, 6>, 6>)->Name("LinearSolvers/6/Cholesky/SingleShot");
+BENCHMARK(BM_SingleShot<mc::QRDecomposition<double, 6>, 6>)->Name("LinearSolvers/6/QR/SingleShot");
+BENCHMARK(BM_Reused<mc::LUDecomposition<double, 6>, 6>)->Name("LinearSolvers/6/LU/Reused");
+BENCHMARK(BM_Reused<mc::CholeskyDecomposition<double, 6>, 6>)->Name("LinearSolvers/6/Cholesky/Reused");
+BENCHMARK(BM_Reused<mc::QRDecomposition<double, 6>, 6>)->Name("LinearSolvers/6/QR/Reused");
+
+BENCHMARK(BM_GaussJordanInverse<6>)->Name("LinearSolvers/6/Inverse/GaussJordan");
+BENCHMARK(BM_LUInverse<6>)->Name("LinearSolvers/6/Inverse/LU");
@@ -0,0 +1,146 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <mcutils/math/Matrix.h>
+#include <mcutils/math/Vector.h>
+
+namespace {
+
+constexpr unsigned int kCount = 1024;
+
+template <typename MATRIX>
+std::vector<MATRIX> makeMatrices()
+{
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    std::vector<MATRIX> matrices(kCount);
+    for (MATRIX& m : matrices)
+    {
+        for (unsigned int i = 0; i < MATRIX::kSize; ++i)
+        {
+            m(i) = dist(gen);
+        }
+    }
+    return matrices;
+}
+
+template <typename VECTOR>
+std::vector<VECTOR> makeVectors()
+{
+    std::mt19937 gen(2);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    std::vector<VECTOR> vectors(kCount);
+    for (VECTOR& v : vectors)
+    {
+        for (unsigned int i = 0; i < VECTOR::kSize; ++i)
+        {
+            v(i) = dist(gen);
+        }
+    }
+    return vectors;
+}
+
+template <typename MATRIX, typename VECTOR>
+void BM_MatrixByVector(benchmark::State& state)
+{
+    const std::vector<MATRIX> matrices = makeMatrices<MATRIX>();
+    const std::vector<VECTOR> vectors = makeVectors<VECTOR>();
+    std::vector<VECTOR> result(kCount);
+
+    for (auto _ : state)
+    {
+        for (unsigned int i = 0; i < kCount; ++i)
+        {
+            result[i] = matrices[i] * vectors[i];
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+template <typename MATRIX, typename VECTOR>
+void BM_MatrixByVectorGeneric(benchmark::State& state)
+{
+    constexpr unsigned int size = VECTOR::kSize;
+
+    const std::vector<MATRIX> matrices = makeMatrices<MATRIX>();
+    const std::vector<VECTOR> vectors = makeVectors<VECTOR>();
+    std::vector<VECTOR> result(kCount);
+
+    for (auto _ : state)
+    {
+        for (unsigned int i = 0; i < kCount; ++i)
+        {
+            // explicit template arguments bypass the SIMD overloads
+            mc::multiplyMatrixByVector<double, double, double, size, size>(matrices[i], vectors[i], &result[i]);
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+template <typename MATRIX>
+void BM_MatrixByMatrix(benchmark::State& state)
+{
+    const std::vector<MATRIX> lhs = makeMatrices<MATRIX>();
+    const std::vector<MATRIX> rhs = makeMatrices<MATRIX>();
+    std::vector<MATRIX> result(kCount);
+
+    for (auto _ : state)
+    {
+        for (unsigned int i = 0; i < kCount; ++i)
+        {
+            result[i] = lhs[i] * rhs[(i + 1) % kCount];
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+template <typename MATRIX>
+void BM_MatrixByMatrixGeneric(benchmark::State& state)
+{
+    constexpr unsigned int size = MATRIX::kRows;
+
+    const std::vector<MATRIX> lhs = makeMatrices<MATRIX>();
+    const std::vector<MATRIX> rhs = makeMatrices<MATRIX>();
+    std::vector<MATRIX> result(kCount);
+
+    for (auto _ : state)
+    {
+        for (unsigned int i = 0; i < kCount; ++i)
+        {
+            // explicit template arguments bypass the SIMD overloads
+            mc::multiplyMatrixByMatrix<double, double, double, size, size, size>(lhs[i], rhs[(i + 1) % kCount], &result[i]);
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+} // namespace
+
+BENCHMARK(BM_MatrixByVector<mc::Matrix3x3d, mc::Vector3d>)->Name("Matrix3x3d/MultiplyByVector");
+BENCHMARK(BM_MatrixByVectorGeneric<mc::Matrix3x3d, mc::Vector3d>)->Name("Matrix3x3d/MultiplyByVector/Generic");
+BENCHMARK(BM_MatrixByMatrix<mc::Matrix3x3d>)->Name("Matrix3x3d/MultiplyByMatrix");
+BENCHMARK(BM_MatrixByMatrixGeneric<mc::Matrix3x3d>)->Name("Matrix3x3d/MultiplyByMatrix/Generic");
+
+BENCHMARK(BM_MatrixByVector<mc::RotMatrix, mc::Vector3d>)->Name("RotMatrix/MultiplyByVector");
+BENCHMARK(BM_MatrixByMatrix<mc::RotMatrix>)->Name("RotMatrix/MultiplyByMatrix");
+
+BENCHMARK(BM_MatrixByVector<mc::Matrix4x4d, mc::Vector4d>)->Name("Matrix4x4d/MultiplyByVector");
+BENCHMARK(BM_MatrixByVectorGeneric<mc::Matrix4x4d, mc::Vector4d>)->Name("Matrix4x4d/MultiplyByVector/Generic");
+BENCHMARK(BM_MatrixByMatrix<mc::Matrix4x4d>)->Name("Matrix4x4d/MultiplyByMatrix");
+BENCHMARK(BM_MatrixByMatrixGeneric<mc::Matrix4x4d>)->Name("Matrix4x4d/MultiplyByMatrix/Generic");
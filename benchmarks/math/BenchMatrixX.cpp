@@ -0,0 +1,102 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include <mcutils/math/MatrixX.h>
+
+namespace {
+
+mc::MatrixX<double> makeMatrix(unsigned int size, unsigned int seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    mc::MatrixX<double> m(size, size);
+    for (unsigned int i = 0; i < m.size(); ++i)
+    {
+        m(i) = dist(gen);
+    }
+    return m;
+}
+
+mc::VectorX<double> makeVector(unsigned int size, unsigned int seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    mc::VectorX<double> v(size);
+    for (unsigned int i = 0; i < v.size(); ++i)
+    {
+        v(i) = dist(gen);
+    }
+    return v;
+}
+
+void BM_MultiplyByMatrix(benchmark::State& state)
+{
+    const unsigned int size = static_cast<unsigned int>(state.range(0));
+    const mc::MatrixX<double> lhs = makeMatrix(size, 1);
+    const mc::MatrixX<double> rhs = makeMatrix(size, 2);
+    mc::MatrixX<double> result(size, size);
+
+    for (auto _ : state)
+    {
+        mc::multiplyMatrixByMatrix(lhs, rhs, &result);
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size * size);
+}
+
+// textbook i-j-k loop, as in the fixed size multiplyMatrixByMatrix()
+void BM_MultiplyByMatrixNaive(benchmark::State& state)
+{
+    const unsigned int size = static_cast<unsigned int>(state.range(0));
+    const mc::MatrixX<double> lhs = makeMatrix(size, 1);
+    const mc::MatrixX<double> rhs = makeMatrix(size, 2);
+    mc::MatrixX<double> result(size, size);
+
+    for (auto _ : state)
+    {
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            for (unsigned int j = 0; j < size; ++j)
+            {
+                double sum = 0.0;
+                for (unsigned int k = 0; k < size; ++k)
+                {
+                    sum += lhs(i,k) * rhs(k,j);
+                }
+                result(i,j) = sum;
+            }
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size * size);
+}
+
+void BM_MultiplyByVector(benchmark::State& state)
+{
+    const unsigned int size = static_cast<unsigned int>(state.range(0));
+    const mc::MatrixX<double> mat = makeMatrix(size, 1);
+    const mc::VectorX<double> vect = makeVector(size, 2);
+    mc::VectorX<double> result(size);
+
+    for (auto _ : state)
+    {
+        mc::multiplyMatrixByVector(mat, vect, &result);
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+
+} // namespace
+
+BENCHMARK(BM_MultiplyByMatrix     )->Name("MatrixX/MultiplyByMatrix"      )->RangeMultiplier(2)->Range(32, 512);
+BENCHMARK(BM_MultiplyByMatrixNaive)->Name("MatrixX/MultiplyByMatrix/Naive")->RangeMultiplier(2)->Range(32, 512);
+BENCHMARK(BM_MultiplyByVector     )->Name("MatrixX/MultiplyByVector"      )->RangeMultiplier(2)->Range(32, 512);
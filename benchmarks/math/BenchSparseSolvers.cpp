@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <mcutils/math/GaussJordan.h>
+#include <mcutils/math/IterativeSolvers.h>
+
+namespace {
+
+// 2D Poisson problem 5-point stencil on k x k grid, k^2 unknowns
+mc::SparseMatrixCSR<double> makeLaplacian(unsigned int k)
+{
+    const unsigned int n = k * k;
+    std::vector<mc::SparseEntry<double>> entries;
+    entries.reserve(5 * n);
+    for (unsigned int i = 0; i < k; ++i)
+    {
+        for (unsigned int j = 0; j < k; ++j)
+        {
+            const unsigned int row = i * k + j;
+            entries.push_back({ row, row, 4.0 });
+            if (i > 0)     entries.push_back({ row, row - k, -1.0 });
+            if (i < k - 1) entries.push_back({ row, row + k, -1.0 });
+            if (j > 0)     entries.push_back({ row, row - 1, -1.0 });
+            if (j < k - 1) entries.push_back({ row, row + 1, -1.0 });
+        }
+    }
+    return mc::SparseMatrixCSR<double>(n, n, entries);
+}
+
+mc::VectorX<double> makeRhs(unsigned int n)
+{
+    mc::VectorX<double> rhs(n);
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        rhs(i) = 1.0 + 0.1 * (i % 7);
+    }
+    return rhs;
+}
+
+void BM_GaussJordanDense(benchmark::State& state)
+{
+    const unsigned int k = static_cast<unsigned int>(state.range(0));
+    const mc::MatrixX<double> a = makeLaplacian(k).getMatrixX();
+    const mc::VectorX<double> b = makeRhs(a.rows());
+    mc::VectorX<double> x;
+
+    for (auto _ : state)
+    {
+        mc::solveGaussJordan(a, b, &x);
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["n"] = a.rows();
+}
+
+template <mc::Preconditioner PRECOND>
+void BM_ConjugateGradient(benchmark::State& state)
+{
+    const unsigned int k = static_cast<unsigned int>(state.range(0));
+    const mc::SparseMatrixCSR<double> a = makeLaplacian(k);
+    const mc::VectorX<double> b = makeRhs(a.rows());
+    unsigned int iterations = 0;
+
+    for (auto _ : state)
+    {
+        mc::VectorX<double> x;
+        mc::solveConjugateGradient(a, b, &x, 1.0e-9, 10000, PRECOND, &iterations);
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["n"] = a.rows();
+    state.counters["iterations"] = iterations;
+}
+
+void BM_BiCGSTAB(benchmark::State& state)
+{
+    const unsigned int k = static_cast<unsigned int>(state.range(0));
+    const mc::SparseMatrixCSR<double> a = makeLaplacian(k);
+    const mc::VectorX<double> b = makeRhs(a.rows());
+    unsigned int iterations = 0;
+
+    for (auto _ : state)
+    {
+        mc::VectorX<double> x;
+        mc::solveBiCGSTAB(a, b, &x, 1.0e-9, 10000, mc::Preconditioner::Jacobi, &iterations);
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["n"] = a.rows();
+    state.counters["iterations"] = iterations;
+}
+
+} // namespace
+
+// grid size k gives k^2 unknowns, dense solver is O(n^3) while the iterative
+// ones are roughly O(n^1.5) for this problem, which shows the crossover point
+BENCHMARK(BM_GaussJordanDense)->Name("SparseSolvers/GaussJordan/Dense")->RangeMultiplier(2)->Range(4, 32);
+BENCHMARK(BM_ConjugateGradient<mc::Preconditioner::None>)->Name("SparseSolvers/CG")->RangeMultiplier(2)->Range(4, 32);
+BENCHMARK(BM_ConjugateGradient<mc::Preconditioner::Jacobi>)->Name("SparseSolvers/CG/Jacobi")->RangeMultiplier(2)->Range(4, 32);
+BENCHMARK(BM_BiCGSTAB)->Name("SparseSolvers/BiCGSTAB/Jacobi")->RangeMultiplier(2)->Range(4, 32);
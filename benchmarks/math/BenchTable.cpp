@@ -0,0 +1,248 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <mcutils/math/Table.h>
+
+namespace {
+
+constexpr unsigned int kQueries = 1024;
+
+mc::Table<double,double> makeTable(unsigned int size, bool uniform)
+{
+    std::vector<double> key_values(size);
+    std::vector<double> table_data(size);
+
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<double> dist(0.5, 1.5);
+
+    double key = 0.0;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        key_values[i] = key;
+        table_data[i] = key * key;
+        key += uniform ? 1.0 : dist(gen);
+    }
+
+    return mc::Table<double,double>(key_values, table_data);
+}
+
+std::vector<double> makeRandomKeys(const mc::Table<double,double>& tab)
+{
+    std::mt19937 gen(2);
+    std::uniform_real_distribution<double> dist(tab.getKeyByIndex(0), tab.getKeyByIndex(tab.size() - 1));
+
+    std::vector<double> keys(kQueries);
+    for (double& key : keys) key = dist(gen);
+    return keys;
+}
+
+std::vector<double> makeSequentialKeys(const mc::Table<double,double>& tab)
+{
+    const double key_min = tab.getKeyByIndex(0);
+    const double key_max = tab.getKeyByIndex(tab.size() - 1);
+    const double step = (key_max - key_min) / kQueries;
+
+    std::vector<double> keys(kQueries);
+    for (unsigned int i = 0; i < kQueries; ++i) keys[i] = key_min + step * i;
+    return keys;
+}
+
+template <mc::TableSearch SEARCH, bool RANDOM>
+void BM_TableGetValue(benchmark::State& state)
+{
+    mc::Table<double,double> tab = makeTable(static_cast<unsigned int>(state.range(0)), true);
+    tab.setSearch(SEARCH);
+
+    std::vector<double> keys = RANDOM ? makeRandomKeys(tab) : makeSequentialKeys(tab);
+
+    for (auto _ : state)
+    {
+        for (double key : keys)
+        {
+            benchmark::DoNotOptimize(tab.getValue(key));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <bool RANDOM>
+void BM_TableGetValueNonUniform(benchmark::State& state)
+{
+    mc::Table<double,double> tab = makeTable(static_cast<unsigned int>(state.range(0)), false);
+
+    std::vector<double> keys = RANDOM ? makeRandomKeys(tab) : makeSequentialKeys(tab);
+
+    for (auto _ : state)
+    {
+        for (double key : keys)
+        {
+            benchmark::DoNotOptimize(tab.getValue(key));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <bool RANDOM>
+void BM_TableGetValueCursor(benchmark::State& state)
+{
+    mc::Table<double,double> tab = makeTable(static_cast<unsigned int>(state.range(0)), false);
+
+    std::vector<double> keys = RANDOM ? makeRandomKeys(tab) : makeSequentialKeys(tab);
+
+    mc::TableCursor cursor;
+
+    for (auto _ : state)
+    {
+        for (double key : keys)
+        {
+            benchmark::DoNotOptimize(tab.getValue(key, cursor));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+void BM_TableGetValueLoop(benchmark::State& state)
+{
+    mc::Table<double,double> tab = makeTable(static_cast<unsigned int>(state.range(0)), false);
+
+    std::vector<double> keys = makeRandomKeys(tab);
+    std::vector<double> values(keys.size());
+
+    for (auto _ : state)
+    {
+        for (unsigned int i = 0; i < keys.size(); ++i)
+        {
+            values[i] = tab.getValue(keys[i]);
+        }
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+void BM_TableGetValues(benchmark::State& state)
+{
+    mc::Table<double,double> tab = makeTable(static_cast<unsigned int>(state.range(0)), false);
+
+    std::vector<double> keys = makeRandomKeys(tab);
+    std::vector<double> values(keys.size());
+
+    for (auto _ : state)
+    {
+        tab.getValues(keys, values);
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+// single table shared by all threads, each thread owns its cursor
+const mc::Table<double,double> kSharedTable = makeTable(512, false);
+
+void BM_TableGetValueShared(benchmark::State& state)
+{
+    std::vector<double> keys = makeSequentialKeys(kSharedTable);
+
+    mc::TableCursor cursor;
+
+    for (auto _ : state)
+    {
+        for (double key : keys)
+        {
+            benchmark::DoNotOptimize(kSharedTable.getValue(key, cursor));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+// binary search over non-uniform keys, reports table storage footprint
+void BM_TableGetValueStorage(benchmark::State& state)
+{
+    mc::Table<double,double> tab = makeTable(static_cast<unsigned int>(state.range(0)), false);
+
+    std::vector<double> keys = makeRandomKeys(tab);
+
+    for (auto _ : state)
+    {
+        for (double key : keys)
+        {
+            benchmark::DoNotOptimize(tab.getValue(key));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+    state.counters["bytes"] = static_cast<double>(tab.size() * sizeof(mc::Table<double,double>::Record));
+}
+
+// sine sampled over one period, reports max interpolation error alongside lookup throughput
+template <mc::TableInterpolation INTERPOLATION>
+void BM_TableGetValueInterpolation(benchmark::State& state)
+{
+    const unsigned int size = static_cast<unsigned int>(state.range(0));
+
+    std::vector<double> key_values(size);
+    std::vector<double> table_data(size);
+
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        key_values[i] = 2.0 * M_PI * i / (size - 1);
+        table_data[i] = std::sin(key_values[i]);
+    }
+
+    mc::Table<double,double> tab(key_values, table_data);
+    tab.setInterpolation(INTERPOLATION);
+
+    std::vector<double> keys = makeRandomKeys(tab);
+
+    for (auto _ : state)
+    {
+        for (double key : keys)
+        {
+            benchmark::DoNotOptimize(tab.getValue(key));
+        }
+    }
+
+    double error_max = 0.0;
+    for (double key : keys)
+    {
+        error_max = std::max(error_max, std::fabs(tab.getValue(key) - std::sin(key)));
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+    state.counters["max_error"] = error_max;
+}
+
+} // namespace
+
+BENCHMARK(BM_TableGetValue<mc::TableSearch::Linear  , true>)->Name("Table/GetValue/Linear/Random"    )->RangeMultiplier(4)->Range(8, 2048);
+BENCHMARK(BM_TableGetValue<mc::TableSearch::Binary  , true>)->Name("Table/GetValue/Binary/Random"    )->RangeMultiplier(4)->Range(8, 2048);
+BENCHMARK(BM_TableGetValue<mc::TableSearch::Uniform , true>)->Name("Table/GetValue/Uniform/Random"   )->RangeMultiplier(4)->Range(8, 2048);
+BENCHMARK(BM_TableGetValue<mc::TableSearch::Linear  , false>)->Name("Table/GetValue/Linear/Sequential" )->RangeMultiplier(4)->Range(8, 2048);
+BENCHMARK(BM_TableGetValue<mc::TableSearch::Binary  , false>)->Name("Table/GetValue/Binary/Sequential" )->RangeMultiplier(4)->Range(8, 2048);
+BENCHMARK(BM_TableGetValue<mc::TableSearch::Uniform , false>)->Name("Table/GetValue/Uniform/Sequential")->RangeMultiplier(4)->Range(8, 2048);
+
+BENCHMARK(BM_TableGetValueNonUniform<true >)->Name("Table/GetValue/NonUniform/Random"    )->RangeMultiplier(4)->Range(8, 2048);
+BENCHMARK(BM_TableGetValueNonUniform<false>)->Name("Table/GetValue/NonUniform/Sequential")->RangeMultiplier(4)->Range(8, 2048);
+
+BENCHMARK(BM_TableGetValueCursor<true >)->Name("Table/GetValue/Cursor/Random"    )->RangeMultiplier(4)->Range(8, 2048);
+BENCHMARK(BM_TableGetValueCursor<false>)->Name("Table/GetValue/Cursor/Sequential")->RangeMultiplier(4)->Range(8, 2048);
+
+BENCHMARK(BM_TableGetValueShared)->Name("Table/GetValue/Shared")->ThreadRange(1, 8);
+
+BENCHMARK(BM_TableGetValueLoop)->Name("Table/GetValues/ScalarLoop")->RangeMultiplier(4)->Range(8, 2048);
+BENCHMARK(BM_TableGetValues   )->Name("Table/GetValues/Batch"     )->RangeMultiplier(4)->Range(8, 2048);
+
+BENCHMARK(BM_TableGetValueStorage)->Name("Table/GetValue/Storage")->RangeMultiplier(10)->Range(10, 10000);
+
+BENCHMARK(BM_TableGetValueInterpolation<mc::TableInterpolation::Linear     >)->Name("Table/GetValue/Interpolation/Linear"     )->RangeMultiplier(4)->Range(8, 512);
+BENCHMARK(BM_TableGetValueInterpolation<mc::TableInterpolation::CubicSpline>)->Name("Table/GetValue/Interpolation/CubicSpline")->RangeMultiplier(4)->Range(8, 512);
+BENCHMARK(BM_TableGetValueInterpolation<mc::TableInterpolation::Pchip      >)->Name("Table/GetValue/Interpolation/Pchip"      )->RangeMultiplier(4)->Range(8, 512);
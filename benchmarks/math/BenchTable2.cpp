@@ -0,0 +1,154 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <mcutils/math/Table2.h>
+
+namespace {
+
+constexpr unsigned int kQueries = 1024;
+
+mc::Table2<double,double,double> makeTable(unsigned int rows, unsigned int cols)
+{
+    std::vector<double> row_values(rows);
+    std::vector<double> col_values(cols);
+    std::vector<double> table_data(rows * cols);
+
+    for (unsigned int r = 0; r < rows; ++r) row_values[r] = 0.5 * r;
+    for (unsigned int c = 0; c < cols; ++c) col_values[c] = 0.1 * c * c;
+
+    for (unsigned int r = 0; r < rows; ++r)
+    {
+        for (unsigned int c = 0; c < cols; ++c)
+        {
+            table_data[r * cols + c] = row_values[r] * col_values[c];
+        }
+    }
+
+    return mc::Table2<double,double,double>(row_values, col_values, table_data);
+}
+
+struct Queries
+{
+    std::vector<double> rows;
+    std::vector<double> cols;
+};
+
+Queries makeRandomQueries(unsigned int rows, unsigned int cols)
+{
+    std::mt19937 gen(2);
+    std::uniform_real_distribution<double> dist_row(-1.0, 0.5 * rows + 1.0);
+    std::uniform_real_distribution<double> dist_col(-1.0, 0.1 * cols * cols + 1.0);
+
+    Queries queries;
+    queries.rows.resize(kQueries);
+    queries.cols.resize(kQueries);
+
+    for (unsigned int i = 0; i < kQueries; ++i)
+    {
+        queries.rows[i] = dist_row(gen);
+        queries.cols[i] = dist_col(gen);
+    }
+
+    return queries;
+}
+
+void BM_Table2GetValueLoop(benchmark::State& state)
+{
+    const unsigned int rows = static_cast<unsigned int>(state.range(0));
+    const unsigned int cols = static_cast<unsigned int>(state.range(1));
+
+    mc::Table2<double,double,double> tab = makeTable(rows, cols);
+    Queries queries = makeRandomQueries(rows, cols);
+    std::vector<double> values(kQueries);
+
+    for (auto _ : state)
+    {
+        for (unsigned int i = 0; i < kQueries; ++i)
+        {
+            values[i] = tab.getValue(queries.rows[i], queries.cols[i]);
+        }
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kQueries);
+}
+
+void BM_Table2GetValueCursor(benchmark::State& state)
+{
+    const unsigned int rows = static_cast<unsigned int>(state.range(0));
+    const unsigned int cols = static_cast<unsigned int>(state.range(1));
+
+    mc::Table2<double,double,double> tab = makeTable(rows, cols);
+    std::vector<double> values(kQueries);
+
+    // slowly changing keys, as in the flight model step
+    Queries queries;
+    for (unsigned int i = 0; i < kQueries; ++i)
+    {
+        queries.rows.push_back(0.5 * rows * i / kQueries);
+        queries.cols.push_back(0.1 * cols * cols * i / kQueries);
+    }
+
+    mc::Table2Cursor cursor;
+
+    for (auto _ : state)
+    {
+        for (unsigned int i = 0; i < kQueries; ++i)
+        {
+            values[i] = tab.getValue(queries.rows[i], queries.cols[i], cursor);
+        }
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kQueries);
+}
+
+void BM_Table2GetValues(benchmark::State& state)
+{
+    const unsigned int rows = static_cast<unsigned int>(state.range(0));
+    const unsigned int cols = static_cast<unsigned int>(state.range(1));
+
+    mc::Table2<double,double,double> tab = makeTable(rows, cols);
+    Queries queries = makeRandomQueries(rows, cols);
+    std::vector<double> values(kQueries);
+
+    for (auto _ : state)
+    {
+        tab.getValues(queries.rows, queries.cols, values);
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kQueries);
+}
+
+void BM_Table2SetFromString(benchmark::State& state)
+{
+    const unsigned int rows = static_cast<unsigned int>(state.range(0));
+    const unsigned int cols = static_cast<unsigned int>(state.range(1));
+
+    const std::string str = makeTable(rows, cols).toString();
+
+    mc::Table2<double,double,double> tab;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(tab.setFromString(str.c_str()));
+    }
+
+    state.SetItemsProcessed(state.iterations() * (rows + 1) * (cols + 1));
+    state.SetBytesProcessed(state.iterations() * str.size());
+}
+
+} // namespace
+
+BENCHMARK(BM_Table2GetValueLoop)->Name("Table2/GetValues/ScalarLoop")->Args({10, 10})->Args({50, 40})->Args({200, 200});
+BENCHMARK(BM_Table2GetValues   )->Name("Table2/GetValues/Batch"     )->Args({10, 10})->Args({50, 40})->Args({200, 200});
+BENCHMARK(BM_Table2GetValueCursor)->Name("Table2/GetValue/Cursor/Sequential")->Args({10, 10})->Args({50, 40})->Args({200, 200});
+
+BENCHMARK(BM_Table2SetFromString)->Name("Table2/SetFromString")->Args({10, 10})->Args({50, 40})->Args({200, 200});
@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <mcutils/math/Table2.h>
+#include <mcutils/math/TableFile.h>
+
+namespace {
+
+constexpr unsigned int kTables = 2000;
+constexpr unsigned int kRows   = 50;
+constexpr unsigned int kCols   = 40;
+
+constexpr char kTempFile[] = "bench-temp.tab";
+
+mc::Table2<double,double,double> makeTable(unsigned int seed)
+{
+    std::vector<double> row_values(kRows);
+    std::vector<double> col_values(kCols);
+    std::vector<double> table_data(kRows * kCols);
+
+    for (unsigned int r = 0; r < kRows; ++r) row_values[r] = 0.5 * r;
+    for (unsigned int c = 0; c < kCols; ++c) col_values[c] = 0.1 * c * c;
+
+    for (unsigned int i = 0; i < kRows * kCols; ++i)
+    {
+        table_data[i] = 0.001 * ((i * 7919 + seed * 104729) % 100000);
+    }
+
+    return mc::Table2<double,double,double>(row_values, col_values, table_data);
+}
+
+// text representation of the tables, as stored in XML files
+void BM_TableLoadFromString(benchmark::State& state)
+{
+    std::vector<std::string> strings;
+    for (unsigned int i = 0; i < kTables; ++i)
+    {
+        strings.push_back(makeTable(i).toString());
+    }
+
+    for (auto _ : state)
+    {
+        std::vector<mc::Table2<double,double,double>> tables(kTables);
+
+        for (unsigned int i = 0; i < kTables; ++i)
+        {
+            tables[i].setFromString(strings[i].c_str());
+        }
+
+        benchmark::DoNotOptimize(tables.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * kTables);
+}
+
+void BM_TableLoadFromFile(benchmark::State& state)
+{
+    mc::TableFileWriter writer;
+    for (unsigned int i = 0; i < kTables; ++i)
+    {
+        writer.addTable("table_" + std::to_string(i), makeTable(i));
+    }
+    writer.writeFile(kTempFile);
+
+    for (auto _ : state)
+    {
+        mc::TableFile file(kTempFile);
+
+        std::vector<mc::Table2<double,double,double>> tables;
+        tables.reserve(kTables);
+
+        for (unsigned int i = 0; i < file.count(); ++i)
+        {
+            tables.push_back(file.getTable2<double,double,double>(i));
+        }
+
+        benchmark::DoNotOptimize(tables.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * kTables);
+
+    std::remove(kTempFile);
+}
+
+} // namespace
+
+BENCHMARK(BM_TableLoadFromString)->Name("TableFile/Load/FromString")->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TableLoadFromFile  )->Name("TableFile/Load/FromFile"  )->Unit(benchmark::kMillisecond);
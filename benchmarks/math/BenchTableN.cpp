@@ -0,0 +1,129 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <mcutils/math/Table2.h>
+#include <mcutils/math/TableN.h>
+
+namespace {
+
+constexpr unsigned int kQueries = 1024;
+constexpr unsigned int kSize0 = 20;
+constexpr unsigned int kSize1 = 30;
+constexpr unsigned int kSize2 = 15;
+
+std::vector<double> makeKeys(unsigned int size, double step)
+{
+    std::vector<double> keys(size);
+    for (unsigned int i = 0; i < size; ++i) keys[i] = step * i;
+    return keys;
+}
+
+double fun(double x, double y, double z)
+{
+    return x * y + z;
+}
+
+std::vector<double> makeRandomKeys(double key_max)
+{
+    std::mt19937 gen(2);
+    std::uniform_real_distribution<double> dist(0.0, key_max);
+
+    std::vector<double> keys(kQueries);
+    for (double& key : keys) key = dist(gen);
+    return keys;
+}
+
+// 3D lookup emulated with the set of Table2 objects, one per page
+void BM_Table2Chained(benchmark::State& state)
+{
+    std::vector<double> k0 = makeKeys(kSize0, 1.0);
+    std::vector<double> k1 = makeKeys(kSize1, 0.5);
+    std::vector<double> k2 = makeKeys(kSize2, 2.0);
+
+    std::vector<mc::Table2<double,double,double>> pages;
+    for (double z : k2)
+    {
+        std::vector<double> v;
+        for (double x : k0) for (double y : k1) v.push_back(fun(x, y, z));
+        pages.emplace_back(k0, k1, v);
+    }
+
+    std::vector<double> x = makeRandomKeys(k0.back());
+    std::vector<double> y = makeRandomKeys(k1.back());
+    std::vector<double> z = makeRandomKeys(k2.back());
+
+    for (auto _ : state)
+    {
+        for (unsigned int i = 0; i < kQueries; ++i)
+        {
+            std::vector<double> page_values;
+            for (const auto& page : pages) page_values.push_back(page.getValue(x[i], y[i]));
+            mc::Table<double,double> tab(k2, page_values);
+            benchmark::DoNotOptimize(tab.getValue(z[i]));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * kQueries);
+}
+
+void BM_Table3(benchmark::State& state)
+{
+    std::vector<double> k0 = makeKeys(kSize0, 1.0);
+    std::vector<double> k1 = makeKeys(kSize1, 0.5);
+    std::vector<double> k2 = makeKeys(kSize2, 2.0);
+
+    std::vector<double> v;
+    for (double x : k0) for (double y : k1) for (double z : k2) v.push_back(fun(x, y, z));
+
+    mc::Table3<double,double,double,double> tab(k0, k1, k2, v);
+
+    std::vector<double> x = makeRandomKeys(k0.back());
+    std::vector<double> y = makeRandomKeys(k1.back());
+    std::vector<double> z = makeRandomKeys(k2.back());
+
+    for (auto _ : state)
+    {
+        for (unsigned int i = 0; i < kQueries; ++i)
+        {
+            benchmark::DoNotOptimize(tab.getValue(x[i], y[i], z[i]));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * kQueries);
+}
+
+void BM_Table4(benchmark::State& state)
+{
+    std::vector<double> k0 = makeKeys(10, 1.0);
+    std::vector<double> k1 = makeKeys(10, 0.5);
+    std::vector<double> k2 = makeKeys(10, 2.0);
+    std::vector<double> k3 = makeKeys(10, 3.0);
+
+    std::vector<double> v;
+    for (double a : k0) for (double b : k1) for (double c : k2) for (double d : k3) v.push_back(a * b + c * d);
+
+    mc::TableN<double,double,double,double,double> tab(k0, k1, k2, k3, v);
+
+    std::vector<double> a = makeRandomKeys(k0.back());
+    std::vector<double> b = makeRandomKeys(k1.back());
+    std::vector<double> c = makeRandomKeys(k2.back());
+    std::vector<double> d = makeRandomKeys(k3.back());
+
+    for (auto _ : state)
+    {
+        for (unsigned int i = 0; i < kQueries; ++i)
+        {
+            benchmark::DoNotOptimize(tab.getValue(a[i], b[i], c[i], d[i]));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * kQueries);
+}
+
+} // namespace
+
+BENCHMARK(BM_Table2Chained)->Name("TableN/GetValue/3D/Table2Chained");
+BENCHMARK(BM_Table3       )->Name("TableN/GetValue/3D/Table3");
+BENCHMARK(BM_Table4       )->Name("TableN/GetValue/4D/TableN");
@@ -0,0 +1,192 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <mcutils/math/Angles.h>
+#include <mcutils/math/Quaternion.h>
+#include <mcutils/math/RotMatrix.h>
+#include <mcutils/math/TrigKernels.h>
+
+using namespace units::literals;
+
+namespace {
+
+std::vector<double> makeValues(size_t count, double min, double max, unsigned int seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(min, max);
+
+    std::vector<double> values(count);
+    for (double& v : values)
+    {
+        v = dist(gen);
+    }
+    return values;
+}
+
+void BM_SinCos_Libm(benchmark::State& state)
+{
+    const std::vector<double> x = makeValues(static_cast<size_t>(state.range(0)), -M_PI, M_PI, 1);
+    std::vector<double> s(x.size());
+    std::vector<double> c(x.size());
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            s[i] = std::sin(x[i]);
+            c[i] = std::cos(x[i]);
+        }
+        benchmark::DoNotOptimize(s.data());
+        benchmark::DoNotOptimize(c.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * x.size());
+}
+
+void BM_SinCos_Scalar(benchmark::State& state)
+{
+    const std::vector<double> x = makeValues(static_cast<size_t>(state.range(0)), -M_PI, M_PI, 1);
+    std::vector<double> s(x.size());
+    std::vector<double> c(x.size());
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            mc::math::sincos(x[i], &s[i], &c[i]);
+        }
+        benchmark::DoNotOptimize(s.data());
+        benchmark::DoNotOptimize(c.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * x.size());
+}
+
+void BM_SinCos_Batch(benchmark::State& state)
+{
+    const std::vector<double> x = makeValues(static_cast<size_t>(state.range(0)), -M_PI, M_PI, 1);
+    std::vector<double> s(x.size());
+    std::vector<double> c(x.size());
+
+    for (auto _ : state)
+    {
+        mc::math::sincos(x, s, c);
+        benchmark::DoNotOptimize(s.data());
+        benchmark::DoNotOptimize(c.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * x.size());
+}
+
+void BM_Atan2_Libm(benchmark::State& state)
+{
+    const std::vector<double> y = makeValues(static_cast<size_t>(state.range(0)), -1.0, 1.0, 1);
+    const std::vector<double> x = makeValues(static_cast<size_t>(state.range(0)), -1.0, 1.0, 2);
+    std::vector<double> result(x.size());
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            result[i] = std::atan2(y[i], x[i]);
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * x.size());
+}
+
+void BM_Atan2_Batch(benchmark::State& state)
+{
+    const std::vector<double> y = makeValues(static_cast<size_t>(state.range(0)), -1.0, 1.0, 1);
+    const std::vector<double> x = makeValues(static_cast<size_t>(state.range(0)), -1.0, 1.0, 2);
+    std::vector<double> result(x.size());
+
+    for (auto _ : state)
+    {
+        mc::math::atan2(y, x, result);
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * x.size());
+}
+
+// trigonometric part of the rotation constructors: three angles per call,
+// as done before the kernels were introduced
+void BM_EulerAngles_Libm(benchmark::State& state)
+{
+    const std::vector<double> a = makeValues(3, -M_PI, M_PI, 1);
+    double s[3];
+    double c[3];
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a.data());
+        for (size_t i = 0; i < 3; ++i)
+        {
+            s[i] = std::sin(a[i]);
+            c[i] = std::cos(a[i]);
+        }
+        benchmark::DoNotOptimize(s);
+        benchmark::DoNotOptimize(c);
+    }
+}
+
+void BM_EulerAngles_SinCos(benchmark::State& state)
+{
+    const std::vector<double> a = makeValues(3, -M_PI, M_PI, 1);
+    double s[3];
+    double c[3];
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a.data());
+        mc::math::sincos(a, s, c);
+        benchmark::DoNotOptimize(s);
+        benchmark::DoNotOptimize(c);
+    }
+}
+
+void BM_RotMatrix_FromAngles(benchmark::State& state)
+{
+    mc::Angles angles(0.1_rad, 0.2_rad, 0.3_rad);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(angles);
+        mc::RotMatrix m(angles);
+        benchmark::DoNotOptimize(m);
+    }
+}
+
+void BM_Quaternion_FromAngles(benchmark::State& state)
+{
+    mc::Angles angles(0.1_rad, 0.2_rad, 0.3_rad);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(angles);
+        mc::Quaternion q(angles);
+        benchmark::DoNotOptimize(q);
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_SinCos_Libm          )->Name("TrigKernels/SinCos/Libm"  )->Arg(64)->Arg(4096);
+BENCHMARK(BM_SinCos_Scalar        )->Name("TrigKernels/SinCos/Scalar")->Arg(64)->Arg(4096);
+BENCHMARK(BM_SinCos_Batch         )->Name("TrigKernels/SinCos/Batch" )->Arg(64)->Arg(4096);
+BENCHMARK(BM_Atan2_Libm           )->Name("TrigKernels/Atan2/Libm"   )->Arg(64)->Arg(4096);
+BENCHMARK(BM_Atan2_Batch          )->Name("TrigKernels/Atan2/Batch"  )->Arg(64)->Arg(4096);
+BENCHMARK(BM_EulerAngles_Libm     )->Name("TrigKernels/EulerAngles/Libm");
+BENCHMARK(BM_EulerAngles_SinCos   )->Name("TrigKernels/EulerAngles/SinCos");
+BENCHMARK(BM_RotMatrix_FromAngles )->Name("TrigKernels/RotMatrix/FromAngles");
+BENCHMARK(BM_Quaternion_FromAngles)->Name("TrigKernels/Quaternion/FromAngles");
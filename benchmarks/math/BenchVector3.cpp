@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <mcutils/math/Vector.h>
+
+namespace {
+
+std::vector<mc::Vector3d> makeVectors(size_t count)
+{
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    std::vector<mc::Vector3d> vectors(count);
+    for (mc::Vector3d& v : vectors)
+    {
+        v = mc::Vector3d(dist(gen), dist(gen), dist(gen));
+    }
+    return vectors;
+}
+
+void BM_Vector3dCopy(benchmark::State& state)
+{
+    const std::vector<mc::Vector3d> src = makeVectors(static_cast<size_t>(state.range(0)));
+    std::vector<mc::Vector3d> dst(src.size());
+
+    for (auto _ : state)
+    {
+        std::copy(src.begin(), src.end(), dst.begin());
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * src.size() * sizeof(mc::Vector3d));
+    state.counters["sizeof"] = sizeof(mc::Vector3d);
+}
+
+void BM_Vector3dSum(benchmark::State& state)
+{
+    const std::vector<mc::Vector3d> vectors = makeVectors(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        mc::Vector3d sum;
+        for (const mc::Vector3d& v : vectors)
+        {
+            sum += v;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * vectors.size());
+}
+
+void BM_Vector3dCrossProduct(benchmark::State& state)
+{
+    const std::vector<mc::Vector3d> lhs = makeVectors(static_cast<size_t>(state.range(0)));
+    const std::vector<mc::Vector3d> rhs = makeVectors(static_cast<size_t>(state.range(0)));
+    std::vector<mc::Vector3d> result(lhs.size());
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < lhs.size(); ++i)
+        {
+            result[i] = lhs[i] % rhs[i];
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * lhs.size());
+}
+
+} // namespace
+
+BENCHMARK(BM_Vector3dCopy        )->Name("Vector3d/Copy"        )->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_Vector3dSum         )->Name("Vector3d/Sum"         )->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_Vector3dCrossProduct)->Name("Vector3d/CrossProduct")->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
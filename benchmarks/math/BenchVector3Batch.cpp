@@ -0,0 +1,209 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <mcutils/math/Vector3Batch.h>
+
+using namespace units::literals;
+
+namespace {
+
+std::vector<mc::Vector3d> makeVectors(size_t count, unsigned int seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    std::vector<mc::Vector3d> vectors(count);
+    for (mc::Vector3d& v : vectors)
+    {
+        v = mc::Vector3d(dist(gen), dist(gen), dist(gen));
+    }
+    return vectors;
+}
+
+const mc::RotMatrix kRotMatrix(mc::Angles(0.1_rad, 0.2_rad, 0.3_rad));
+
+void BM_AoSAddScaled(benchmark::State& state)
+{
+    const std::vector<mc::Vector3d> vel = makeVectors(static_cast<size_t>(state.range(0)), 1);
+    std::vector<mc::Vector3d> pos = makeVectors(static_cast<size_t>(state.range(0)), 2);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < pos.size(); ++i)
+        {
+            pos[i] += vel[i] * 0.01;
+        }
+        benchmark::DoNotOptimize(pos.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * pos.size());
+}
+
+void BM_SoAAddScaled(benchmark::State& state)
+{
+    const mc::Vector3Batch<double> vel(makeVectors(static_cast<size_t>(state.range(0)), 1));
+    mc::Vector3Batch<double> pos(makeVectors(static_cast<size_t>(state.range(0)), 2));
+    mc::Vector3Batch<double> temp;
+
+    for (auto _ : state)
+    {
+        mc::multiplyBatchByScalar(vel, 0.01, &temp);
+        pos += temp;
+        benchmark::DoNotOptimize(pos.x());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * pos.size());
+}
+
+void BM_AoSCrossProduct(benchmark::State& state)
+{
+    const std::vector<mc::Vector3d> lhs = makeVectors(static_cast<size_t>(state.range(0)), 1);
+    const std::vector<mc::Vector3d> rhs = makeVectors(static_cast<size_t>(state.range(0)), 2);
+    std::vector<mc::Vector3d> result(lhs.size());
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < lhs.size(); ++i)
+        {
+            result[i] = lhs[i] % rhs[i];
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * lhs.size());
+}
+
+void BM_SoACrossProduct(benchmark::State& state)
+{
+    const mc::Vector3Batch<double> lhs(makeVectors(static_cast<size_t>(state.range(0)), 1));
+    const mc::Vector3Batch<double> rhs(makeVectors(static_cast<size_t>(state.range(0)), 2));
+    mc::Vector3Batch<double> result(lhs.size());
+
+    for (auto _ : state)
+    {
+        mc::calculateCrossProducts(lhs, rhs, &result);
+        benchmark::DoNotOptimize(result.x());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * lhs.size());
+}
+
+void BM_AoSDotProduct(benchmark::State& state)
+{
+    const std::vector<mc::Vector3d> lhs = makeVectors(static_cast<size_t>(state.range(0)), 1);
+    const std::vector<mc::Vector3d> rhs = makeVectors(static_cast<size_t>(state.range(0)), 2);
+    std::vector<double> result(lhs.size());
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < lhs.size(); ++i)
+        {
+            result[i] = lhs[i] * rhs[i];
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * lhs.size());
+}
+
+void BM_SoADotProduct(benchmark::State& state)
+{
+    const mc::Vector3Batch<double> lhs(makeVectors(static_cast<size_t>(state.range(0)), 1));
+    const mc::Vector3Batch<double> rhs(makeVectors(static_cast<size_t>(state.range(0)), 2));
+    std::vector<double> result(lhs.size());
+
+    for (auto _ : state)
+    {
+        mc::calculateDotProducts(lhs, rhs, result.data());
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * lhs.size());
+}
+
+void BM_AoSNormalize(benchmark::State& state)
+{
+    const std::vector<mc::Vector3d> src = makeVectors(static_cast<size_t>(state.range(0)), 1);
+    std::vector<mc::Vector3d> result(src.size());
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < src.size(); ++i)
+        {
+            result[i] = src[i].getNormalized();
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+void BM_SoANormalize(benchmark::State& state)
+{
+    const mc::Vector3Batch<double> src(makeVectors(static_cast<size_t>(state.range(0)), 1));
+    mc::Vector3Batch<double> result(src.size());
+
+    for (auto _ : state)
+    {
+        mc::calculateNormalized(src, &result);
+        benchmark::DoNotOptimize(result.x());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+void BM_AoSRotate(benchmark::State& state)
+{
+    const std::vector<mc::Vector3d> src = makeVectors(static_cast<size_t>(state.range(0)), 1);
+    std::vector<mc::Vector3d> result(src.size());
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < src.size(); ++i)
+        {
+            result[i] = kRotMatrix * src[i];
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+void BM_SoARotate(benchmark::State& state)
+{
+    const mc::Vector3Batch<double> src(makeVectors(static_cast<size_t>(state.range(0)), 1));
+    mc::Vector3Batch<double> result(src.size());
+
+    for (auto _ : state)
+    {
+        mc::multiplyMatrixByBatch(kRotMatrix, src, &result);
+        benchmark::DoNotOptimize(result.x());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+} // namespace
+
+BENCHMARK(BM_AoSAddScaled   )->Name("Vector3Batch/AddScaled/AoS"   )->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_SoAAddScaled   )->Name("Vector3Batch/AddScaled/SoA"   )->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_AoSCrossProduct)->Name("Vector3Batch/CrossProduct/AoS")->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_SoACrossProduct)->Name("Vector3Batch/CrossProduct/SoA")->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_AoSDotProduct  )->Name("Vector3Batch/DotProduct/AoS"  )->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_SoADotProduct  )->Name("Vector3Batch/DotProduct/SoA"  )->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_AoSNormalize   )->Name("Vector3Batch/Normalize/AoS"   )->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_SoANormalize   )->Name("Vector3Batch/Normalize/SoA"   )->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_AoSRotate      )->Name("Vector3Batch/Rotate/AoS"      )->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_SoARotate      )->Name("Vector3Batch/Rotate/SoA"      )->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
@@ -0,0 +1,430 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_GEO_CART2GEO_H_
+#define MCUTILS_GEO_CART2GEO_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <span>
+
+#include <units.h>
+
+#include <mcutils/geo/Ellipsoid.h>
+#include <mcutils/geo/Geo.h>
+
+#include <mcutils/math/MathUtils.h>
+#include <mcutils/math/Vector.h>
+
+namespace mc {
+
+/**
+ * \brief Zhu's closed form cartesian to geodetic coordinates conversion method.
+ *
+ * Exact solution, valid everywhere except for the vicinity of the Earth's
+ * center. Requires a cube root and six square roots.
+ *
+ * ### References:
+ * - Zhu J.: Conversion of Earth-centered Earth-fixed coordinates to geodetic coordinates, 1994
+ */
+class Cart2GeoZhu
+{
+public:
+
+    /**
+     * \brief Constructor.
+     * \param ellipsoid datum ellipsoid
+     */
+    explicit Cart2GeoZhu(const Ellipsoid& ellipsoid)
+        : _a   (ellipsoid.a()())
+        , _a2  (ellipsoid.a2()())
+        , _b2  (ellipsoid.b2()())
+        , _e2  (ellipsoid.e2())
+        , _ep2 (ellipsoid.ep2())
+    {}
+
+    /**
+     * \brief Calculates altitude and latitude as the arc tangent of lat_y/lat_x.
+     * Allows the arc tangents to be evaluated separately, e.g. for many points at once.
+     * \param x [m] cartesian x-coordinate
+     * \param y [m] cartesian y-coordinate
+     * \param z [m] cartesian z-coordinate
+     * \param lat_y [m] resulting latitude tangent numerator pointer
+     * \param lat_x [m] resulting latitude tangent denominator pointer, never negative
+     * \param alt [m] resulting altitude above mean sea level pointer
+     */
+    inline void calculate(double x, double y, double z,
+                          double* lat_y, double* lat_x, double* alt) const
+    {
+        double z2 = z*z;
+        double r  = std::sqrt(x*x + y*y);
+        double r2 = r*r;
+        double e2_lin = _a2 - _b2;
+        double f  = 54.0 * _b2 * z2;
+        double g  = r2 + (1.0 - _e2)*z2 - _e2*e2_lin;
+        double c  = _e2*_e2 * f * r2 / math::npow<3>(g);
+        double s  = std::cbrt(1.0 + c + std::sqrt(c*c + 2.0*c));
+        double p0 = s + 1.0/s + 1.0;
+        double p  = f / (3.0 * p0*p0 * g*g);
+        double q  = std::sqrt(1.0 + 2.0*(_e2*_e2)*p);
+        // square root argument is clamped, as close to the poles
+        // it might become slightly negative due to rounding errors
+        double r0 = -(p * _e2 * r)/(1.0 + q)
+                    + std::sqrt(std::max(0.0,
+                        0.5*_a2*(1.0 + 1.0/q)
+                        - p*(1.0 - _e2)*z2/(q + q*q) - 0.5*p*r2
+                    ));
+        double uv = r - _e2*r0;
+        double u  = std::sqrt(uv*uv + z2);
+        double v  = std::sqrt(uv*uv + (1.0 - _e2)*z2);
+        double z0 = _b2 * z / (_a * v);
+
+        *alt = u * (1.0 - _b2 / (_a * v));
+        *lat_y = z + _ep2*z0;
+        *lat_x = r;
+    }
+
+    /**
+     * \brief Converts cartesian coordinates into geodetic coordinates.
+     * \param x [m] cartesian x-coordinate
+     * \param y [m] cartesian y-coordinate
+     * \param z [m] cartesian z-coordinate
+     * \param lat [rad] resulting geodetic latitude pointer
+     * \param lon [rad] resulting geodetic longitude pointer
+     * \param alt [m] resulting altitude above mean sea level pointer
+     */
+    inline void convert(double x, double y, double z,
+                        double* lat, double* lon, double* alt) const
+    {
+        double lat_y = 0.0;
+        double lat_x = 0.0;
+        calculate(x, y, z, &lat_y, &lat_x, alt);
+
+        *lat = std::atan(lat_y/lat_x);
+        *lon = std::atan2(y, x);
+    }
+
+private:
+
+    double _a;      ///< [m] equatorial radius
+    double _a2;     ///< [m^2] equatorial radius squared
+    double _b2;     ///< [m^2] polar radius squared
+    double _e2;     ///< [-] first eccentricity squared
+    double _ep2;    ///< [-] second eccentricity squared
+};
+
+/**
+ * \brief Bowring's iterative cartesian to geodetic coordinates conversion method.
+ *
+ * Single iteration gives centimeter accuracy for altitudes from -1000 km
+ * to 36000 km, two iterations are accurate to the double precision in this
+ * range. Each next iteration costs two arc tangents, two sines and two cosines.
+ *
+ * \tparam ITERATIONS number of iterations
+ *
+ * ### References:
+ * - Bowring B.: Transformation from spatial to geocentric coordinates, 1976
+ * - Burtch R.: A Comparison of Methods Used in Rectangular to Geodetic Coordinate Transformations, 2006
+ */
+template <unsigned int ITERATIONS = 1>
+class Cart2GeoBowring
+{
+    static_assert(ITERATIONS > 0, "At least one iteration is required");
+
+public:
+
+    /**
+     * \brief Constructor.
+     * \param ellipsoid datum ellipsoid
+     */
+    explicit Cart2GeoBowring(const Ellipsoid& ellipsoid)
+        : _a   (ellipsoid.a()())
+        , _b   (ellipsoid.b()())
+        , _e2  (ellipsoid.e2())
+        , _ed2 ((ellipsoid.a2()() - ellipsoid.b2()()) / ellipsoid.b2()())
+    {}
+
+    /**
+     * \brief Converts cartesian coordinates into geodetic coordinates.
+     * \param x [m] cartesian x-coordinate
+     * \param y [m] cartesian y-coordinate
+     * \param z [m] cartesian z-coordinate
+     * \param lat [rad] resulting geodetic latitude pointer
+     * \param lon [rad] resulting geodetic longitude pointer
+     * \param alt [m] resulting altitude above mean sea level pointer
+     */
+    inline void convert(double x, double y, double z,
+                        double* lat, double* lon, double* alt) const
+    {
+        double p   = std::sqrt(x*x + y*y);
+        double tht = std::atan2(z*_a, p*_b);
+        double phi = 0.0;
+
+        for ( unsigned int i = 0; i < ITERATIONS; ++i )
+        {
+            // parametric latitude of the previous geodetic latitude estimate
+            if ( i > 0 ) tht = std::atan2(_b*std::sin(phi), _a*std::cos(phi));
+
+            double sinTht = std::sin(tht);
+            double cosTht = std::cos(tht);
+
+            phi = std::atan2(
+                z + _b*_ed2*math::npow<3>(sinTht),
+                p - _e2*_a*math::npow<3>(cosTht)
+            );
+        }
+
+        double sinPhi = std::sin(phi);
+        double cosPhi = std::cos(phi);
+
+        // a^2/N instead of p/cos(phi) - N, which loses accuracy close to the poles
+        *lat = phi;
+        *lon = std::atan2(y, x);
+        *alt = p*cosPhi + z*sinPhi - _a*std::sqrt(1.0 - _e2*sinPhi*sinPhi);
+    }
+
+private:
+
+    double _a;      ///< [m] equatorial radius
+    double _b;      ///< [m] polar radius
+    double _e2;     ///< [-] first eccentricity squared
+    double _ed2;    ///< [-] second eccentricity squared
+};
+
+/**
+ * \brief Olson's cartesian to geodetic coordinates conversion method.
+ *
+ * Series approximation of the latitude followed by a single Newton-Raphson
+ * like correction. Requires an arc sine or arc cosine and four square roots,
+ * no cube roots. Not valid in the vicinity of the Earth's center.
+ *
+ * ### References:
+ * - Olson D.: Converting Earth-centered, Earth-fixed coordinates to geodetic coordinates, 1996
+ */
+class Cart2GeoOlson
+{
+public:
+
+    /**
+     * \brief Constructor.
+     * \param ellipsoid datum ellipsoid
+     */
+    explicit Cart2GeoOlson(const Ellipsoid& ellipsoid)
+        : _a  (ellipsoid.a()())
+        , _e2 (ellipsoid.e2())
+        , _a1 (_a * _e2)
+        , _a2 (_a1 * _a1)
+        , _a3 (0.5 * _a1 * _e2)
+        , _a4 (2.5 * _a2)
+        , _a5 (_a1 + _a3)
+        , _a6 (1.0 - _e2)
+    {}
+
+    /**
+     * \brief Converts cartesian coordinates into geodetic coordinates.
+     * \param x [m] cartesian x-coordinate
+     * \param y [m] cartesian y-coordinate
+     * \param z [m] cartesian z-coordinate
+     * \param lat [rad] resulting geodetic latitude pointer
+     * \param lon [rad] resulting geodetic longitude pointer
+     * \param alt [m] resulting altitude above mean sea level pointer
+     */
+    inline void convert(double x, double y, double z,
+                        double* lat, double* lon, double* alt) const
+    {
+        double zp = std::fabs(z);
+        double w2 = x*x + y*y;
+        double w  = std::sqrt(w2);
+        double r2 = w2 + z*z;
+        double r  = std::sqrt(r2);
+        double s2 = z*z / r2;
+        double c2 = w2 / r2;
+        double u  = _a2 / r;
+        double v  = _a3 - _a4 / r;
+
+        double phi = 0.0;
+        double s = 0.0;
+        double c = 0.0;
+        double ss = 0.0;
+
+        // arc sine or arc cosine, whichever is better conditioned
+        if ( c2 > 0.3 )
+        {
+            s = (zp / r) * (1.0 + c2*(_a1 + u + s2*v) / r);
+            phi = std::asin(s);
+            ss = s*s;
+            c = std::sqrt(1.0 - ss);
+        }
+        else
+        {
+            c = (w / r) * (1.0 - s2*(_a5 - u - c2*v) / r);
+            phi = std::acos(c);
+            ss = 1.0 - c*c;
+            s = std::sqrt(ss);
+        }
+
+        double g  = 1.0 - _e2*ss;
+        double rg = _a / std::sqrt(g);
+        double rf = _a6 * rg;
+        u = w  - rg*c;
+        v = zp - rf*s;
+        double f = c*u + s*v;
+        double m = c*v - s*u;
+        double p = m / (rf/g + f);
+
+        *lat = std::copysign(phi + p, z);
+        *lon = std::atan2(y, x);
+        *alt = f + 0.5*m*p;
+    }
+
+private:
+
+    double _a;      ///< [m] equatorial radius
+    double _e2;     ///< [-] first eccentricity squared
+    double _a1;     ///< [m] a*e^2
+    double _a2;     ///< [m^2] (a*e^2)^2
+    double _a3;     ///< [m] a*e^4/2
+    double _a4;     ///< [m^2] 5/2 (a*e^2)^2
+    double _a5;     ///< [m] a*e^2 + a*e^4/2
+    double _a6;     ///< [-] 1 - e^2
+};
+
+/**
+ * \brief Cartesian to geodetic coordinates converter.
+ *
+ * Conversion method is selected at compile time, so hot paths can use
+ * the cheapest method that meets their accuracy requirements.<br/>
+ *
+ * Maximum latitude errors [rad] for the WGS84 ellipsoid, points spread
+ * over all latitudes, with respect to the long double precision reference:
+ *
+ * | Altitude   | Cart2GeoZhu | Cart2GeoBowring<1> | Cart2GeoBowring<2> | Cart2GeoOlson |
+ * |-----------:|------------:|-------------------:|-------------------:|--------------:|
+ * | -5000 km   | 3.2e-16     | 3.5e-06            | 2.9e-13            | 1.3e-12       |
+ * | -1000 km   | 2.4e-16     | 2.3e-09            | 2.4e-16            | 3.4e-16       |
+ * | -100 km    | 2.5e-16     | 1.5e-11            | 2.3e-16            | 2.9e-16       |
+ * | -10 km     | 2.4e-16     | 1.4e-13            | 2.3e-16            | 3.4e-16       |
+ * | 0 km       | 2.7e-16     | 2.7e-16            | 2.7e-16            | 3.6e-16       |
+ * | 10 km      | 2.8e-16     | 1.4e-13            | 2.3e-16            | 3.3e-16       |
+ * | 100 km     | 2.8e-16     | 1.3e-11            | 2.7e-16            | 3.2e-16       |
+ * | 1000 km    | 2.2e-16     | 9.0e-10            | 2.1e-16            | 2.9e-16       |
+ * | 10000 km   | 2.3e-16     | 8.3e-09            | 2.4e-16            | 2.8e-16       |
+ * | 36000 km   | 2.6e-16     | 6.2e-09            | 2.3e-16            | 3.2e-16       |
+ * | 400000 km  | 2.5e-16     | 8.6e-10            | 2.5e-16            | 3.4e-16       |
+ * | Rel. time  | 1.0         | 1.1                | 1.8                | 0.4           |
+ *
+ * 1e-9 rad is about 6 mm on the Earth's surface. Altitude errors of all
+ * the methods are below 4e-9 m from -1000 km to 1000 km, below 2e-8 m
+ * at 36000 km and below 2e-7 m at 400000 km (rounding errors
+ * of the coordinates). Relative time is measured by the Cart2Geo
+ * benchmark (GCC, -O2, x86-64).
+ *
+ * \tparam METHOD conversion method, e.g. Cart2GeoZhu, Cart2GeoBowring or Cart2GeoOlson
+ */
+template <class METHOD = Cart2GeoZhu>
+class Cart2Geo
+{
+public:
+
+    /**
+     * \brief Constructor.
+     * \param ellipsoid datum ellipsoid
+     */
+    explicit Cart2Geo(const Ellipsoid& ellipsoid)
+        : _method(ellipsoid)
+    {}
+
+    /**
+     * \brief Converts cartesian coordinates into geodetic coordinates.
+     * \param x [m] cartesian x-coordinate
+     * \param y [m] cartesian y-coordinate
+     * \param z [m] cartesian z-coordinate
+     * \param lat [rad] resulting geodetic latitude pointer
+     * \param lon [rad] resulting geodetic longitude pointer
+     * \param alt [m] resulting altitude above mean sea level pointer
+     */
+    inline void convert(units::length::meter_t x,
+                        units::length::meter_t y,
+                        units::length::meter_t z,
+                        units::angle::radian_t* lat,
+                        units::angle::radian_t* lon,
+                        units::length::meter_t* alt) const
+    {
+        double lat_rad = 0.0;
+        double lon_rad = 0.0;
+        double alt_m = 0.0;
+        _method.convert(x(), y(), z(), &lat_rad, &lon_rad, &alt_m);
+
+        *lat = units::angle::radian_t(lat_rad);
+        *lon = units::angle::radian_t(lon_rad);
+        *alt = units::length::meter_t(alt_m);
+    }
+
+    /**
+     * \brief Converts cartesian coordinates into geodetic coordinates.
+     * \param pos_cart [m] cartesian coordinates vector
+     * \return resulting geodetic coordinates
+     */
+    inline Geo convert(const Vector3_m& pos_cart) const
+    {
+        Geo pos_geo;
+        convert(pos_cart.x(), pos_cart.y(), pos_cart.z(), &pos_geo.lat, &pos_geo.lon, &pos_geo.alt);
+        return pos_geo;
+    }
+
+    /**
+     * \brief Converts cartesian coordinates into geodetic coordinates.
+     * \param x [m] cartesian x-coordinates
+     * \param y [m] cartesian y-coordinates
+     * \param z [m] cartesian z-coordinates
+     * \param lat [rad] resulting geodetic latitudes, size should match input size
+     * \param lon [rad] resulting geodetic longitudes, size should match input size
+     * \param alt [m] resulting altitudes above mean sea level, size should match input size
+     */
+    void convert(std::span<const units::length::meter_t> x,
+                 std::span<const units::length::meter_t> y,
+                 std::span<const units::length::meter_t> z,
+                 std::span<units::angle::radian_t> lat,
+                 std::span<units::angle::radian_t> lon,
+                 std::span<units::length::meter_t> alt) const
+    {
+        assert(x.size() == y.size() && x.size() == z.size());
+        assert(x.size() == lat.size() && x.size() == lon.size() && x.size() == alt.size());
+
+        const size_t count = std::min({ x.size(), y.size(), z.size(), lat.size(), lon.size(), alt.size() });
+
+        for ( size_t i = 0; i < count; ++i )
+        {
+            convert(x[i], y[i], z[i], &lat[i], &lon[i], &alt[i]);
+        }
+    }
+
+    inline const METHOD& method() const { return _method; }
+
+private:
+
+    METHOD _method;     ///< conversion method
+};
+
+} // namespace mc
+
+#endif // MCUTILS_GEO_CART2GEO_H_
@@ -22,6 +22,7 @@
 #ifndef MCUTILS_GEO_ECEF_H_
 #define MCUTILS_GEO_ECEF_H_
 
+#include <span>
 #include <utility>
 
 #include <units.h>
@@ -124,7 +125,7 @@ public:
     /**
      * \brief Converts cartesian coordinates into geodetic coordinates.
      *
-     * This method is fast but less precise, it provides 1cm accuracy for height less than 1000km
+     * Bowring's single iteration method, see Cart2Geo for its accuracy over altitude range.
      *
      * \param x [m] cartesian x-coordinate
      * \param y [m] cartesian y-coordinate
@@ -154,7 +155,7 @@ public:
     /**
      * \brief Converts cartesian coordinates into geodetic coordinates.
      *
-     * This method is fast but less precise, it provides 1cm accuracy for height less than 1000km
+     * Bowring's single iteration method, see Cart2Geo for its accuracy over altitude range.
      *
      * \param x [m] cartesian x-coordinate
      * \param y [m] cartesian y-coordinate
@@ -178,7 +179,7 @@ public:
     /**
      * \brief Converts cartesian coordinates into geodetic coordinates.
      *
-     * This method is fast but less precise, it provides 1cm accuracy for height less than 1000km
+     * Bowring's single iteration method, see Cart2Geo for its accuracy over altitude range.
      *
      * \param pos_cart [m] cartesian coordinates vector
      * \return resulting geodetic coordinates
@@ -188,6 +189,81 @@ public:
         return convertCart2GeoFast(pos_cart.x(), pos_cart.y(), pos_cart.z());
     }
 
+    /**
+     * \brief Converts geodetic coordinates into cartesian coordinates.
+     *
+     * Batch version of convertGeo2Cart(). Coordinates are passed as structure
+     * of arrays. Points are processed in blocks: sines and cosines of all the
+     * points in a block are evaluated first, then the remaining arithmetic
+     * runs over plain double arrays. Large batches can be split into
+     * contiguous parts converted by separate threads.
+     *
+     * \param lat [rad] geodetic latitudes
+     * \param lon [rad] geodetic longitudes
+     * \param alt [m] altitudes above mean sea level
+     * \param x [m] resulting cartesian x-coordinates, size should match input size
+     * \param y [m] resulting cartesian y-coordinates, size should match input size
+     * \param z [m] resulting cartesian z-coordinates, size should match input size
+     * \param threads number of threads
+     */
+    void convertGeo2Cart(std::span<const units::angle::radian_t> lat,
+                         std::span<const units::angle::radian_t> lon,
+                         std::span<const units::length::meter_t> alt,
+                         std::span<units::length::meter_t> x,
+                         std::span<units::length::meter_t> y,
+                         std::span<units::length::meter_t> z,
+                         unsigned int threads = 1) const;
+
+    /**
+     * \brief Converts cartesian coordinates into geodetic coordinates.
+     *
+     * Batch version of convertCart2Geo(). Vectorized trigonometric functions
+     * are used, so results are not bitwise identical to the single point
+     * version, but differ only by a few ULP, i.e. less than 1.0e-14 rad
+     * in latitude and longitude and about 1.0e-8 m in altitude. Large
+     * batches can be split into contiguous parts converted by separate threads.
+     *
+     * \param x [m] cartesian x-coordinates
+     * \param y [m] cartesian y-coordinates
+     * \param z [m] cartesian z-coordinates
+     * \param lat [rad] resulting geodetic latitudes, size should match input size
+     * \param lon [rad] resulting geodetic longitudes, size should match input size
+     * \param alt [m] resulting altitudes above mean sea level, size should match input size
+     * \param threads number of threads
+     */
+    void convertCart2Geo(std::span<const units::length::meter_t> x,
+                         std::span<const units::length::meter_t> y,
+                         std::span<const units::length::meter_t> z,
+                         std::span<units::angle::radian_t> lat,
+                         std::span<units::angle::radian_t> lon,
+                         std::span<units::length::meter_t> alt,
+                         unsigned int threads = 1) const;
+
+    /**
+     * \brief Converts cartesian coordinates into geodetic coordinates.
+     *
+     * Batch version of convertCart2GeoFast(). Vectorized trigonometric functions
+     * are used, so results are not bitwise identical to the single point
+     * version, but differ only by a few ULP, i.e. less than 1.0e-14 rad
+     * in latitude and longitude and about 1.0e-8 m in altitude. Large
+     * batches can be split into contiguous parts converted by separate threads.
+     *
+     * \param x [m] cartesian x-coordinates
+     * \param y [m] cartesian y-coordinates
+     * \param z [m] cartesian z-coordinates
+     * \param lat [rad] resulting geodetic latitudes, size should match input size
+     * \param lon [rad] resulting geodetic longitudes, size should match input size
+     * \param alt [m] resulting altitudes above mean sea level, size should match input size
+     * \param threads number of threads
+     */
+    void convertCart2GeoFast(std::span<const units::length::meter_t> x,
+                             std::span<const units::length::meter_t> y,
+                             std::span<const units::length::meter_t> z,
+                             std::span<units::angle::radian_t> lat,
+                             std::span<units::angle::radian_t> lon,
+                             std::span<units::length::meter_t> alt,
+                             unsigned int threads = 1) const;
+
     /**
      * \brief Calculates coordinates moved by the given offset.
      * \param heading [rad] heading
@@ -0,0 +1,272 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_GEO_GEODESIC_H_
+#define MCUTILS_GEO_GEODESIC_H_
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <units.h>
+
+#include <mcutils/mcutils_api.h>
+#include <mcutils/Result.h>
+
+#include <mcutils/geo/Ellipsoid.h>
+#include <mcutils/geo/Geo.h>
+
+namespace mc {
+
+/**
+ * \brief Geodesic distance calculation method enum.
+ */
+enum class GeodesicMode : uint8_t
+{
+    Ellipsoidal = 0x0,  ///< Vincenty's inverse formula, sub-millimeter accuracy
+    Spherical   = 0x1   ///< haversine formula on the mean radius sphere, see Geodesic::sphericalRatioMin()
+};
+
+/**
+ * \brief Geodesic problems solver class.
+ *
+ * This class solves direct (position given initial azimuth and distance)
+ * and inverse (distance and azimuths between two positions) geodesic
+ * problems on the ellipsoid. Ellipsoid dependent coefficients are computed
+ * once in the constructor.<br/>
+ *
+ * Vincenty's inverse formula doesn't converge for nearly antipodal points,
+ * in such a case solveInverse() finds the azimuth at the first point by
+ * bisection in Karney's canonical configuration, evaluating the longitude
+ * difference and distance with the same Vincenty's series.<br/>
+ *
+ * Spherical (haversine) distance d_sph on the mean radius sphere bounds
+ * the ellipsoidal distance d, as ratio of ellipsoid to sphere line elements
+ * is bounded by the meridian and prime vertical radii of curvature:
+ * sphericalRatioMin() * d_sph <= d <= sphericalRatioMax() * d_sph.
+ * For WGS84 the ratio is between 0.9944 and 1.0045. It allows to cull
+ * most of the points cheaply, see findWithinDistance().
+ *
+ * ### References:
+ * - Vincenty T.: Direct and Inverse Solutions of Geodesics on the Ellipsoid with Application of Nested Equations, 1975
+ * - Karney C.F.F.: Algorithms for geodesics, 2013
+ * - [Vincenty's formulae - Wikipedia](https://en.wikipedia.org/wiki/Vincenty%27s_formulae)
+ * - [Haversine formula - Wikipedia](https://en.wikipedia.org/wiki/Haversine_formula)
+ */
+class MCUTILS_API Geodesic
+{
+public:
+
+    /**
+     * \brief Constructor.
+     * \param ellipsoid datum ellipsoid
+     * \param max_iterations maximum number of iterations
+     * \param tolerance [rad] angular convergence tolerance, 1e-12 rad is about 6e-6 m
+     */
+    explicit Geodesic(const Ellipsoid& ellipsoid,
+                      unsigned int max_iterations = 200,
+                      double tolerance = 1.0e-12);
+
+    /**
+     * \brief Solves inverse geodesic problem.
+     * \param lat_1 [rad] geodetic latitude of the first point
+     * \param lon_1 [rad] geodetic longitude of the first point
+     * \param lat_2 [rad] geodetic latitude of the second point
+     * \param lon_2 [rad] geodetic longitude of the second point
+     * \param distance [m] resulting distance pointer
+     * \param azimuth_1 [rad] resulting azimuth at the first point pointer (may be nullptr)
+     * \param azimuth_2 [rad] resulting azimuth at the second point pointer (may be nullptr)
+     * \return mc::Result::Success on success, mc::Result::Failure if not converged,
+     * in such a case distance and azimuths are NaN
+     */
+    Result solveInverse(units::angle::radian_t lat_1,
+                        units::angle::radian_t lon_1,
+                        units::angle::radian_t lat_2,
+                        units::angle::radian_t lon_2,
+                        units::length::meter_t* distance,
+                        units::angle::radian_t* azimuth_1 = nullptr,
+                        units::angle::radian_t* azimuth_2 = nullptr) const;
+
+    /**
+     * \brief Solves inverse geodesic problem.
+     * \param pos_1 first point geodetic coordinates, altitude is ignored
+     * \param pos_2 second point geodetic coordinates, altitude is ignored
+     * \param distance [m] resulting distance pointer
+     * \param azimuth_1 [rad] resulting azimuth at the first point pointer (may be nullptr)
+     * \param azimuth_2 [rad] resulting azimuth at the second point pointer (may be nullptr)
+     * \return mc::Result::Success on success, mc::Result::Failure if not converged,
+     * in such a case distance and azimuths are NaN
+     */
+    inline Result solveInverse(const Geo& pos_1, const Geo& pos_2,
+                               units::length::meter_t* distance,
+                               units::angle::radian_t* azimuth_1 = nullptr,
+                               units::angle::radian_t* azimuth_2 = nullptr) const
+    {
+        return solveInverse(pos_1.lat, pos_1.lon, pos_2.lat, pos_2.lon, distance, azimuth_1, azimuth_2);
+    }
+
+    /**
+     * \brief Solves direct geodesic problem.
+     * \param lat_1 [rad] geodetic latitude of the first point
+     * \param lon_1 [rad] geodetic longitude of the first point
+     * \param azimuth_1 [rad] azimuth at the first point
+     * \param distance [m] distance
+     * \param lat_2 [rad] resulting geodetic latitude of the second point pointer
+     * \param lon_2 [rad] resulting geodetic longitude of the second point pointer
+     * \param azimuth_2 [rad] resulting azimuth at the second point pointer (may be nullptr)
+     */
+    void solveDirect(units::angle::radian_t lat_1,
+                     units::angle::radian_t lon_1,
+                     units::angle::radian_t azimuth_1,
+                     units::length::meter_t distance,
+                     units::angle::radian_t* lat_2,
+                     units::angle::radian_t* lon_2,
+                     units::angle::radian_t* azimuth_2 = nullptr) const;
+
+    /**
+     * \brief Solves direct geodesic problem.
+     * \param pos_1 first point geodetic coordinates
+     * \param azimuth_1 [rad] azimuth at the first point
+     * \param distance [m] distance
+     * \return second point geodetic coordinates, altitude is the same as of the first point
+     */
+    Geo solveDirect(const Geo& pos_1,
+                    units::angle::radian_t azimuth_1,
+                    units::length::meter_t distance) const;
+
+    /**
+     * \brief Calculates distance on the mean radius sphere (haversine formula).
+     * \param lat_1 [rad] geodetic latitude of the first point
+     * \param lon_1 [rad] geodetic longitude of the first point
+     * \param lat_2 [rad] geodetic latitude of the second point
+     * \param lon_2 [rad] geodetic longitude of the second point
+     * \return [m] spherical distance
+     */
+    units::length::meter_t getSphericalDistance(units::angle::radian_t lat_1,
+                                                units::angle::radian_t lon_1,
+                                                units::angle::radian_t lat_2,
+                                                units::angle::radian_t lon_2) const;
+
+    /**
+     * \brief Calculates distances between pairs of points.
+     *
+     * Coordinates are passed as structure of arrays. In the spherical mode
+     * sines and cosines of a block of points are evaluated at once.
+     *
+     * \param lat_1 [rad] geodetic latitudes of the first points
+     * \param lon_1 [rad] geodetic longitudes of the first points
+     * \param lat_2 [rad] geodetic latitudes of the second points
+     * \param lon_2 [rad] geodetic longitudes of the second points
+     * \param distance [m] resulting distances, size should match input size
+     * \param mode distance calculation method
+     * \param results resulting individual results (may be empty), size should match input size
+     * \return mc::Result::Success if all the distances were calculated, mc::Result::Failure otherwise,
+     * distances are NaN for the pairs for which the solution didn't converge
+     */
+    Result getDistances(std::span<const units::angle::radian_t> lat_1,
+                        std::span<const units::angle::radian_t> lon_1,
+                        std::span<const units::angle::radian_t> lat_2,
+                        std::span<const units::angle::radian_t> lon_2,
+                        std::span<units::length::meter_t> distance,
+                        GeodesicMode mode = GeodesicMode::Ellipsoidal,
+                        std::span<Result> results = {}) const;
+
+    /**
+     * \brief Finds points within the given ellipsoidal distance from the center point.
+     *
+     * Points are culled using spherical distance bounds first, comparing
+     * haversines with precomputed thresholds. Inverse geodesic problem is
+     * solved only for points in the narrow band where the bounds are
+     * inconclusive. Points for which the solution doesn't converge are
+     * considered not within distance.
+     *
+     * \param lat_0 [rad] geodetic latitude of the center point
+     * \param lon_0 [rad] geodetic longitude of the center point
+     * \param distance [m] maximum distance, no points are found if negative
+     * \param lat [rad] geodetic latitudes of the points
+     * \param lon [rad] geodetic longitudes of the points
+     * \param indices resulting indices of the points within distance, in ascending order
+     * \return number of points within distance
+     */
+    size_t findWithinDistance(units::angle::radian_t lat_0,
+                              units::angle::radian_t lon_0,
+                              units::length::meter_t distance,
+                              std::span<const units::angle::radian_t> lat,
+                              std::span<const units::angle::radian_t> lon,
+                              std::vector<size_t>* indices) const;
+
+    /** \brief Returns minimum ratio of ellipsoidal to spherical distance. */
+    inline double sphericalRatioMin() const { return _k_min; }
+
+    /** \brief Returns maximum ratio of ellipsoidal to spherical distance. */
+    inline double sphericalRatioMax() const { return _k_max; }
+
+private:
+
+    unsigned int _max_iterations;   ///< maximum number of iterations
+    double _tolerance;              ///< [rad] angular convergence tolerance
+
+    double _a;          ///< [m] equatorial radius
+    double _b;          ///< [m] polar radius
+    double _f;          ///< [-] flattening
+    double _b_a;        ///< [-] b/a = 1 - f
+    double _ep2;        ///< [-] second eccentricity squared
+    double _r1;         ///< [m] mean radius
+    double _k_min;      ///< [-] minimum ratio of ellipsoidal to spherical distance
+    double _k_max;      ///< [-] maximum ratio of ellipsoidal to spherical distance
+
+    /**
+     * \brief Solves inverse geodesic problem by bisection on the azimuth at the first point.
+     *
+     * Used for nearly antipodal points for which Vincenty's iteration
+     * doesn't converge. Points are brought to the canonical configuration
+     * in which the longitude difference is a monotonic function of
+     * the azimuth, see Karney.
+     *
+     * \param lat_1 [rad] geodetic latitude of the first point
+     * \param lon_1 [rad] geodetic longitude of the first point
+     * \param lat_2 [rad] geodetic latitude of the second point
+     * \param lon_2 [rad] geodetic longitude of the second point
+     * \param distance [m] resulting distance pointer
+     * \param azimuth_1 [rad] resulting azimuth at the first point pointer (may be nullptr)
+     * \param azimuth_2 [rad] resulting azimuth at the second point pointer (may be nullptr)
+     * \return mc::Result::Success on success, mc::Result::Failure if not converged
+     */
+    Result solveInverseAntipodal(units::angle::radian_t lat_1,
+                                 units::angle::radian_t lon_1,
+                                 units::angle::radian_t lat_2,
+                                 units::angle::radian_t lon_2,
+                                 units::length::meter_t* distance,
+                                 units::angle::radian_t* azimuth_1,
+                                 units::angle::radian_t* azimuth_2) const;
+
+    /**
+     * \brief Calculates Vincenty's series coefficients A and B.
+     * \param cos2_alpha squared cosine of the azimuth at the equator
+     * \param a resulting coefficient A pointer
+     * \param b resulting coefficient B pointer
+     */
+    void getSeriesCoefs(double cos2_alpha, double* a, double* b) const;
+};
+
+} // namespace mc
+
+#endif // MCUTILS_GEO_GEODESIC_H_
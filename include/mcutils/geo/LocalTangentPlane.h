@@ -0,0 +1,190 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_GEO_LOCALTANGENTPLANE_H_
+#define MCUTILS_GEO_LOCALTANGENTPLANE_H_
+
+#include <span>
+
+#include <units.h>
+
+#include <mcutils/mcutils_api.h>
+
+#include <mcutils/geo/ECEF.h>
+#include <mcutils/geo/Ellipsoid.h>
+#include <mcutils/geo/Geo.h>
+
+#include <mcutils/math/Vector.h>
+
+namespace mc {
+
+/**
+ * \brief Local tangent plane coordinate system class.
+ *
+ * This class converts points between geodetic or Earth-centered, Earth-fixed
+ * (ECEF) coordinates and local North-East-Down (NED) or East-North-Up (ENU)
+ * coordinates of the fixed origin. Origin position and rotation matrix are
+ * computed once when the origin is set, so converting a point requires only
+ * the datum conversion (if any), a translation and a rotation.<br/>
+ *
+ * Batch functions take coordinates as structure of arrays.
+ */
+class MCUTILS_API LocalTangentPlane
+{
+public:
+
+    /**
+     * \brief Constructor.
+     * \param ellipsoid datum ellipsoid
+     * \param origin origin geodetic coordinates
+     */
+    explicit LocalTangentPlane(const Ellipsoid& ellipsoid, const Geo& origin = Geo());
+
+    /**
+     * \brief Converts geodetic coordinates into local NED coordinates.
+     * \param pos_geo geodetic coordinates
+     * \return [m] resulting NED coordinates vector
+     */
+    Vector3_m convertGeo2NED(const Geo& pos_geo) const;
+
+    /**
+     * \brief Converts local NED coordinates into geodetic coordinates.
+     * \param pos_ned [m] NED coordinates vector
+     * \return resulting geodetic coordinates
+     */
+    Geo convertNED2Geo(const Vector3_m& pos_ned) const;
+
+    /**
+     * \brief Converts ECEF coordinates into local NED coordinates.
+     * \param pos_cart [m] ECEF coordinates vector
+     * \return [m] resulting NED coordinates vector
+     */
+    Vector3_m convertECEF2NED(const Vector3_m& pos_cart) const;
+
+    /**
+     * \brief Converts ECEF coordinates into local ENU coordinates.
+     * \param pos_cart [m] ECEF coordinates vector
+     * \return [m] resulting ENU coordinates vector
+     */
+    Vector3_m convertECEF2ENU(const Vector3_m& pos_cart) const;
+
+    /**
+     * \brief Converts local NED coordinates into ECEF coordinates.
+     * \param pos_ned [m] NED coordinates vector
+     * \return [m] resulting ECEF coordinates vector
+     */
+    Vector3_m convertNED2ECEF(const Vector3_m& pos_ned) const;
+
+    /**
+     * \brief Converts geodetic coordinates into local NED coordinates.
+     *
+     * Batch version of convertGeo2NED(). Points are converted into ECEF
+     * coordinates by the ECEF batch function (written into the result
+     * arrays), then translated and rotated in place.
+     *
+     * \param lat [rad] geodetic latitudes
+     * \param lon [rad] geodetic longitudes
+     * \param alt [m] altitudes above mean sea level
+     * \param n [m] resulting north coordinates, size should match input size
+     * \param e [m] resulting east coordinates, size should match input size
+     * \param d [m] resulting down coordinates, size should match input size
+     * \param threads number of threads used for the datum conversion
+     */
+    void convertGeo2NED(std::span<const units::angle::radian_t> lat,
+                        std::span<const units::angle::radian_t> lon,
+                        std::span<const units::length::meter_t> alt,
+                        std::span<units::length::meter_t> n,
+                        std::span<units::length::meter_t> e,
+                        std::span<units::length::meter_t> d,
+                        unsigned int threads = 1) const;
+
+    /**
+     * \brief Converts local NED coordinates into geodetic coordinates.
+     *
+     * Batch version of convertNED2Geo(). Points are rotated and translated
+     * into ECEF coordinates first, then converted by the ECEF batch function.
+     *
+     * \param n [m] north coordinates
+     * \param e [m] east coordinates
+     * \param d [m] down coordinates
+     * \param lat [rad] resulting geodetic latitudes, size should match input size
+     * \param lon [rad] resulting geodetic longitudes, size should match input size
+     * \param alt [m] resulting altitudes above mean sea level, size should match input size
+     * \param threads number of threads used for the datum conversion
+     */
+    void convertNED2Geo(std::span<const units::length::meter_t> n,
+                        std::span<const units::length::meter_t> e,
+                        std::span<const units::length::meter_t> d,
+                        std::span<units::angle::radian_t> lat,
+                        std::span<units::angle::radian_t> lon,
+                        std::span<units::length::meter_t> alt,
+                        unsigned int threads = 1) const;
+
+    /**
+     * \brief Converts ECEF coordinates into local ENU coordinates.
+     * Batch version of convertECEF2ENU().
+     * \param x [m] ECEF x-coordinates
+     * \param y [m] ECEF y-coordinates
+     * \param z [m] ECEF z-coordinates
+     * \param e [m] resulting east coordinates, size should match input size
+     * \param n [m] resulting north coordinates, size should match input size
+     * \param u [m] resulting up coordinates, size should match input size
+     */
+    void convertECEF2ENU(std::span<const units::length::meter_t> x,
+                         std::span<const units::length::meter_t> y,
+                         std::span<const units::length::meter_t> z,
+                         std::span<units::length::meter_t> e,
+                         std::span<units::length::meter_t> n,
+                         std::span<units::length::meter_t> u) const;
+
+    /**
+     * \brief Sets origin from geodetic coordinates.
+     * \param origin origin geodetic coordinates
+     */
+    void setOrigin(const Geo& origin);
+
+    /**
+     * \brief Sets origin from ECEF coordinates.
+     * \param origin_cart [m] origin ECEF coordinates vector
+     */
+    void setOrigin(const Vector3_m& origin_cart);
+
+    inline const Geo& origin_geo() const { return _ecef.pos_geo(); }
+    inline const Vector3_m& origin_cart() const { return _ecef.pos_cart(); }
+
+    inline const ECEF& ecef() const { return _ecef; }
+
+protected:
+
+    ECEF _ecef;                 ///< ECEF coordinate system of the origin
+
+    double _origin[3];          ///< [m] origin ECEF coordinates
+    double _ecef2ned[3][3];     ///< rotation matrix from ECEF to NED
+
+    /**
+     * \brief Updates cached origin coordinates and rotation matrix.
+     */
+    void updateCache();
+};
+
+} // namespace mc
+
+#endif // MCUTILS_GEO_LOCALTANGENTPLANE_H_
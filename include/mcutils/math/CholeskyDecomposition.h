@@ -0,0 +1,211 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_CHOLESKYDECOMPOSITION_H_
+#define MCUTILS_MATH_CHOLESKYDECOMPOSITION_H_
+
+#include <cmath>
+#include <type_traits>
+
+#include <mcutils/Result.h>
+
+#include <mcutils/math/Matrix.h>
+#include <mcutils/math/Vector.h>
+
+namespace mc {
+
+/**
+ * \brief Cholesky decomposition of a symmetric positive-definite matrix.
+ *
+ * Decomposes matrix as A = L*L^T, where L is lower triangular matrix.
+ * It takes about half the operations of LU decomposition and needs
+ * no pivoting. Only lower triangle of the decomposed matrix is used.
+ *
+ * ### References:
+ * - Press W., et al.: Numerical Recipes: The Art of Scientific Computing, 2007, p.100
+ * - [Cholesky decomposition - Wikipedia](https://en.wikipedia.org/wiki/Cholesky_decomposition)
+ *
+ * \tparam TYPE type of the matrix elements
+ * \tparam SIZE size of the matrix
+ */
+template <typename TYPE, unsigned int SIZE>
+requires std::is_floating_point<TYPE>::value
+class CholeskyDecomposition
+{
+public:
+
+    /** \brief Constructor. */
+    CholeskyDecomposition() = default;
+
+    /**
+     * \brief Constructor.
+     * \param mtr matrix to be decomposed
+     * \param eps minimum value treated as not-zero
+     */
+    explicit CholeskyDecomposition(const MatrixNxN<TYPE, SIZE>& mtr, double eps = 1.0e-9)
+    {
+        decompose(mtr, eps);
+    }
+
+    /**
+     * \brief Decomposes matrix.
+     * \param mtr matrix to be decomposed
+     * \param eps minimum value treated as not-zero
+     * \return mc::Result::Success on success and mc::Result::Failure if the matrix is not positive-definite
+     */
+    Result decompose(const MatrixNxN<TYPE, SIZE>& mtr, double eps = 1.0e-9)
+    {
+        _l = MatrixNxN<TYPE, SIZE>();
+        _valid = true;
+
+        for (unsigned int j = 0; j < SIZE; ++j)
+        {
+            TYPE sum = mtr(j,j);
+            for (unsigned int k = 0; k < j; ++k)
+            {
+                sum -= _l(j,k) * _l(j,k);
+            }
+
+            if (sum < fabs(eps))
+            {
+                _valid = false;
+                return Result::Failure;
+            }
+
+            const TYPE l_jj = sqrt(sum);
+            const TYPE l_jj_inv = TYPE{1} / l_jj;
+            _l(j,j) = l_jj;
+
+            for (unsigned int i = j + 1; i < SIZE; ++i)
+            {
+                TYPE s = mtr(i,j);
+                for (unsigned int k = 0; k < j; ++k)
+                {
+                    s -= _l(i,k) * _l(j,k);
+                }
+                _l(i,j) = s * l_jj_inv;
+            }
+        }
+
+        return Result::Success;
+    }
+
+    /**
+     * \brief Solves system of linear equations A*x = rhs.
+     * \param rhs right hand side vector
+     * \param x result vector, may be the same object as rhs
+     * \return mc::Result::Success on success and mc::Result::Failure if the decomposition is not valid
+     */
+    Result solve(const VectorN<TYPE, SIZE>& rhs, VectorN<TYPE, SIZE>* x) const
+    {
+        if (!_valid)
+        {
+            return Result::Failure;
+        }
+
+        VectorN<TYPE, SIZE> y = rhs;
+
+        // forward substitution, L*y = rhs
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            for (unsigned int k = 0; k < i; ++k)
+            {
+                y(i) -= _l(i,k) * y(k);
+            }
+            y(i) /= _l(i,i);
+        }
+
+        // back substitution, L^T*x = y
+        for (unsigned int i = SIZE; i-- > 0;)
+        {
+            for (unsigned int k = i + 1; k < SIZE; ++k)
+            {
+                y(i) -= _l(k,i) * y(k);
+            }
+            y(i) /= _l(i,i);
+        }
+
+        *x = y;
+
+        return Result::Success;
+    }
+
+    /**
+     * \brief Calculates inverse of the decomposed matrix.
+     * \param inv result inverse matrix
+     * \return mc::Result::Success on success and mc::Result::Failure if the decomposition is not valid
+     */
+    Result getInverse(MatrixNxN<TYPE, SIZE>* inv) const
+    {
+        if (!_valid)
+        {
+            return Result::Failure;
+        }
+
+        VectorN<TYPE, SIZE> col;
+        for (unsigned int c = 0; c < SIZE; ++c)
+        {
+            VectorN<TYPE, SIZE> e;
+            e(c) = TYPE{1};
+            solve(e, &col);
+            for (unsigned int r = 0; r < SIZE; ++r)
+            {
+                (*inv)(r,c) = col(r);
+            }
+        }
+
+        return Result::Success;
+    }
+
+    /**
+     * \brief Returns determinant of the decomposed matrix.
+     * \return determinant of the decomposed matrix, zero if the decomposition is not valid
+     */
+    TYPE getDeterminant() const
+    {
+        if (!_valid)
+        {
+            return TYPE{0};
+        }
+
+        TYPE det = TYPE{1};
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            det *= _l(i,i);
+        }
+        return det * det;
+    }
+
+    /** \brief Returns lower triangular matrix L. */
+    inline const MatrixNxN<TYPE, SIZE>& getL() const { return _l; }
+
+    /** \brief Returns true if the decomposition is valid, false otherwise. */
+    inline bool isValid() const { return _valid; }
+
+private:
+
+    MatrixNxN<TYPE, SIZE> _l;   ///< lower triangular matrix
+    bool _valid = false;        ///< specifies if decomposition is valid
+};
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_CHOLESKYDECOMPOSITION_H_
@@ -0,0 +1,161 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_DYNAMICSTORAGE_H_
+#define MCUTILS_MATH_DYNAMICSTORAGE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace mc {
+
+/**
+ * \brief Element storage of the dynamically sized vectors and matrices.
+ *
+ * Up to INLINE_SIZE elements are stored in a buffer inside the object, so
+ * small vectors and matrices do not allocate. Larger sizes are allocated on
+ * the heap, aligned to the cache line size, so SIMD loads in the inner loops
+ * never split cache lines. Heap buffer is kept when shrinking, so resizing
+ * back and forth does not allocate either.
+ *
+ * \tparam TYPE element type
+ * \tparam INLINE_SIZE number of elements stored without allocation
+ */
+template <typename TYPE, unsigned int INLINE_SIZE>
+requires std::is_trivially_copyable<TYPE>::value
+class DynamicStorage
+{
+public:
+
+    static constexpr std::size_t kAlignment = 64;   ///< [bytes] heap buffer alignment
+
+    DynamicStorage() = default;
+
+    /**
+     * \brief Constructor.
+     * \param size number of elements, elements values are unspecified
+     */
+    explicit DynamicStorage(unsigned int size)
+    {
+        resize(size);
+    }
+
+    DynamicStorage(const DynamicStorage& other)
+    {
+        resize(other._size);
+        std::copy(other.data(), other.data() + _size, data());
+    }
+
+    DynamicStorage(DynamicStorage&& other) noexcept
+    {
+        moveFrom(&other);
+    }
+
+    ~DynamicStorage()
+    {
+        release();
+    }
+
+    DynamicStorage& operator=(const DynamicStorage& other)
+    {
+        if (this != &other)
+        {
+            resize(other._size);
+            std::copy(other.data(), other.data() + _size, data());
+        }
+        return *this;
+    }
+
+    DynamicStorage& operator=(DynamicStorage&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            moveFrom(&other);
+        }
+        return *this;
+    }
+
+    /**
+     * \brief Resizes storage.
+     * Elements values are unspecified after resizing.
+     * \param size new number of elements
+     */
+    void resize(unsigned int size)
+    {
+        if (size > INLINE_SIZE && size > _capacity)
+        {
+            release();
+            _heap = static_cast<TYPE*>(::operator new(size * sizeof(TYPE), std::align_val_t{kAlignment}));
+            _capacity = size;
+        }
+        _size = size;
+    }
+
+    /** \return number of elements */
+    inline unsigned int size() const { return _size; }
+
+    /** \return pointer to the elements */
+    inline const TYPE* data() const { return _heap ? _heap : _inline; }
+
+    /** \return pointer to the elements */
+    inline TYPE* data() { return _heap ? _heap : _inline; }
+
+private:
+
+    alignas(kAlignment) TYPE _inline[INLINE_SIZE] = {}; ///< inline buffer
+    TYPE* _heap = nullptr;                              ///< heap buffer
+    unsigned int _capacity = 0;                         ///< heap buffer capacity
+    unsigned int _size = 0;                             ///< number of elements
+
+    void release()
+    {
+        if (_heap)
+        {
+            ::operator delete(_heap, std::align_val_t{kAlignment});
+            _heap = nullptr;
+            _capacity = 0;
+        }
+    }
+
+    void moveFrom(DynamicStorage* other)
+    {
+        if (other->_heap)
+        {
+            _heap = other->_heap;
+            _capacity = other->_capacity;
+            other->_heap = nullptr;
+            other->_capacity = 0;
+        }
+        else
+        {
+            std::copy(other->_inline, other->_inline + other->_size, _inline);
+        }
+        _size = other->_size;
+        other->_size = 0;
+    }
+};
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_DYNAMICSTORAGE_H_
@@ -0,0 +1,542 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_EMBEDDEDRUNGEKUTTA_H_
+#define MCUTILS_MATH_EMBEDDEDRUNGEKUTTA_H_
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <mcutils/units.h>
+
+#include <mcutils/math/LazyExpr.h>
+
+namespace mc {
+
+namespace detail {
+
+/**
+ * \return number of elements of the integrated value, 1 for scalars
+ */
+template <typename T_VALUE>
+constexpr unsigned int getIntegratedValueSize()
+{
+    if constexpr (LazyContainerType<T_VALUE>)
+        return T_VALUE::kSize;
+    else
+        return 1;
+}
+
+/**
+ * \return reference to the element of the integrated value, the value itself for scalars
+ */
+template <typename T_VALUE>
+decltype(auto) getIntegratedValueElement(T_VALUE& val, unsigned int i)
+{
+    if constexpr (LazyContainerType<T_VALUE>)
+        return val(i);
+    else
+        return (val);
+}
+
+/**
+ * \return element of the integrated value, the value itself for scalars
+ */
+template <typename T_VALUE>
+auto getIntegratedValueElement(const T_VALUE& val, unsigned int i)
+{
+    if constexpr (LazyContainerType<T_VALUE>)
+        return val(i);
+    else
+        return val;
+}
+
+/**
+ * \return element value as double, units are stripped
+ */
+template <typename TYPE>
+double getIntegratedValueAsDouble(const TYPE& val)
+{
+    if constexpr (units::traits::is_unit_t<TYPE>::value)
+        return val.value();
+    else
+        return static_cast<double>(val);
+}
+
+} // namespace detail
+
+/**
+ * \brief Embedded Runge-Kutta numerical integration class template.
+ *
+ * Each step is done with two solutions of different order, their difference
+ * is used as the local error estimate. Steps with error estimate exceeding
+ * tolerances are rejected and repeated with smaller step size, otherwise
+ * the next step size is increased, so the number of derivative function
+ * evaluations adapts to the dynamics of the system. Solution is propagated
+ * with the higher order formula (local extrapolation).
+ *
+ * integrate() follows the interface of RungeKutta4, the given interval is
+ * covered with as many adaptive steps as needed and the step size is kept
+ * between the calls. Dense output is available for the last accepted step.
+ * For first same as last tableaus the derivative at the step end is reused
+ * by the next step, also in the next call, if it starts from the same value.
+ * It is discarded when the derivative function is replaced with setFun().
+ *
+ * The Butcher tableau is given by the TABLEAU type, which has to provide:
+ * - kStages - number of stages,
+ * - kOrder - order of the lower order solution, used by the step size control,
+ * - kFsal - true if the last stage is evaluated at the step result (first same as last),
+ * - kDenseOutput - true if the tableau provides continuous extension coefficients d,
+ * - c, a, b, e - nodes, Runge-Kutta matrix, weights and error estimate weights.
+ * See RungeKutta45 and RungeKutta78.
+ *
+ * ### References:
+ * - Hairer E., Norsett S., Wanner G.: Solving Ordinary Differential Equations I, 1993, p.165-192
+ * - Press W., et al.: Numerical Recipes: The Art of Scientific Computing, 2007, p.910
+ * - [Adaptive Runge–Kutta methods - Wikipedia](https://en.wikipedia.org/wiki/Runge%E2%80%93Kutta_methods#Adaptive_Runge%E2%80%93Kutta_methods)
+ *
+ * \tparam TABLEAU Butcher tableau
+ * \tparam T_VALUE type of the integrated value
+ * \tparam T_STEP type of the integration step
+ * \tparam DERIV_FUN type of the derivative function, see RungeKutta4
+ */
+template <typename TABLEAU, typename T_VALUE, typename T_STEP,
+          typename DERIV_FUN = std::function<T_VALUE(const T_VALUE&)>>
+class EmbeddedRungeKutta
+{
+public:
+
+    using DerivFun = DERIV_FUN;
+
+    static constexpr unsigned int kStages = TABLEAU::kStages;
+    static constexpr unsigned int kSize = detail::getIntegratedValueSize<T_VALUE>();
+
+    static constexpr double kSafety  = 0.9;     ///< step size safety factor
+    static constexpr double kFactMin = 0.2;     ///< minimum step size change factor
+    static constexpr double kFactMax = 5.0;     ///< maximum step size change factor
+    static constexpr double kStepMin = 1.0e-12; ///< minimum step size relative to the integration interval
+
+    EmbeddedRungeKutta() = default;
+
+    /**
+     * \brief Constructor.
+     * \param fun function which calculates vector derivative
+     */
+    explicit EmbeddedRungeKutta(DerivFun fun)
+        : _fun(std::move(fun))
+    {}
+
+    /**
+     * \brief Integrates over the given interval using adaptive steps.
+     * \param dx integration interval
+     * \param yn current value to be integrated
+     * \return integration result
+     */
+    T_VALUE integrate(T_STEP dx, const T_VALUE& yn)
+    {
+        T_VALUE result = yn;
+        integrate(dx, &result);
+        return result;
+    }
+
+    /**
+     * \brief Integrates in place over the given interval using adaptive steps.
+     * Steps are not shorter than kStepMin of the interval and such steps are
+     * accepted regardless of the error estimate. If the error estimate is not
+     * finite even for such a step (e.g. derivative function returned NaN)
+     * integration stops and the value is left as the step result.
+     * \param dx integration interval
+     * \param y value to be integrated, replaced by the integration result
+     */
+    void integrate(T_STEP dx, T_VALUE* y)
+    {
+        if (dx == T_STEP{0})
+        {
+            return;
+        }
+
+        const T_STEP dx_abs = getAbs(dx);
+        const T_STEP h_min = dx_abs * kStepMin;
+
+        // step size from the previous call, unless direction has changed
+        T_STEP h = _h;
+        if (h == T_STEP{0} || (h > T_STEP{0}) != (dx > T_STEP{0}))
+        {
+            h = dx;
+        }
+
+        T_STEP remaining = dx;
+        bool done = false;
+        while (!done)
+        {
+            const bool last = getAbs(h) >= getAbs(remaining);
+            if (last)
+            {
+                h = remaining;
+            }
+
+            T_STEP h_next = h;
+            const bool force = getAbs(h) <= h_min;
+            if (doStep(h, y, &h_next, force))
+            {
+                if (last)
+                {
+                    done = true;
+                    // truncated last step should not decrease the step size
+                    if (getAbs(h_next) > getAbs(_h) || (_h > T_STEP{0}) != (dx > T_STEP{0}))
+                    {
+                        _h = h_next;
+                    }
+                }
+                else
+                {
+                    remaining -= h;
+                    _h = h_next;
+                }
+            }
+
+            // error estimate is not finite even for the minimum step (e.g. derivative
+            // function returned NaN), further steps would not make it finite
+            if (force && !std::isfinite(_err_norm))
+            {
+                _h = T_STEP{0};
+                done = true;
+            }
+
+            // steps not shorter than the minimum one, which is always accepted,
+            // so the interval is always finished
+            if (getAbs(h_next) < h_min)
+            {
+                h_next = dx > T_STEP{0} ? h_min : -h_min;
+            }
+
+            h = h_next;
+        }
+    }
+
+    /**
+     * \brief Attempts single step.
+     * \param h step size
+     * \param y value to be integrated, replaced by the step result if step was accepted
+     * \param h_next output suggested next step size, or reduced step size if step was rejected
+     * \return true if step was accepted, false otherwise
+     */
+    bool tryStep(T_STEP h, T_VALUE* y, T_STEP* h_next)
+    {
+        return doStep(h, y, h_next, false);
+    }
+
+    /**
+     * \brief Returns interpolated value within the last accepted step.
+     * For tableaus without continuous extension cubic Hermite interpolation
+     * is used, which requires one more derivative function evaluation.
+     * After rejected step the value at the step beginning is returned.
+     * \param theta normalized position within the step, 0 for the step beginning, 1 for the step end
+     * \return interpolated value
+     */
+    T_VALUE getDenseOutput(double theta)
+    {
+        T_VALUE result = _y1;
+
+        if (_h_last == T_STEP{0})
+        {
+            return result;
+        }
+
+        if constexpr (TABLEAU::kDenseOutput)
+        {
+            // Hairer E., Norsett S., Wanner G.: Solving Ordinary Differential Equations I, 1993, p.191
+            const double theta1 = 1.0 - theta;
+            for (unsigned int i = 0; i < kSize; ++i)
+            {
+                const auto y0 = detail::getIntegratedValueElement(_y0, i);
+                const auto y1 = detail::getIntegratedValueElement(_y1, i);
+
+                auto kd = TABLEAU::d[0] * detail::getIntegratedValueElement(_k[0], i);
+                for (unsigned int j = 1; j < kStages; ++j)
+                {
+                    if (TABLEAU::d[j] != 0.0)
+                    {
+                        kd += TABLEAU::d[j] * detail::getIntegratedValueElement(_k[j], i);
+                    }
+                }
+
+                const auto k0_h = detail::getIntegratedValueElement(_k[0], i) * _h_last;
+                const auto kl_h = detail::getIntegratedValueElement(_k[kStages - 1], i) * _h_last;
+
+                const auto r2 = y1 - y0;
+                const auto r3 = k0_h - r2;
+                const auto r4 = r2 - kl_h - r3;
+                const auto r5 = kd * _h_last;
+
+                detail::getIntegratedValueElement(result, i) =
+                        y0 + (r2 + (r3 + (r4 + r5 * theta1) * theta) * theta1) * theta;
+            }
+        }
+        else
+        {
+            if (!_f1_valid)
+            {
+                calcDeriv(_y1, &_f1);
+                _f1_valid = true;
+            }
+
+            const double t2 = theta * theta;
+            const double t3 = t2 * theta;
+            const double h00 =  2.0 * t3 - 3.0 * t2 + 1.0;
+            const double h10 =        t3 - 2.0 * t2 + theta;
+            const double h01 = -2.0 * t3 + 3.0 * t2;
+            const double h11 =        t3 -       t2;
+
+            for (unsigned int i = 0; i < kSize; ++i)
+            {
+                detail::getIntegratedValueElement(result, i) =
+                        h00 * detail::getIntegratedValueElement(_y0, i)
+                      + h01 * detail::getIntegratedValueElement(_y1, i)
+                      + (h10 * detail::getIntegratedValueElement(_k[0], i)
+                       + h11 * detail::getIntegratedValueElement(_f1, i)) * _h_last;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief Sets error tolerances.
+     * Local error of each element is kept below abs_tol + rel_tol * |y|.
+     * \param abs_tol absolute tolerance
+     * \param rel_tol relative tolerance
+     */
+    void setTolerances(double abs_tol, double rel_tol)
+    {
+        _abs_tol = abs_tol;
+        _rel_tol = rel_tol;
+    }
+
+    /**
+     * \brief Sets step size to start with.
+     * \param h step size, if zero the integration interval is used
+     */
+    void setStep(T_STEP h) { _h = h; }
+
+    inline T_STEP step() const { return _h; }
+
+    inline double absTol() const { return _abs_tol; }
+    inline double relTol() const { return _rel_tol; }
+
+    inline unsigned int getEvaluations()   const { return _evaluations;    }
+    inline unsigned int getAcceptedSteps() const { return _accepted_steps; }
+    inline unsigned int getRejectedSteps() const { return _rejected_steps; }
+
+    /** \brief Resets evaluations and steps counters. */
+    void resetStats()
+    {
+        _evaluations    = 0;
+        _accepted_steps = 0;
+        _rejected_steps = 0;
+    }
+
+    inline DerivFun fun() const { return _fun; }
+
+    void setFun(DerivFun fun)
+    {
+        _fun = std::move(fun);
+        _f1_valid = false;
+    }
+
+private:
+
+    DerivFun _fun;              ///< function which calculates vector derivative
+
+    T_VALUE _k[kStages];        ///< stages derivatives
+    T_VALUE _y0;                ///< last accepted step beginning value
+    T_VALUE _y1;                ///< last accepted step result
+    T_VALUE _f1;                ///< derivative at _y1
+
+    T_STEP _h = T_STEP{0};      ///< suggested step size
+    T_STEP _h_last = T_STEP{0}; ///< last accepted step size
+
+    double _abs_tol = 1.0e-6;   ///< absolute tolerance
+    double _rel_tol = 1.0e-6;   ///< relative tolerance
+    double _err_norm = 0.0;     ///< last step normalized error estimate
+
+    unsigned int _evaluations    = 0;   ///< number of derivative function evaluations
+    unsigned int _accepted_steps = 0;   ///< number of accepted steps
+    unsigned int _rejected_steps = 0;   ///< number of rejected steps
+
+    bool _f1_valid = false;     ///< specifies if _f1 is valid for _y1
+
+    /**
+     * \brief Does single step.
+     * \param h step size
+     * \param y value to be integrated, replaced by the step result if step was accepted
+     * \param h_next output suggested next step size
+     * \param force specifies if step has to be accepted regardless of error estimate
+     * \return true if step was accepted, false otherwise
+     */
+    bool doStep(T_STEP h, T_VALUE* y, T_STEP* h_next, bool force)
+    {
+        // first stage derivative is reused if the step starts where
+        // the derivative is already known (first same as last)
+        if (_f1_valid && isEqual(*y, _y1))
+        {
+            _k[0] = _f1;
+        }
+        else
+        {
+            calcDeriv(*y, &_k[0]);
+        }
+
+        T_VALUE y_stage = *y;
+        for (unsigned int s = 1; s < kStages; ++s)
+        {
+            for (unsigned int i = 0; i < kSize; ++i)
+            {
+                auto sum = TABLEAU::a[s][0] * detail::getIntegratedValueElement(_k[0], i);
+                for (unsigned int j = 1; j < s; ++j)
+                {
+                    if (TABLEAU::a[s][j] != 0.0)
+                    {
+                        sum += TABLEAU::a[s][j] * detail::getIntegratedValueElement(_k[j], i);
+                    }
+                }
+                detail::getIntegratedValueElement(y_stage, i) =
+                        detail::getIntegratedValueElement(*y, i) + sum * h;
+            }
+            calcDeriv(y_stage, &_k[s]);
+        }
+
+        // solution and error estimate
+        T_VALUE y_new = *y;
+        double err_sum = 0.0;
+        for (unsigned int i = 0; i < kSize; ++i)
+        {
+            auto sum = TABLEAU::b[0] * detail::getIntegratedValueElement(_k[0], i);
+            auto err = TABLEAU::e[0] * detail::getIntegratedValueElement(_k[0], i);
+            for (unsigned int j = 1; j < kStages; ++j)
+            {
+                if (TABLEAU::b[j] != 0.0)
+                {
+                    sum += TABLEAU::b[j] * detail::getIntegratedValueElement(_k[j], i);
+                }
+                if (TABLEAU::e[j] != 0.0)
+                {
+                    err += TABLEAU::e[j] * detail::getIntegratedValueElement(_k[j], i);
+                }
+            }
+
+            const auto y_i = detail::getIntegratedValueElement(*y, i);
+            detail::getIntegratedValueElement(y_new, i) = y_i + sum * h;
+
+            const double y0_abs = std::fabs(detail::getIntegratedValueAsDouble(y_i));
+            const double y1_abs = std::fabs(detail::getIntegratedValueAsDouble(
+                                                detail::getIntegratedValueElement(y_new, i)));
+            const double scale = _abs_tol + _rel_tol * std::max(y0_abs, y1_abs);
+            const double err_i = detail::getIntegratedValueAsDouble(err * h) / scale;
+            err_sum += err_i * err_i;
+        }
+        const double err_norm = std::sqrt(err_sum / kSize);
+        _err_norm = err_norm;
+
+        // step size control
+        // Hairer E., Norsett S., Wanner G.: Solving Ordinary Differential Equations I, 1993, p.168
+        // non-finite error (e.g. NaN derivative) shrinks the step as much as allowed
+        double fact = kFactMin;
+        if (std::isfinite(err_norm))
+        {
+            fact = err_norm > 0.0
+                    ? kSafety * std::pow(err_norm, -1.0 / (TABLEAU::kOrder + 1))
+                    : kFactMax;
+        }
+        fact = std::min(kFactMax, std::max(kFactMin, fact));
+
+        if (err_norm <= 1.0 || force)
+        {
+            _y0 = *y;
+            _y1 = y_new;
+            *y = y_new;
+            _h_last = h;
+            ++_accepted_steps;
+
+            if constexpr (TABLEAU::kFsal)
+            {
+                _f1 = _k[kStages - 1];
+                _f1_valid = true;
+            }
+            else
+            {
+                _f1_valid = false;
+            }
+
+            *h_next = h * fact;
+            return true;
+        }
+
+        // derivative is known for the step beginning, so it is kept for
+        // the next attempt, dense output is no longer available
+        _y1 = *y;
+        _f1 = _k[0];
+        _f1_valid = true;
+        _h_last = T_STEP{0};
+        ++_rejected_steps;
+
+        *h_next = h * std::min(1.0, fact);
+        return false;
+    }
+
+    /**
+     * \brief Calls derivative function, see RungeKutta4.
+     * \param y value
+     * \param dy output derivative
+     */
+    inline void calcDeriv(const T_VALUE& y, T_VALUE* dy)
+    {
+        ++_evaluations;
+        if constexpr (std::is_invocable_v<DerivFun&, const T_VALUE&, T_VALUE*>)
+            _fun(y, dy);
+        else
+            *dy = _fun(y);
+    }
+
+    static T_STEP getAbs(T_STEP val)
+    {
+        return val < T_STEP{0} ? -val : val;
+    }
+
+    static bool isEqual(const T_VALUE& v1, const T_VALUE& v2)
+    {
+        for (unsigned int i = 0; i < kSize; ++i)
+        {
+            if (detail::getIntegratedValueElement(v1, i) != detail::getIntegratedValueElement(v2, i))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_EMBEDDEDRUNGEKUTTA_H_
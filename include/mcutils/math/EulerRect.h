@@ -23,12 +23,20 @@
 #define MCUTILS_MATH_EULERRECT_H_
 
 #include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <mcutils/math/LazyExpr.h>
 
 namespace mc {
 
 /**
  * \brief Euler's rectangular numerical integration class template.
  *
+ * The derivative function type can be given as DERIV_FUN, so the calls
+ * are inlined, and the derivative function can write into the given
+ * value, see RungeKutta4 for details.
+ *
  * ### References:
  * - Press W., et al.: Numerical Recipes: The Art of Scientific Computing, 2007, p.907
  * - Allerton D.: Principles of Flight Simulation, 2009, p.58
@@ -39,13 +47,25 @@ namespace mc {
  *
  * \tparam T_VALUE type of the integrated value
  * \tparam T_STEP type of the integration step
+ * \tparam DERIV_FUN type of the derivative function
  */
-template <typename T_VALUE, typename T_STEP>
+template <typename T_VALUE, typename T_STEP,
+          typename DERIV_FUN = std::function<T_VALUE(const T_VALUE&)>>
 class EulerRect
 {
 public:
 
-    using DerivFun = std::function<T_VALUE(const T_VALUE&)>;
+    using DerivFun = DERIV_FUN;
+
+    EulerRect() = default;
+
+    /**
+     * \brief Constructor.
+     * \param fun function which calculates vector derivative
+     */
+    explicit EulerRect(DerivFun fun)
+        : _fun(std::move(fun))
+    {}
 
     /**
      * \brief Integrates using Euler's rectangular integration algorithm.
@@ -55,13 +75,31 @@ public:
      */
     T_VALUE integrate(T_STEP dx, const T_VALUE& yn)
     {
+        T_VALUE result = yn;
+        integrate(dx, &result);
+        return result;
+    }
+
+    /**
+     * \brief Integrates in place using Euler's rectangular integration algorithm.
+     * \param dx integration step
+     * \param y value to be integrated, replaced by the integration result
+     */
+    void integrate(T_STEP dx, T_VALUE* y)
+    {
+        T_VALUE dy;
+        if constexpr (std::is_invocable_v<DerivFun&, const T_VALUE&, T_VALUE*>)
+            _fun(*y, &dy);
+        else
+            dy = _fun(*y);
+
         // integration
-        return yn + _fun(yn) * dx;
+        *y = lazy(*y) + lazy(dy) * dx;
     }
 
     inline DerivFun fun() const { return _fun; }
 
-    void setFun(DerivFun fun) { _fun = fun; }
+    void setFun(DerivFun fun) { _fun = std::move(fun); }
 
 private:
 
@@ -0,0 +1,247 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_FIXEDTABLE_H_
+#define MCUTILS_MATH_FIXEDTABLE_H_
+
+#include <array>
+#include <limits>
+
+#include <mcutils/math/Table.h>
+
+namespace mc {
+
+/**
+ * \brief Fixed size table and linear interpolation class template.
+ *
+ * Compile-time counterpart of Table for constant data known at build time.
+ * Table can be constructed in a constexpr context, interpolation data is
+ * calculated by the compiler, so constexpr objects are placed in read-only
+ * memory and require neither heap allocation nor dynamic initialization.
+ * Records have the same layout as Table records, so toTable() returns Table
+ * referencing them without copying.
+ *
+ * \tparam KEY_TYPE key type
+ * \tparam VAL_TYPE value type
+ * \tparam SIZE number of records
+ */
+template <typename KEY_TYPE, typename VAL_TYPE, unsigned int SIZE>
+class FixedTable
+{
+    static_assert(SIZE > 0, "Table has to have at least one record.");
+
+public:
+
+    using Record = TableRecord<KEY_TYPE, VAL_TYPE>;
+
+    /**
+     * \brief Constructor.
+     * \param key_values key values ordered array
+     * \param table_data table values ordered array
+     */
+    constexpr FixedTable(const KEY_TYPE (&key_values)[SIZE], const VAL_TYPE (&table_data)[SIZE])
+    {
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            _records[i].key = key_values[i];
+            _records[i].value = table_data[i];
+        }
+
+        updateInterpolationData();
+    }
+
+    /**
+     * \brief Constructor.
+     * \param key_values key values ordered array
+     * \param table_data table values ordered array
+     */
+    constexpr FixedTable(const std::array<KEY_TYPE, SIZE>& key_values,
+                         const std::array<VAL_TYPE, SIZE>& table_data)
+    {
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            _records[i].key = key_values[i];
+            _records[i].value = table_data[i];
+        }
+
+        updateInterpolationData();
+    }
+
+    /**
+     * \brief Returns key for the given index.
+     * \param index index
+     * \return key value on success or NaN on failure
+     */
+    constexpr KEY_TYPE getKeyByIndex(unsigned int index) const
+    {
+        if (index < SIZE)
+        {
+            return _records[index].key;
+        }
+
+        return KEY_TYPE{std::numeric_limits<double>::quiet_NaN()};
+    }
+
+    /**
+     * \brief Returns table value for the given key.
+     *
+     * Returns table value for the given key value using linear interpolation
+     * algorithm, with the same results as Table::getValue().
+     *
+     * \param key_value key value
+     * \return interpolated value
+     */
+    constexpr VAL_TYPE getValue(KEY_TYPE key_value) const
+    {
+        if (key_value <= _records[0].key)
+        {
+            return _records[0].value;
+        }
+
+        if (key_value >= _records[SIZE - 1].key)
+        {
+            return _records[SIZE - 1].value;
+        }
+
+        const Record& rec = _records[findIndex(key_value)];
+        return VAL_TYPE{static_cast<double>(key_value - rec.key) * rec.slope} + rec.value;
+    }
+
+    /**
+     * \brief Returns table value for the given key index.
+     * \param key_index key index
+     * \return value on success or NaN on failure
+     */
+    constexpr VAL_TYPE getValueByIndex(unsigned int key_index) const
+    {
+        if (key_index < SIZE)
+        {
+            return _records[key_index].value;
+        }
+
+        return VAL_TYPE{std::numeric_limits<double>::quiet_NaN()};
+    }
+
+    /**
+     * \brief Returns table first value.
+     * \return table first value
+     */
+    constexpr VAL_TYPE getFirstValue() const { return _records[0].value; }
+
+    /**
+     * \brief Returns table last value.
+     * \return table last value
+     */
+    constexpr VAL_TYPE getLastValue() const { return _records[SIZE - 1].value; }
+
+    /**
+     * \brief Checks if table is valid.
+     *
+     * Can be used in static assertions, e.g. static_assert(tab.isValid()).
+     *
+     * \return returns true if all keys and values are finite and keys are
+     * strictly increasing
+     */
+    constexpr bool isValid() const
+    {
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            if (!isFinite(static_cast<double>(_records[i].key))
+             || !isFinite(static_cast<double>(_records[i].value)))
+            {
+                return false;
+            }
+
+            if (i > 0 && !(_records[i-1].key < _records[i].key))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * \brief Returns table referencing records of this table.
+     *
+     * Records are not copied, so this object has to outlive the returned
+     * table, which is typically the case for constexpr static objects.
+     * Records are copied only if the returned table is modified.
+     *
+     * \return table referencing records of this table
+     */
+    template <typename ALLOCATOR = std::allocator<std::byte>>
+    Table<KEY_TYPE,VAL_TYPE,ALLOCATOR> toTable() const
+    {
+        Table<KEY_TYPE,VAL_TYPE,ALLOCATOR> table;
+        table.setView(_records.data(), SIZE, TableSearch::Binary, TableInterpolation::Linear);
+        table._search = table.areKeysUniform() ? TableSearch::Uniform : TableSearch::Binary;
+        return table;
+    }
+
+    constexpr unsigned int size() const { return SIZE; }
+
+private:
+
+    std::array<Record, SIZE> _records {};  ///< table records
+
+    constexpr unsigned int findIndex(KEY_TYPE key_value) const
+    {
+        // invariant: _records[lo].key <= key_value < _records[hi].key
+        unsigned int lo = 0;
+        unsigned int hi = SIZE - 1;
+
+        while (hi - lo > 1)
+        {
+            unsigned int mid = (lo + hi) / 2;
+
+            if (key_value < _records[mid].key)
+                hi = mid;
+            else
+                lo = mid;
+        }
+
+        return lo;
+    }
+
+    constexpr void updateInterpolationData()
+    {
+        for (unsigned int i = 0; i + 1 < SIZE; ++i)
+        {
+            const double dk = static_cast<double>(_records[i+1].key - _records[i].key);
+            const double dv = static_cast<double>(_records[i+1].value - _records[i].value);
+
+            // division by zero is not a constant expression, such table is reported by isValid()
+            _records[i].slope = (dk != 0.0) ? dv / dk : std::numeric_limits<double>::quiet_NaN();
+        }
+    }
+
+    static constexpr bool isFinite(double val)
+    {
+        return val == val
+            && val <=  std::numeric_limits<double>::max()
+            && val >= -std::numeric_limits<double>::max();
+    }
+};
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_FIXEDTABLE_H_
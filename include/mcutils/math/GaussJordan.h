@@ -25,41 +25,35 @@
 #include <mcutils/Result.h>
 
 #include <mcutils/math/Matrix.h>
+#include <mcutils/math/MatrixX.h>
 #include <mcutils/math/Vector.h>
+#include <mcutils/math/VectorX.h>
 
 namespace mc {
 
+namespace detail {
+
 /**
- * \brief Solves system of linear equations using Gauss-Jordan method.
- *
- * ### References:
- * - Press W., et al.: Numerical Recipes: The Art of Scientific Computing, 2007, p.41
- * - Baron B., Piatek L.: Metody numeryczne w C++ Builder, 2004, p.34. [in Polish]
- * - [Gaussian elimination - Wikipedia](https://en.wikipedia.org/wiki/Gaussian_elimination)
- *
- * \tparam TYPE type of the matrix and vector
- * \tparam SIZE size of the matrix and vector
- *
- * \param mtr left hand side matrix
- * \param rhs right hand size vector
+ * \brief Gauss-Jordan elimination shared by fixed and dynamic size solvers.
+ * \tparam MATRIX matrix type
+ * \tparam VECTOR vector type
+ * \param mtr_temp working copy of the left hand side matrix
+ * \param rhs_temp working copy of the right hand side vector
+ * \param size size of the matrix and vector
  * \param x result vector
  * \param eps minimum value treated as not-zero
- *
  * \return mc::Result::Success on success and mc::Result::Failure on failure
  */
-template <typename TYPE, unsigned int SIZE>
-Result solveGaussJordan(const MatrixNxN<TYPE, SIZE>& mtr, const VectorN<TYPE, SIZE>& rhs,
-                        VectorN<TYPE, SIZE>* x, double eps = 1.0e-9)
+template <typename MATRIX, typename VECTOR>
+Result gaussJordanElimination(MATRIX mtr_temp, VECTOR rhs_temp, unsigned int size,
+                              VECTOR* x, double eps)
 {
-    MatrixNxN<TYPE, SIZE> mtr_temp = mtr;
-    VectorN<TYPE, SIZE>   rhs_temp = rhs;
-
-    for (unsigned int r = 0; r < SIZE; ++r)
+    for (unsigned int r = 0; r < size; ++r)
     {
         // run along diagonal, swapping rows to move zeros (outside the diagonal) downwards
         if (fabs(mtr_temp(r,r)) < fabs(eps))
         {
-            if ( r < SIZE - 1 )
+            if ( r < size - 1 )
             {
                 mtr_temp.swapRows(r, r+1);
                 rhs_temp.swapRows(r, r+1);
@@ -75,7 +69,7 @@ Result solveGaussJordan(const MatrixNxN<TYPE, SIZE>& mtr, const VectorN<TYPE, SI
         double a_rr_inv = 1.0 / a_rr;
 
         // deviding current row by value on diagonal
-        for (unsigned int c = 0; c < SIZE; ++c)
+        for (unsigned int c = 0; c < size; ++c)
         {
             mtr_temp(r,c) *= a_rr_inv;
         }
@@ -86,12 +80,12 @@ Result solveGaussJordan(const MatrixNxN<TYPE, SIZE>& mtr, const VectorN<TYPE, SI
         // for every row current row is multiplied by A(i,r)
         // where r stands for row that is substracted from other rows
         // and i stands for row that is substracting from
-        for (unsigned int i = 0; i < SIZE; ++i)
+        for (unsigned int i = 0; i < size; ++i)
         {
             if (i != r)
             {
                 double a_ir = mtr_temp(i,r);
-                for (unsigned int c = 0; c < SIZE; ++c)
+                for (unsigned int c = 0; c < size; ++c)
                 {
                     mtr_temp(i,c) -= a_ir * mtr_temp(r,c);
                 }
@@ -106,6 +100,60 @@ Result solveGaussJordan(const MatrixNxN<TYPE, SIZE>& mtr, const VectorN<TYPE, SI
     return Result::Success;
 }
 
+} // namespace detail
+
+/**
+ * \brief Solves system of linear equations using Gauss-Jordan method.
+ *
+ * ### References:
+ * - Press W., et al.: Numerical Recipes: The Art of Scientific Computing, 2007, p.41
+ * - Baron B., Piatek L.: Metody numeryczne w C++ Builder, 2004, p.34. [in Polish]
+ * - [Gaussian elimination - Wikipedia](https://en.wikipedia.org/wiki/Gaussian_elimination)
+ *
+ * \tparam TYPE type of the matrix and vector
+ * \tparam SIZE size of the matrix and vector
+ *
+ * \param mtr left hand side matrix
+ * \param rhs right hand size vector
+ * \param x result vector
+ * \param eps minimum value treated as not-zero
+ *
+ * \return mc::Result::Success on success and mc::Result::Failure on failure
+ */
+template <typename TYPE, unsigned int SIZE>
+Result solveGaussJordan(const MatrixNxN<TYPE, SIZE>& mtr, const VectorN<TYPE, SIZE>& rhs,
+                        VectorN<TYPE, SIZE>* x, double eps = 1.0e-9)
+{
+    return detail::gaussJordanElimination(mtr, rhs, SIZE, x, eps);
+}
+
+/**
+ * \brief Solves system of linear equations using Gauss-Jordan method.
+ *
+ * Dynamic size version of the solver, see solveGaussJordan() for fixed size
+ * matrices and vectors.
+ *
+ * \tparam TYPE type of the matrix and vector
+ *
+ * \param mtr left hand side square matrix
+ * \param rhs right hand size vector
+ * \param x result vector
+ * \param eps minimum value treated as not-zero
+ *
+ * \return mc::Result::Success on success and mc::Result::Failure on failure
+ */
+template <typename TYPE>
+Result solveGaussJordan(const MatrixX<TYPE>& mtr, const VectorX<TYPE>& rhs,
+                        VectorX<TYPE>* x, double eps = 1.0e-9)
+{
+    if (mtr.rows() != mtr.cols() || mtr.rows() != rhs.size())
+    {
+        return Result::Failure;
+    }
+
+    return detail::gaussJordanElimination(mtr, rhs, rhs.size(), x, eps);
+}
+
 } // namespace mc
 
 #endif // MCUTILS_MATH_GAUSSJORDAN_H_
@@ -0,0 +1,353 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_GAUSSJORDANBATCH_H_
+#define MCUTILS_MATH_GAUSSJORDANBATCH_H_
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <mcutils/Result.h>
+
+#include <mcutils/math/Matrix.h>
+#include <mcutils/math/Vector.h>
+
+namespace mc {
+
+/**
+ * \brief Number of systems solved together by solveGaussJordanBatch().
+ * Each of the systems occupies one lane of the interleaved working arrays,
+ * which is enough to fill AVX registers of floats and two AVX registers
+ * of doubles.
+ */
+constexpr unsigned int kGaussJordanBatchLanes = 8;
+
+namespace detail {
+
+/**
+ * \brief Solves up to kGaussJordanBatchLanes systems at once.
+ *
+ * Matrices and vectors are copied into arrays interleaved by the system
+ * index, so the innermost loops run over the systems and are vectorized
+ * by the compiler. Unused lanes are filled with identity matrices.
+ *
+ * \param mtr left hand side matrices
+ * \param rhs right hand side vectors
+ * \param x result vectors, left unchanged for singular systems
+ * \param count number of systems, not greater than kGaussJordanBatchLanes
+ * \param results output results for every system, may be nullptr
+ * \param eps minimum pivot value treated as not-zero
+ * \return true if all of the systems were solved, false otherwise
+ */
+template <typename TYPE, unsigned int SIZE>
+bool solveGaussJordanBlock(const MatrixNxN<TYPE, SIZE>* mtr, const VectorN<TYPE, SIZE>* rhs,
+                           VectorN<TYPE, SIZE>* x, unsigned int count,
+                           Result* results, double eps)
+{
+    constexpr unsigned int kLanes = kGaussJordanBatchLanes;
+
+    alignas(64) TYPE a[SIZE][SIZE][kLanes];
+    alignas(64) TYPE b[SIZE][kLanes];
+    bool singular[kLanes] = {};
+
+    // interleaving
+    for (unsigned int l = 0; l < kLanes; ++l)
+    {
+        if (l < count)
+        {
+            const TYPE* m = mtr[l].data();
+            const TYPE* v = rhs[l].data();
+            for (unsigned int r = 0; r < SIZE; ++r)
+            {
+                for (unsigned int c = 0; c < SIZE; ++c)
+                {
+                    a[r][c][l] = m[r * SIZE + c];
+                }
+                b[r][l] = v[r];
+            }
+        }
+        else
+        {
+            for (unsigned int r = 0; r < SIZE; ++r)
+            {
+                for (unsigned int c = 0; c < SIZE; ++c)
+                {
+                    a[r][c][l] = r == c ? TYPE{1} : TYPE{0};
+                }
+                b[r][l] = TYPE{0};
+            }
+        }
+    }
+
+    for (unsigned int k = 0; k < SIZE; ++k)
+    {
+        // partial pivoting, pivot row is selected and swapped separately
+        // for every system, it is copied to the separate array, so the
+        // compiler can vectorize the loops using it
+        alignas(64) TYPE a_k[SIZE][kLanes];
+        alignas(64) TYPE b_k[kLanes];
+        for (unsigned int l = 0; l < kLanes; ++l)
+        {
+            unsigned int p = k;
+            TYPE a_max = std::fabs(a[k][k][l]);
+            for (unsigned int r = k + 1; r < SIZE; ++r)
+            {
+                if (std::fabs(a[r][k][l]) > a_max)
+                {
+                    a_max = std::fabs(a[r][k][l]);
+                    p = r;
+                }
+            }
+
+            if (static_cast<double>(a_max) < std::fabs(eps))
+            {
+                singular[l] = true;
+            }
+
+            // columns before k are already zeroed in both rows
+            for (unsigned int c = k; c < SIZE; ++c)
+            {
+                a_k[c][l] = a[p][c][l];
+                a[p][c][l] = a[k][c][l];
+            }
+            b_k[l] = b[p][l];
+            b[p][l] = b[k][l];
+        }
+
+        // deviding pivot row by value on diagonal, singular systems
+        // get zero instead, which keeps the values finite
+        TYPE a_kk_inv[kLanes];
+        for (unsigned int l = 0; l < kLanes; ++l)
+        {
+            a_kk_inv[l] = a_k[k][l] != TYPE{0} ? TYPE{1} / a_k[k][l] : TYPE{0};
+        }
+        for (unsigned int c = k; c < SIZE; ++c)
+        {
+            for (unsigned int l = 0; l < kLanes; ++l)
+            {
+                a_k[c][l] *= a_kk_inv[l];
+                a[k][c][l] = a_k[c][l];
+            }
+        }
+        for (unsigned int l = 0; l < kLanes; ++l)
+        {
+            b_k[l] *= a_kk_inv[l];
+            b[k][l] = b_k[l];
+        }
+
+        // substracting pivot row from others rows
+        for (unsigned int r = 0; r < SIZE; ++r)
+        {
+            if (r != k)
+            {
+                TYPE a_rk[kLanes];
+                for (unsigned int l = 0; l < kLanes; ++l)
+                {
+                    a_rk[l] = a[r][k][l];
+                }
+                for (unsigned int c = k; c < SIZE; ++c)
+                {
+                    for (unsigned int l = 0; l < kLanes; ++l)
+                    {
+                        a[r][c][l] -= a_rk[l] * a_k[c][l];
+                    }
+                }
+                for (unsigned int l = 0; l < kLanes; ++l)
+                {
+                    b[r][l] -= a_rk[l] * b_k[l];
+                }
+            }
+        }
+    }
+
+    // deinterleaving
+    bool success = true;
+    for (unsigned int l = 0; l < count; ++l)
+    {
+        if (singular[l])
+        {
+            success = false;
+        }
+        else
+        {
+            TYPE* v = x[l].data();
+            for (unsigned int r = 0; r < SIZE; ++r)
+            {
+                v[r] = b[r][l];
+            }
+        }
+
+        if (results)
+        {
+            results[l] = singular[l] ? Result::Failure : Result::Success;
+        }
+    }
+
+    return success;
+}
+
+/**
+ * \brief Solves range of systems block by block.
+ * \return true if all of the systems were solved, false otherwise
+ */
+template <typename TYPE, unsigned int SIZE>
+bool solveGaussJordanRange(const MatrixNxN<TYPE, SIZE>* mtr, const VectorN<TYPE, SIZE>* rhs,
+                           VectorN<TYPE, SIZE>* x, unsigned int count,
+                           Result* results, double eps)
+{
+    bool success = true;
+    for (unsigned int i = 0; i < count; i += kGaussJordanBatchLanes)
+    {
+        const unsigned int n = std::min(kGaussJordanBatchLanes, count - i);
+        if (!solveGaussJordanBlock(mtr + i, rhs + i, x + i, n,
+                                   results ? results + i : nullptr, eps))
+        {
+            success = false;
+        }
+    }
+    return success;
+}
+
+} // namespace detail
+
+/**
+ * \brief Solves many independent systems of linear equations using
+ * Gauss-Jordan method.
+ *
+ * Systems are processed in groups of kGaussJordanBatchLanes. Each group is
+ * copied into arrays interleaved by the system index, so that SIMD lanes
+ * work on different systems, which makes the batch considerably faster
+ * than calling solveGaussJordan() for each system separately. Unlike
+ * solveGaussJordan() it uses partial pivoting.
+ *
+ * If threads is greater than 1 the batch is split into that many parts
+ * solved by separate threads. It pays off only for large batches. Disjoint
+ * parts of the arrays can also be passed to this function from an
+ * existing thread pool.
+ *
+ * ### References:
+ * - Press W., et al.: Numerical Recipes: The Art of Scientific Computing, 2007, p.41
+ * - [Gaussian elimination - Wikipedia](https://en.wikipedia.org/wiki/Gaussian_elimination)
+ *
+ * \tparam TYPE type of the matrices and vectors elements
+ * \tparam SIZE size of the matrices and vectors
+ *
+ * \param mtr array of left hand side matrices
+ * \param rhs array of right hand side vectors
+ * \param x array of result vectors, left unchanged for singular systems
+ * \param count number of systems
+ * \param results output array of results for every system, may be nullptr
+ * \param eps minimum value treated as not-zero
+ * \param threads number of threads
+ *
+ * \return mc::Result::Success if all of the systems were solved and mc::Result::Failure otherwise
+ */
+template <typename TYPE, unsigned int SIZE>
+requires std::is_floating_point<TYPE>::value
+Result solveGaussJordanBatch(const MatrixNxN<TYPE, SIZE>* mtr, const VectorN<TYPE, SIZE>* rhs,
+                             VectorN<TYPE, SIZE>* x, unsigned int count,
+                             Result* results = nullptr, double eps = 1.0e-9,
+                             unsigned int threads = 1)
+{
+    const unsigned int blocks = (count + kGaussJordanBatchLanes - 1) / kGaussJordanBatchLanes;
+    threads = std::max(1u, std::min(threads, blocks));
+
+    if (threads == 1)
+    {
+        return detail::solveGaussJordanRange(mtr, rhs, x, count, results, eps)
+                ? Result::Success : Result::Failure;
+    }
+
+    // parts are multiples of the block size, so only the last one is partial
+    const unsigned int part = ((blocks + threads - 1) / threads) * kGaussJordanBatchLanes;
+
+    std::vector<char> success(threads, 1);
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (unsigned int t = 1; t < threads; ++t)
+    {
+        const unsigned int first = t * part;
+        if (first >= count) break;
+        const unsigned int n = std::min(part, count - first);
+        workers.emplace_back([=, &success]()
+        {
+            success[t] = detail::solveGaussJordanRange(mtr + first, rhs + first, x + first, n,
+                                                       results ? results + first : nullptr, eps);
+        });
+    }
+
+    success[0] = detail::solveGaussJordanRange(mtr, rhs, x, std::min(part, count), results, eps);
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    return std::all_of(success.begin(), success.end(), [](char s) { return s != 0; })
+            ? Result::Success : Result::Failure;
+}
+
+/**
+ * \brief Solves many independent systems of linear equations using
+ * Gauss-Jordan method.
+ *
+ * \tparam TYPE type of the matrices and vectors elements
+ * \tparam SIZE size of the matrices and vectors
+ *
+ * \param mtr left hand side matrices
+ * \param rhs right hand side vectors, the same number as matrices
+ * \param x result vectors, resized if needed
+ * \param results output results for every system, resized if needed, may be nullptr
+ * \param eps minimum value treated as not-zero
+ * \param threads number of threads
+ *
+ * \return mc::Result::Success if all of the systems were solved and mc::Result::Failure otherwise
+ */
+template <typename TYPE, unsigned int SIZE>
+requires std::is_floating_point<TYPE>::value
+Result solveGaussJordanBatch(const std::vector<MatrixNxN<TYPE, SIZE>>& mtr,
+                             const std::vector<VectorN<TYPE, SIZE>>& rhs,
+                             std::vector<VectorN<TYPE, SIZE>>* x,
+                             std::vector<Result>* results = nullptr,
+                             double eps = 1.0e-9, unsigned int threads = 1)
+{
+    if (mtr.size() != rhs.size())
+    {
+        return Result::Failure;
+    }
+
+    x->resize(mtr.size());
+    if (results)
+    {
+        results->resize(mtr.size());
+    }
+
+    return solveGaussJordanBatch(mtr.data(), rhs.data(), x->data(),
+                                 static_cast<unsigned int>(mtr.size()),
+                                 results ? results->data() : nullptr, eps, threads);
+}
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_GAUSSJORDANBATCH_H_
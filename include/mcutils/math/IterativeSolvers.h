@@ -0,0 +1,336 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_ITERATIVESOLVERS_H_
+#define MCUTILS_MATH_ITERATIVESOLVERS_H_
+
+#include <cmath>
+
+#include <mcutils/Result.h>
+
+#include <mcutils/math/MatrixX.h>
+#include <mcutils/math/SparseMatrix.h>
+#include <mcutils/math/VectorX.h>
+
+namespace mc {
+
+/**
+ * \brief Preconditioner used by the iterative solvers.
+ */
+enum class Preconditioner
+{
+    None   = 0,     ///< no preconditioning
+    Jacobi = 1      ///< Jacobi (diagonal) preconditioning
+};
+
+namespace detail {
+
+/**
+ * \brief Returns inverse of the preconditioner matrix.
+ * For Jacobi preconditioner it is the inverse of the matrix diagonal,
+ * zeros on the diagonal are replaced with ones.
+ * \param mtr sparse or dense matrix
+ * \param precond preconditioner
+ * \param result output inverse of the preconditioner diagonal
+ */
+template <typename MATRIX, typename TYPE>
+void getPreconditionerInverse(const MATRIX& mtr, Preconditioner precond, VectorX<TYPE>* result)
+{
+    result->resize(mtr.rows());
+    for (unsigned int i = 0; i < mtr.rows(); ++i)
+    {
+        (*result)(i) = TYPE{1};
+    }
+
+    if (precond == Preconditioner::Jacobi)
+    {
+        VectorX<TYPE> diag;
+        if constexpr (requires { mtr.getDiagonal(); })
+        {
+            diag = mtr.getDiagonal();
+        }
+        else
+        {
+            diag.resize(mtr.rows());
+            for (unsigned int i = 0; i < mtr.rows(); ++i)
+            {
+                diag(i) = mtr(i, i);
+            }
+        }
+
+        for (unsigned int i = 0; i < diag.size(); ++i)
+        {
+            if (diag(i) != TYPE{0})
+            {
+                (*result)(i) = TYPE{1} / diag(i);
+            }
+        }
+    }
+}
+
+} // namespace detail
+
+/**
+ * \brief Solves system of linear equations using preconditioned Conjugate
+ * Gradient method.
+ *
+ * The matrix has to be symmetric positive-definite. Each iteration costs
+ * one matrix by vector product, so for sparse matrices it is proportional
+ * to the number of non-zero elements, instead of O(n^3) of the direct
+ * solvers. Iterations stop when the residual norm falls below
+ * eps times the right hand side norm.
+ *
+ * ### References:
+ * - Saad Y.: Iterative Methods for Sparse Linear Systems, 2003, p.276
+ * - [Conjugate gradient method - Wikipedia](https://en.wikipedia.org/wiki/Conjugate_gradient_method)
+ *
+ * \tparam MATRIX matrix type, SparseMatrixCSR, SparseMatrixCSC or MatrixX
+ * \tparam TYPE type of the vectors elements
+ *
+ * \param mtr left hand side matrix
+ * \param rhs right hand size vector
+ * \param x result vector, used as an initial guess if it has proper size
+ * \param eps relative residual tolerance
+ * \param max_iter maximum number of iterations
+ * \param precond preconditioner
+ * \param iterations output number of iterations done, may be nullptr
+ *
+ * \return mc::Result::Success on success and mc::Result::Failure on failure
+ */
+template <typename MATRIX, typename TYPE>
+Result solveConjugateGradient(const MATRIX& mtr, const VectorX<TYPE>& rhs, VectorX<TYPE>* x,
+                              double eps = 1.0e-9, unsigned int max_iter = 1000,
+                              Preconditioner precond = Preconditioner::Jacobi,
+                              unsigned int* iterations = nullptr)
+{
+    const unsigned int n = rhs.size();
+    if (mtr.rows() != n || mtr.cols() != n)
+    {
+        return Result::Failure;
+    }
+
+    if (x->size() != n)
+    {
+        x->resize(n);
+    }
+
+    VectorX<TYPE> m_inv;
+    detail::getPreconditionerInverse(mtr, precond, &m_inv);
+
+    VectorX<TYPE> r(n);
+    VectorX<TYPE> z(n);
+    VectorX<TYPE> p(n);
+    VectorX<TYPE> ap(n);
+
+    multiplyMatrixByVector(mtr, *x, &ap);
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        r(i) = rhs(i) - ap(i);
+        z(i) = m_inv(i) * r(i);
+        p(i) = z(i);
+    }
+
+    const double tol = eps * static_cast<double>(rhs.getLength());
+    TYPE rz = r * z;
+
+    for (unsigned int it = 0; it < max_iter; ++it)
+    {
+        if (iterations) *iterations = it;
+
+        if (static_cast<double>(r.getLength()) <= tol)
+        {
+            return Result::Success;
+        }
+
+        multiplyMatrixByVector(mtr, p, &ap);
+        const TYPE pap = p * ap;
+        if (!(pap > TYPE{0}))
+        {
+            // matrix is not positive-definite
+            return Result::Failure;
+        }
+
+        const TYPE alpha = rz / pap;
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            (*x)(i) += alpha * p(i);
+            r(i) -= alpha * ap(i);
+            z(i) = m_inv(i) * r(i);
+        }
+
+        const TYPE rz_new = r * z;
+        const TYPE beta = rz_new / rz;
+        rz = rz_new;
+
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            p(i) = z(i) + beta * p(i);
+        }
+    }
+
+    if (iterations) *iterations = max_iter;
+
+    return static_cast<double>(r.getLength()) <= tol ? Result::Success : Result::Failure;
+}
+
+/**
+ * \brief Solves system of linear equations using preconditioned
+ * Biconjugate Gradient Stabilized (BiCGSTAB) method.
+ *
+ * Unlike Conjugate Gradient method it does not require the matrix to be
+ * symmetric. Each iteration costs two matrix by vector products.
+ * Iterations stop when the residual norm falls below eps times the right
+ * hand side norm.
+ *
+ * ### References:
+ * - van der Vorst H.: Bi-CGSTAB: A Fast and Smoothly Converging Variant of Bi-CG for the Solution of Nonsymmetric Linear Systems, 1992
+ * - Saad Y.: Iterative Methods for Sparse Linear Systems, 2003, p.244
+ * - [Biconjugate gradient stabilized method - Wikipedia](https://en.wikipedia.org/wiki/Biconjugate_gradient_stabilized_method)
+ *
+ * \tparam MATRIX matrix type, SparseMatrixCSR, SparseMatrixCSC or MatrixX
+ * \tparam TYPE type of the vectors elements
+ *
+ * \param mtr left hand side matrix
+ * \param rhs right hand size vector
+ * \param x result vector, used as an initial guess if it has proper size
+ * \param eps relative residual tolerance
+ * \param max_iter maximum number of iterations
+ * \param precond preconditioner
+ * \param iterations output number of iterations done, may be nullptr
+ *
+ * \return mc::Result::Success on success and mc::Result::Failure on failure
+ */
+template <typename MATRIX, typename TYPE>
+Result solveBiCGSTAB(const MATRIX& mtr, const VectorX<TYPE>& rhs, VectorX<TYPE>* x,
+                     double eps = 1.0e-9, unsigned int max_iter = 1000,
+                     Preconditioner precond = Preconditioner::Jacobi,
+                     unsigned int* iterations = nullptr)
+{
+    const unsigned int n = rhs.size();
+    if (mtr.rows() != n || mtr.cols() != n)
+    {
+        return Result::Failure;
+    }
+
+    if (x->size() != n)
+    {
+        x->resize(n);
+    }
+
+    VectorX<TYPE> m_inv;
+    detail::getPreconditionerInverse(mtr, precond, &m_inv);
+
+    VectorX<TYPE> r(n);
+    VectorX<TYPE> r_hat(n);
+    VectorX<TYPE> p(n);
+    VectorX<TYPE> v(n);
+    VectorX<TYPE> y(n);
+    VectorX<TYPE> s(n);
+    VectorX<TYPE> z(n);
+    VectorX<TYPE> t(n);
+
+    multiplyMatrixByVector(mtr, *x, &v);
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        r(i) = rhs(i) - v(i);
+    }
+    r_hat = r;
+    v.zeroize();
+
+    const double tol = eps * static_cast<double>(rhs.getLength());
+
+    TYPE rho   = TYPE{1};
+    TYPE alpha = TYPE{1};
+    TYPE omega = TYPE{1};
+
+    for (unsigned int it = 0; it < max_iter; ++it)
+    {
+        if (iterations) *iterations = it;
+
+        if (static_cast<double>(r.getLength()) <= tol)
+        {
+            return Result::Success;
+        }
+
+        const TYPE rho_new = r_hat * r;
+        if (rho_new == TYPE{0} || omega == TYPE{0})
+        {
+            // breakdown
+            return Result::Failure;
+        }
+
+        const TYPE beta = (rho_new / rho) * (alpha / omega);
+        rho = rho_new;
+
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            p(i) = r(i) + beta * (p(i) - omega * v(i));
+            y(i) = m_inv(i) * p(i);
+        }
+
+        multiplyMatrixByVector(mtr, y, &v);
+        const TYPE r_hat_v = r_hat * v;
+        if (r_hat_v == TYPE{0})
+        {
+            // breakdown
+            return Result::Failure;
+        }
+        alpha = rho / r_hat_v;
+
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            s(i) = r(i) - alpha * v(i);
+        }
+
+        if (static_cast<double>(s.getLength()) <= tol)
+        {
+            for (unsigned int i = 0; i < n; ++i)
+            {
+                (*x)(i) += alpha * y(i);
+            }
+            if (iterations) *iterations = it + 1;
+            return Result::Success;
+        }
+
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            z(i) = m_inv(i) * s(i);
+        }
+
+        multiplyMatrixByVector(mtr, z, &t);
+        const TYPE tt = t * t;
+        omega = tt > TYPE{0} ? (t * s) / tt : TYPE{0};
+
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            (*x)(i) += alpha * y(i) + omega * z(i);
+            r(i) = s(i) - omega * t(i);
+        }
+    }
+
+    if (iterations) *iterations = max_iter;
+
+    return static_cast<double>(r.getLength()) <= tol ? Result::Success : Result::Failure;
+}
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_ITERATIVESOLVERS_H_
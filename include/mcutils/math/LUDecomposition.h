@@ -0,0 +1,276 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_LUDECOMPOSITION_H_
+#define MCUTILS_MATH_LUDECOMPOSITION_H_
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <mcutils/Result.h>
+
+#include <mcutils/math/Matrix.h>
+#include <mcutils/math/Vector.h>
+
+namespace mc {
+
+/**
+ * \brief LU decomposition with partial pivoting of a square matrix.
+ *
+ * Decomposes matrix as P*A = L*U, where P is permutation matrix, L is lower
+ * triangular matrix with unit diagonal and U is upper triangular matrix.
+ * Once decomposed, the factorization can be reused to solve systems of linear
+ * equations with the same left hand side matrix and many right hand side
+ * vectors at the cost of forward and back substitution only.
+ *
+ * ### References:
+ * - Press W., et al.: Numerical Recipes: The Art of Scientific Computing, 2007, p.48
+ * - Golub G., Van Loan C.: Matrix Computations, 2013, p.111
+ * - [LU decomposition - Wikipedia](https://en.wikipedia.org/wiki/LU_decomposition)
+ *
+ * \tparam TYPE type of the matrix elements
+ * \tparam SIZE size of the matrix
+ */
+template <typename TYPE, unsigned int SIZE>
+requires std::is_floating_point<TYPE>::value
+class LUDecomposition
+{
+public:
+
+    /** \brief Constructor. */
+    LUDecomposition() = default;
+
+    /**
+     * \brief Constructor.
+     * \param mtr matrix to be decomposed
+     * \param eps minimum value treated as not-zero
+     */
+    explicit LUDecomposition(const MatrixNxN<TYPE, SIZE>& mtr, double eps = 1.0e-9)
+    {
+        decompose(mtr, eps);
+    }
+
+    /**
+     * \brief Decomposes matrix.
+     * \param mtr matrix to be decomposed
+     * \param eps minimum value treated as not-zero
+     * \return mc::Result::Success on success and mc::Result::Failure if the matrix is singular
+     */
+    Result decompose(const MatrixNxN<TYPE, SIZE>& mtr, double eps = 1.0e-9)
+    {
+        _lu = mtr;
+        _sign = 1;
+        _valid = true;
+
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            _perm[i] = i;
+        }
+
+        for (unsigned int k = 0; k < SIZE; ++k)
+        {
+            // partial pivoting, row with the largest absolute value in the current column
+            unsigned int p = k;
+            for (unsigned int i = k + 1; i < SIZE; ++i)
+            {
+                if (fabs(_lu(i,k)) > fabs(_lu(p,k)))
+                {
+                    p = i;
+                }
+            }
+
+            if (fabs(_lu(p,k)) < fabs(eps))
+            {
+                _valid = false;
+                return Result::Failure;
+            }
+
+            if (p != k)
+            {
+                _lu.swapRows(p, k);
+                std::swap(_perm[p], _perm[k]);
+                _sign = -_sign;
+            }
+
+            const TYPE a_kk_inv = TYPE{1} / _lu(k,k);
+            for (unsigned int i = k + 1; i < SIZE; ++i)
+            {
+                _lu(i,k) *= a_kk_inv;
+                const TYPE l_ik = _lu(i,k);
+                for (unsigned int j = k + 1; j < SIZE; ++j)
+                {
+                    _lu(i,j) -= l_ik * _lu(k,j);
+                }
+            }
+        }
+
+        return Result::Success;
+    }
+
+    /**
+     * \brief Solves system of linear equations A*x = rhs.
+     * \param rhs right hand side vector
+     * \param x result vector, may be the same object as rhs
+     * \return mc::Result::Success on success and mc::Result::Failure if the decomposition is not valid
+     */
+    Result solve(const VectorN<TYPE, SIZE>& rhs, VectorN<TYPE, SIZE>* x) const
+    {
+        if (!_valid)
+        {
+            return Result::Failure;
+        }
+
+        VectorN<TYPE, SIZE> y;
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            y(i) = rhs(_perm[i]);
+        }
+
+        // forward substitution, L has unit diagonal
+        for (unsigned int i = 1; i < SIZE; ++i)
+        {
+            for (unsigned int j = 0; j < i; ++j)
+            {
+                y(i) -= _lu(i,j) * y(j);
+            }
+        }
+
+        // back substitution
+        for (unsigned int i = SIZE; i-- > 0;)
+        {
+            for (unsigned int j = i + 1; j < SIZE; ++j)
+            {
+                y(i) -= _lu(i,j) * y(j);
+            }
+            y(i) /= _lu(i,i);
+        }
+
+        *x = y;
+
+        return Result::Success;
+    }
+
+    /**
+     * \brief Calculates inverse of the decomposed matrix.
+     * \param inv result inverse matrix
+     * \return mc::Result::Success on success and mc::Result::Failure if the decomposition is not valid
+     */
+    Result getInverse(MatrixNxN<TYPE, SIZE>* inv) const
+    {
+        if (!_valid)
+        {
+            return Result::Failure;
+        }
+
+        VectorN<TYPE, SIZE> col;
+        for (unsigned int c = 0; c < SIZE; ++c)
+        {
+            VectorN<TYPE, SIZE> e;
+            e(c) = TYPE{1};
+            solve(e, &col);
+            for (unsigned int r = 0; r < SIZE; ++r)
+            {
+                (*inv)(r,c) = col(r);
+            }
+        }
+
+        return Result::Success;
+    }
+
+    /**
+     * \brief Returns determinant of the decomposed matrix.
+     * \return determinant of the decomposed matrix, zero if the matrix is singular
+     */
+    TYPE getDeterminant() const
+    {
+        if (!_valid)
+        {
+            return TYPE{0};
+        }
+
+        TYPE det = static_cast<TYPE>(_sign);
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            det *= _lu(i,i);
+        }
+        return det;
+    }
+
+    /**
+     * \brief Returns combined L and U matrices.
+     * Elements below diagonal are elements of L (without unit diagonal),
+     * elements on and above diagonal are elements of U.
+     */
+    inline const MatrixNxN<TYPE, SIZE>& getLU() const { return _lu; }
+
+    /**
+     * \brief Returns row permutation index.
+     * \param row row index of the decomposed matrix
+     * \return index of the original matrix row
+     */
+    inline unsigned int getPermutation(unsigned int row) const { return _perm[row]; }
+
+    /** \brief Returns true if the decomposition is valid, false otherwise. */
+    inline bool isValid() const { return _valid; }
+
+private:
+
+    MatrixNxN<TYPE, SIZE> _lu;      ///< combined L and U matrices
+    unsigned int _perm[SIZE] = {};  ///< row permutation
+    int _sign = 1;                  ///< permutation sign
+    bool _valid = false;            ///< specifies if decomposition is valid
+};
+
+/**
+ * \brief Calculates determinant of the matrix using LU decomposition.
+ * \tparam TYPE type of the matrix elements
+ * \tparam SIZE size of the matrix
+ * \param mtr matrix
+ * \return determinant of the matrix
+ */
+template <typename TYPE, unsigned int SIZE>
+requires std::is_floating_point<TYPE>::value
+TYPE calculateDeterminant(const MatrixNxN<TYPE, SIZE>& mtr)
+{
+    return LUDecomposition<TYPE, SIZE>(mtr, std::numeric_limits<TYPE>::min()).getDeterminant();
+}
+
+/**
+ * \brief Inverts matrix using LU decomposition.
+ * \tparam TYPE type of the matrix elements
+ * \tparam SIZE size of the matrix
+ * \param mtr matrix to be inverted
+ * \param inv result inverse matrix
+ * \param eps minimum value treated as not-zero
+ * \return mc::Result::Success on success and mc::Result::Failure if the matrix is singular
+ */
+template <typename TYPE, unsigned int SIZE>
+requires std::is_floating_point<TYPE>::value
+Result invertMatrix(const MatrixNxN<TYPE, SIZE>& mtr, MatrixNxN<TYPE, SIZE>* inv, double eps = 1.0e-9)
+{
+    return LUDecomposition<TYPE, SIZE>(mtr, eps).getInverse(inv);
+}
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_LUDECOMPOSITION_H_
@@ -0,0 +1,333 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_LAZYEXPR_H_
+#define MCUTILS_MATH_LAZYEXPR_H_
+
+#include <type_traits>
+#include <utility>
+
+#include <mcutils/units.h>
+
+namespace mc {
+
+/**
+ * \brief Base class of the lazy element-wise expressions.
+ *
+ * Lazy expressions are built with lazy() and the +, - and scalar * and /
+ * operators. No arithmetic is done until the expression is assigned to
+ * a VectorN, Vector3 or MatrixMxN (or passed to evaluateLazyExpr()), then
+ * the whole expression is evaluated in a single loop, without temporary
+ * vectors or matrices, e.g.
+ * \code
+ * mc::Vector6d y = mc::lazy(y0) + (mc::lazy(k1) + mc::lazy(k2) * 2.0) * dt;
+ * \endcode
+ *
+ * Element types of the expression are the results of the element
+ * operations, so unit types combine the same way as in the eager
+ * operators, e.g. meters per second multiplied by seconds gives meters.
+ *
+ * Expressions keep references to the vectors and matrices they were built
+ * from, so they should be evaluated in the same full-expression.
+ */
+struct LazyExprBase {};
+
+/**
+ * \brief Checks if the given type is a lazy expression.
+ * \tparam T type to be checked
+ */
+template <typename T>
+concept LazyExprType = std::is_base_of_v<LazyExprBase, std::remove_cvref_t<T>>;
+
+/**
+ * \brief Checks if the given type is a fixed size container usable in lazy
+ * expressions (VectorN, Vector3, MatrixMxN and derived).
+ * \tparam T type to be checked
+ */
+template <typename T>
+concept LazyContainerType = requires (const T& c)
+{
+    T::kSize;
+    c(0u);
+};
+
+/**
+ * \brief Lazy expression referencing a vector or a matrix.
+ * \tparam CONTAINER vector or matrix type
+ */
+template <typename CONTAINER>
+class LazyRef : public LazyExprBase
+{
+public:
+
+    using ValueType = std::remove_cvref_t<decltype(std::declval<const CONTAINER&>()(0u))>;
+
+    static constexpr unsigned int kSize = CONTAINER::kSize;
+
+    static constexpr unsigned int kRows = [] {
+        if constexpr (requires { CONTAINER::kRows; }) return CONTAINER::kRows; else return CONTAINER::kSize;
+    }();
+
+    static constexpr unsigned int kCols = [] {
+        if constexpr (requires { CONTAINER::kCols; }) return CONTAINER::kCols; else return 1u;
+    }();
+
+    explicit LazyRef(const CONTAINER& container) : _container(container) {}
+
+    inline ValueType operator[](unsigned int index) const { return _container(index); }
+
+private:
+
+    const CONTAINER& _container;    ///< referenced vector or matrix
+};
+
+/**
+ * \brief Lazy element-wise sum or difference of two expressions.
+ * \tparam LHS left-hand side expression type
+ * \tparam RHS right-hand side expression type
+ * \tparam SUBTRACT true for difference, false for sum
+ */
+template <typename LHS, typename RHS, bool SUBTRACT>
+class LazySum : public LazyExprBase
+{
+    static_assert(LHS::kRows == RHS::kRows && LHS::kCols == RHS::kCols,
+                  "Expression operands dimensions do not match.");
+
+public:
+
+    using ValueType = std::remove_cvref_t<std::conditional_t<SUBTRACT,
+        decltype(std::declval<typename LHS::ValueType>() - std::declval<typename RHS::ValueType>()),
+        decltype(std::declval<typename LHS::ValueType>() + std::declval<typename RHS::ValueType>())
+    >>;
+
+    static constexpr unsigned int kSize = LHS::kSize;
+    static constexpr unsigned int kRows = LHS::kRows;
+    static constexpr unsigned int kCols = LHS::kCols;
+
+    LazySum(const LHS& lhs, const RHS& rhs) : _lhs(lhs), _rhs(rhs) {}
+
+    inline ValueType operator[](unsigned int index) const
+    {
+        if constexpr (SUBTRACT)
+            return _lhs[index] - _rhs[index];
+        else
+            return _lhs[index] + _rhs[index];
+    }
+
+private:
+
+    LHS _lhs;   ///< left-hand side expression
+    RHS _rhs;   ///< right-hand side expression
+};
+
+/**
+ * \brief Lazy expression multiplied by a scalar.
+ * \tparam EXPR expression type
+ * \tparam SCALAR scalar type
+ */
+template <typename EXPR, typename SCALAR>
+class LazyScaled : public LazyExprBase
+{
+public:
+
+    using ValueType = std::remove_cvref_t<decltype(
+        std::declval<typename EXPR::ValueType>() * std::declval<SCALAR>()
+    )>;
+
+    static constexpr unsigned int kSize = EXPR::kSize;
+    static constexpr unsigned int kRows = EXPR::kRows;
+    static constexpr unsigned int kCols = EXPR::kCols;
+
+    LazyScaled(const EXPR& expr, const SCALAR& val) : _expr(expr), _val(val) {}
+
+    inline ValueType operator[](unsigned int index) const { return _expr[index] * _val; }
+
+private:
+
+    EXPR _expr;     ///< expression
+    SCALAR _val;    ///< scalar value
+};
+
+/**
+ * \brief Lazy negated expression.
+ * \tparam EXPR expression type
+ */
+template <typename EXPR>
+class LazyNegated : public LazyExprBase
+{
+public:
+
+    using ValueType = typename EXPR::ValueType;
+
+    static constexpr unsigned int kSize = EXPR::kSize;
+    static constexpr unsigned int kRows = EXPR::kRows;
+    static constexpr unsigned int kCols = EXPR::kCols;
+
+    explicit LazyNegated(const EXPR& expr) : _expr(expr) {}
+
+    inline ValueType operator[](unsigned int index) const { return -_expr[index]; }
+
+private:
+
+    EXPR _expr;     ///< expression
+};
+
+/**
+ * \brief Starts lazy expression.
+ *
+ * For vectors and matrices returns expression referencing them. Other values,
+ * e.g. scalars, are returned as they are, so generic code like numerical
+ * integrators works for both.
+ *
+ * \param val vector, matrix or other value
+ * \return lazy expression or the value itself
+ */
+template <typename T>
+decltype(auto) lazy(const T& val)
+{
+    if constexpr (LazyContainerType<T> && !LazyExprType<T>)
+        return LazyRef<T>(val);
+    else
+        return (val);
+}
+
+/**
+ * \brief Evaluates lazy expression into a vector or a matrix.
+ * \tparam EXPR expression type
+ * \tparam CONTAINER vector or matrix type
+ * \param expr expression to be evaluated
+ * \param result output result vector or matrix, may be one of the operands
+ */
+template <typename EXPR, typename CONTAINER>
+requires (LazyExprType<EXPR> && EXPR::kSize == CONTAINER::kSize)
+void evaluateLazyExpr(const EXPR& expr, CONTAINER* result)
+{
+    for (unsigned int i = 0; i < EXPR::kSize; ++i)
+    {
+        (*result)(i) = expr[i];
+    }
+}
+
+/**
+ * \brief Checks if the given type can be an operand of a lazy expression.
+ * \tparam T type to be checked
+ */
+template <typename T>
+concept LazyOperandType = LazyExprType<T> || LazyContainerType<T>;
+
+/**
+ * \brief Checks if the given type can be a scalar in a lazy expression.
+ * \tparam T type to be checked
+ */
+template <typename T>
+concept LazyScalarType = std::is_arithmetic<T>::value || units::traits::is_unit_t<T>::value;
+
+/**
+ * \brief Addition operator.
+ * \param lhs left-hand side expression, vector or matrix
+ * \param rhs right-hand side expression, vector or matrix
+ * \return lazy sum expression
+ */
+template <typename LHS, typename RHS>
+requires (
+    LazyOperandType<LHS> && LazyOperandType<RHS> &&
+    (LazyExprType<LHS> || LazyExprType<RHS>)
+)
+auto operator+(const LHS& lhs, const RHS& rhs)
+{
+    using L = std::remove_cvref_t<decltype(lazy(lhs))>;
+    using R = std::remove_cvref_t<decltype(lazy(rhs))>;
+    return LazySum<L, R, false>(lazy(lhs), lazy(rhs));
+}
+
+/**
+ * \brief Subtraction operator.
+ * \param lhs left-hand side expression, vector or matrix
+ * \param rhs right-hand side expression, vector or matrix
+ * \return lazy difference expression
+ */
+template <typename LHS, typename RHS>
+requires (
+    LazyOperandType<LHS> && LazyOperandType<RHS> &&
+    (LazyExprType<LHS> || LazyExprType<RHS>)
+)
+auto operator-(const LHS& lhs, const RHS& rhs)
+{
+    using L = std::remove_cvref_t<decltype(lazy(lhs))>;
+    using R = std::remove_cvref_t<decltype(lazy(rhs))>;
+    return LazySum<L, R, true>(lazy(lhs), lazy(rhs));
+}
+
+/**
+ * \brief Negation operator.
+ * \param expr expression
+ * \return lazy negated expression
+ */
+template <typename EXPR>
+requires LazyExprType<EXPR>
+auto operator-(const EXPR& expr)
+{
+    return LazyNegated<EXPR>(expr);
+}
+
+/**
+ * \brief Multiplication by a scalar operator.
+ * \param expr expression
+ * \param val scalar value
+ * \return lazy scaled expression
+ */
+template <typename EXPR, typename SCALAR>
+requires (LazyExprType<EXPR> && LazyScalarType<SCALAR>)
+auto operator*(const EXPR& expr, const SCALAR& val)
+{
+    return LazyScaled<EXPR, SCALAR>(expr, val);
+}
+
+/**
+ * \brief Multiplication by a scalar operator.
+ * \param val scalar value
+ * \param expr expression
+ * \return lazy scaled expression
+ */
+template <typename SCALAR, typename EXPR>
+requires (LazyExprType<EXPR> && LazyScalarType<SCALAR>)
+auto operator*(const SCALAR& val, const EXPR& expr)
+{
+    return LazyScaled<EXPR, SCALAR>(expr, val);
+}
+
+/**
+ * \brief Division by a scalar operator.
+ * \param expr expression
+ * \param val scalar value
+ * \return lazy scaled expression
+ */
+template <typename EXPR, typename SCALAR>
+requires (LazyExprType<EXPR> && LazyScalarType<SCALAR>)
+auto operator/(const EXPR& expr, const SCALAR& val)
+{
+    using InvType = std::remove_cvref_t<decltype(1.0 / val)>;
+    return LazyScaled<EXPR, InvType>(expr, 1.0 / val);
+}
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_LAZYEXPR_H_
@@ -22,6 +22,8 @@
 #ifndef MCUTILS_MATH_MATRIX_H_
 #define MCUTILS_MATH_MATRIX_H_
 
+#include <type_traits>
+
 #include <mcutils/mcutils_api.h>
 #include <mcutils/units.h>
 #include <mcutils/math/MatrixMxN.h>
@@ -36,6 +38,11 @@ extern template class MCUTILS_API MatrixMxN<double, 3, 3>;
 extern template class MCUTILS_API MatrixNxN<double, 3>;
 extern template class MCUTILS_API Matrix3x3<double>;
 
+// matrices are plain row-major arrays of elements, without vtable or padding
+static_assert(sizeof(Matrix3x3d) == 9 * sizeof(double));
+static_assert(std::is_standard_layout_v<Matrix3x3d>);
+static_assert(std::is_trivially_copyable_v<Matrix3x3d>);
+
 using Matrix4x4d = MatrixNxN<double, 4>;
 
 using Matrix6x6d = MatrixNxN<double, 6>;
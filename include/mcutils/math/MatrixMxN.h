@@ -36,6 +36,8 @@
 #include <vector>
 
 #include <mcutils/units.h>
+#include <mcutils/math/LazyExpr.h>
+#include <mcutils/math/Simd.h>
 #include <mcutils/math/Vector.h>
 #include <mcutils/misc/Check.h>
 #include <mcutils/misc/StringUtils.h>
@@ -69,11 +71,24 @@ public:
     MatrixMxN() = default;
     MatrixMxN(const MatrixMxN&) = default;
     MatrixMxN(MatrixMxN&&) = default;
-    virtual ~MatrixMxN() = default;
+    ~MatrixMxN() = default;
     MatrixMxN& operator=(const MatrixMxN&) = default;
     MatrixMxN& operator=(MatrixMxN&&) = default;
     // LCOV_EXCL_STOP
 
+    /**
+     * \brief Constructor.
+     * Evaluates lazy expression in a single loop.
+     * \tparam EXPR expression type
+     * \param expr lazy expression, see LazyExprBase
+     */
+    template <typename EXPR>
+    requires (LazyExprType<EXPR> && EXPR::kRows == ROWS && EXPR::kCols == COLS)
+    MatrixMxN(const EXPR& expr)
+    {
+        evaluateLazyExpr(expr, this);
+    }
+
     /**
      * \brief Fills all matrix elements with the given value.
      * \param val given value to fill all matrix elements
@@ -335,6 +350,12 @@ public:
         return _elements[index];
     }
 
+    /** \return pointer to the matrix elements stored in row-major order */
+    inline const TYPE* data() const { return _elements; }
+
+    /** \return pointer to the matrix elements stored in row-major order */
+    inline TYPE* data() { return _elements; }
+
     /**
      * \brief Addition operator.
      * \param matrix matrix to be added
@@ -962,6 +983,7 @@ void multiplyMatrixByVector(
 {
     for (unsigned int r = 0; r < ROWS; ++r)
     {
+        (*result)(r) = RESULT_TYPE{0};
         for (unsigned int c = 0; c < COLS; ++c)
         {
             (*result)(r) += mat(r,c) * vect(c);
@@ -997,6 +1019,243 @@ void multiplyMatrixByMatrix(
     }
 }
 
+#if defined(MCUTILS_SIMD_DOUBLE2)
+
+/**
+ * \brief Multiplication a 3x3 matrix by a vector algorithm.
+ *
+ * SIMD overload for doubles. The first two elements of the result are
+ * computed at once from the matrix columns, the last one as a dot product.
+ *
+ * \param mat matrix
+ * \param vect vector
+ * \param result output result vector
+ */
+inline void multiplyMatrixByVector(
+    const MatrixMxN<double, 3, 3>& mat,
+    const VectorN<double, 3>& vect,
+    VectorN<double, 3>* result
+)
+{
+    const double* m = mat.data();
+    const double* v = vect.data();
+
+    const simd::Double2 r0 = simd::load2(m);
+    const simd::Double2 r1 = simd::load2(m + 3);
+
+    simd::Double2 y01 = simd::mul2(simd::unpackLo2(r0, r1), simd::set2(v[0]));
+    y01 = simd::fma2(simd::unpackHi2(r0, r1), simd::set2(v[1]), y01);
+    y01 = simd::fma2(simd::set2(m[2], m[5]), simd::set2(v[2]), y01);
+
+    const double y2 = m[6] * v[0] + m[7] * v[1] + m[8] * v[2];
+
+    simd::store2(result->data(), y01);
+    (*result)(2) = y2;
+}
+
+/**
+ * \brief Multiplication a 3x3 matrix by a 3x3 matrix algorithm.
+ *
+ * SIMD overload for doubles. Every row of the result is computed as a linear
+ * combination of the right-hand side matrix rows.
+ *
+ * \param lhs left-hand side matrix
+ * \param rhs right-hand side matrix
+ * \param result output result matrix
+ */
+inline void multiplyMatrixByMatrix(
+    const MatrixMxN<double, 3, 3>& lhs,
+    const MatrixMxN<double, 3, 3>& rhs,
+    MatrixMxN<double, 3, 3>* result
+)
+{
+    const double* a = lhs.data();
+    const double* b = rhs.data();
+    double* c = result->data();
+
+#   if defined(__AVX__)
+    // the 4th lane of the first two rows holds the first element of the next
+    // row and is overwritten when the next row is stored, the last row is
+    // loaded and stored masked not to touch memory past the matrix end
+    const __m256i mask = _mm256_setr_epi64x(-1, -1, -1, 0);
+    const __m256d b0 = _mm256_loadu_pd(b);
+    const __m256d b1 = _mm256_loadu_pd(b + 3);
+    const __m256d b2 = _mm256_maskload_pd(b + 6, mask);
+
+    __m256d c0 = _mm256_mul_pd(_mm256_set1_pd(a[0]), b0);
+    __m256d c1 = _mm256_mul_pd(_mm256_set1_pd(a[3]), b0);
+    __m256d c2 = _mm256_mul_pd(_mm256_set1_pd(a[6]), b0);
+    c0 = simd::fma4(_mm256_set1_pd(a[1]), b1, c0);
+    c1 = simd::fma4(_mm256_set1_pd(a[4]), b1, c1);
+    c2 = simd::fma4(_mm256_set1_pd(a[7]), b1, c2);
+    c0 = simd::fma4(_mm256_set1_pd(a[2]), b2, c0);
+    c1 = simd::fma4(_mm256_set1_pd(a[5]), b2, c1);
+    c2 = simd::fma4(_mm256_set1_pd(a[8]), b2, c2);
+
+    _mm256_storeu_pd(c, c0);
+    _mm256_storeu_pd(c + 3, c1);
+    _mm256_maskstore_pd(c + 6, mask, c2);
+#   else
+    const simd::Double2 b0 = simd::load2(b);
+    const simd::Double2 b1 = simd::load2(b + 3);
+    const simd::Double2 b2 = simd::load2(b + 6);
+
+    // first two columns
+    simd::Double2 c0 = simd::mul2(simd::set2(a[0]), b0);
+    simd::Double2 c1 = simd::mul2(simd::set2(a[3]), b0);
+    simd::Double2 c2 = simd::mul2(simd::set2(a[6]), b0);
+    c0 = simd::fma2(simd::set2(a[1]), b1, c0);
+    c1 = simd::fma2(simd::set2(a[4]), b1, c1);
+    c2 = simd::fma2(simd::set2(a[7]), b1, c2);
+    c0 = simd::fma2(simd::set2(a[2]), b2, c0);
+    c1 = simd::fma2(simd::set2(a[5]), b2, c1);
+    c2 = simd::fma2(simd::set2(a[8]), b2, c2);
+
+    // last column, the first two rows at once
+    simd::Double2 c3 = simd::mul2(simd::set2(a[0], a[3]), simd::set2(b[2]));
+    c3 = simd::fma2(simd::set2(a[1], a[4]), simd::set2(b[5]), c3);
+    c3 = simd::fma2(simd::set2(a[2], a[5]), simd::set2(b[8]), c3);
+    const double c22 = a[6] * b[2] + a[7] * b[5] + a[8] * b[8];
+
+    double c02_c12[2];
+    simd::store2(c02_c12, c3);
+    simd::store2(c, c0);
+    simd::store2(c + 3, c1);
+    simd::store2(c + 6, c2);
+    c[2] = c02_c12[0];
+    c[5] = c02_c12[1];
+    c[8] = c22;
+#   endif
+}
+
+/**
+ * \brief Multiplication a 4x4 matrix by a vector algorithm.
+ *
+ * SIMD overload for doubles.
+ *
+ * \param mat matrix
+ * \param vect vector
+ * \param result output result vector
+ */
+inline void multiplyMatrixByVector(
+    const MatrixMxN<double, 4, 4>& mat,
+    const VectorN<double, 4>& vect,
+    VectorN<double, 4>* result
+)
+{
+    const double* m = mat.data();
+    const double* v = vect.data();
+
+#   if defined(__AVX__)
+    const __m256d v4 = _mm256_loadu_pd(v);
+    const __m256d p0 = _mm256_mul_pd(_mm256_loadu_pd(m     ), v4);
+    const __m256d p1 = _mm256_mul_pd(_mm256_loadu_pd(m +  4), v4);
+    const __m256d p2 = _mm256_mul_pd(_mm256_loadu_pd(m +  8), v4);
+    const __m256d p3 = _mm256_mul_pd(_mm256_loadu_pd(m + 12), v4);
+
+    // horizontal sums of the row products
+    const __m256d h01 = _mm256_hadd_pd(p0, p1);
+    const __m256d h23 = _mm256_hadd_pd(p2, p3);
+    const __m256d lo = _mm256_permute2f128_pd(h01, h23, 0x20);
+    const __m256d hi = _mm256_permute2f128_pd(h01, h23, 0x31);
+
+    _mm256_storeu_pd(result->data(), _mm256_add_pd(lo, hi));
+#   else
+    const simd::Double2 v0 = simd::set2(v[0]);
+    const simd::Double2 v1 = simd::set2(v[1]);
+    const simd::Double2 v2 = simd::set2(v[2]);
+    const simd::Double2 v3 = simd::set2(v[3]);
+
+    // two rows at once from the matrix columns
+    for (unsigned int r = 0; r < 4; r += 2)
+    {
+        const simd::Double2 ra_lo = simd::load2(m + 4 * r);
+        const simd::Double2 ra_hi = simd::load2(m + 4 * r + 2);
+        const simd::Double2 rb_lo = simd::load2(m + 4 * r + 4);
+        const simd::Double2 rb_hi = simd::load2(m + 4 * r + 6);
+
+        simd::Double2 y = simd::mul2(simd::unpackLo2(ra_lo, rb_lo), v0);
+        y = simd::fma2(simd::unpackHi2(ra_lo, rb_lo), v1, y);
+        y = simd::fma2(simd::unpackLo2(ra_hi, rb_hi), v2, y);
+        y = simd::fma2(simd::unpackHi2(ra_hi, rb_hi), v3, y);
+
+        simd::store2(result->data() + r, y);
+    }
+#   endif
+}
+
+/**
+ * \brief Multiplication a 4x4 matrix by a 4x4 matrix algorithm.
+ *
+ * SIMD overload for doubles. Every row of the result is computed as a linear
+ * combination of the right-hand side matrix rows.
+ *
+ * \param lhs left-hand side matrix
+ * \param rhs right-hand side matrix
+ * \param result output result matrix
+ */
+inline void multiplyMatrixByMatrix(
+    const MatrixMxN<double, 4, 4>& lhs,
+    const MatrixMxN<double, 4, 4>& rhs,
+    MatrixMxN<double, 4, 4>* result
+)
+{
+    const double* a = lhs.data();
+    const double* b = rhs.data();
+
+#   if defined(__AVX__)
+    const __m256d b0 = _mm256_loadu_pd(b);
+    const __m256d b1 = _mm256_loadu_pd(b +  4);
+    const __m256d b2 = _mm256_loadu_pd(b +  8);
+    const __m256d b3 = _mm256_loadu_pd(b + 12);
+
+    __m256d c[4];
+    for (unsigned int r = 0; r < 4; ++r)
+    {
+        c[r] = _mm256_mul_pd(_mm256_set1_pd(a[4 * r]), b0);
+        c[r] = simd::fma4(_mm256_set1_pd(a[4 * r + 1]), b1, c[r]);
+        c[r] = simd::fma4(_mm256_set1_pd(a[4 * r + 2]), b2, c[r]);
+        c[r] = simd::fma4(_mm256_set1_pd(a[4 * r + 3]), b3, c[r]);
+    }
+
+    for (unsigned int r = 0; r < 4; ++r)
+    {
+        _mm256_storeu_pd(result->data() + 4 * r, c[r]);
+    }
+#   else
+    simd::Double2 b_lo[4];
+    simd::Double2 b_hi[4];
+    for (unsigned int k = 0; k < 4; ++k)
+    {
+        b_lo[k] = simd::load2(b + 4 * k);
+        b_hi[k] = simd::load2(b + 4 * k + 2);
+    }
+
+    simd::Double2 c_lo[4];
+    simd::Double2 c_hi[4];
+    for (unsigned int r = 0; r < 4; ++r)
+    {
+        const simd::Double2 a0 = simd::set2(a[4 * r]);
+        c_lo[r] = simd::mul2(a0, b_lo[0]);
+        c_hi[r] = simd::mul2(a0, b_hi[0]);
+        for (unsigned int k = 1; k < 4; ++k)
+        {
+            const simd::Double2 ak = simd::set2(a[4 * r + k]);
+            c_lo[r] = simd::fma2(ak, b_lo[k], c_lo[r]);
+            c_hi[r] = simd::fma2(ak, b_hi[k], c_hi[r]);
+        }
+    }
+
+    for (unsigned int r = 0; r < 4; ++r)
+    {
+        simd::store2(result->data() + 4 * r    , c_lo[r]);
+        simd::store2(result->data() + 4 * r + 2, c_hi[r]);
+    }
+#   endif
+}
+
+#endif // MCUTILS_SIMD_DOUBLE2
+
 /** 
  * \brief Matrix transposition algorithm. 
  * \tparam TYPE type of the matrix elements
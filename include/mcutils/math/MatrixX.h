@@ -0,0 +1,617 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_MATRIXX_H_
+#define MCUTILS_MATH_MATRIXX_H_
+
+#include <algorithm>
+#include <cassert>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <mcutils/math/DynamicStorage.h>
+#include <mcutils/math/Matrix.h>
+#include <mcutils/math/VectorX.h>
+#include <mcutils/misc/Check.h>
+
+namespace mc {
+
+/**
+ * \brief A template class representing a matrix with dimensions known
+ * at run-time.
+ *
+ * It is meant for problems which dimensions are known only after loading
+ * a model. The matrix elements are stored in a row-major order. Matrices
+ * of up to kInlineSize elements (4x4) do not allocate. Matrices can be
+ * constructed from MatrixMxN and converted back with getMatrixMxN().
+ *
+ * Please notice that dimensions of the operands are checked with assertions only.
+ *
+ * \tparam TYPE matrix elements type
+ */
+template <typename TYPE>
+requires std::is_arithmetic<TYPE>::value
+class MatrixX
+{
+public:
+
+    static constexpr unsigned int kInlineSize = 16; ///< number of elements stored without allocation
+
+    /**
+     * \brief Creates identity matrix.
+     * \param size number of rows and columns
+     */
+    static MatrixX<TYPE> getIdentityMatrix(unsigned int size)
+    {
+        MatrixX<TYPE> result(size, size);
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            result(i,i) = TYPE{1};
+        }
+        return result;
+    }
+
+    // LCOV_EXCL_START
+    MatrixX() = default;
+    MatrixX(const MatrixX<TYPE>&) = default;
+    MatrixX(MatrixX<TYPE>&&) = default;
+    ~MatrixX() = default;
+    MatrixX<TYPE>& operator=(const MatrixX<TYPE>&) = default;
+    MatrixX<TYPE>& operator=(MatrixX<TYPE>&&) = default;
+    // LCOV_EXCL_STOP
+
+    /**
+     * \brief Constructor.
+     * \param rows number of rows
+     * \param cols number of columns
+     */
+    MatrixX(unsigned int rows, unsigned int cols)
+    {
+        resize(rows, cols);
+    }
+
+    /**
+     * \brief Converting constructor.
+     * \tparam ROWS number of rows of the fixed size matrix
+     * \tparam COLS number of columns of the fixed size matrix
+     * \param mat fixed size matrix
+     */
+    template <unsigned int ROWS, unsigned int COLS>
+    MatrixX(const MatrixMxN<TYPE, ROWS, COLS>& mat)
+        : _elements(ROWS * COLS)
+        , _rows(ROWS)
+        , _cols(COLS)
+    {
+        std::copy(mat.data(), mat.data() + ROWS * COLS, data());
+    }
+
+    /**
+     * \brief Returns fixed size matrix.
+     * \tparam ROWS number of rows, has to be equal to the matrix number of rows
+     * \tparam COLS number of columns, has to be equal to the matrix number of columns
+     * \return fixed size matrix
+     */
+    template <unsigned int ROWS, unsigned int COLS>
+    MatrixMxN<TYPE, ROWS, COLS> getMatrixMxN() const
+    {
+        assert(_rows == ROWS && _cols == COLS);
+        MatrixMxN<TYPE, ROWS, COLS> result;
+        std::copy(data(), data() + ROWS * COLS, result.data());
+        return result;
+    }
+
+    /** \return number of rows */
+    inline unsigned int rows() const { return _rows; }
+
+    /** \return number of columns */
+    inline unsigned int cols() const { return _cols; }
+
+    /** \return number of elements */
+    inline unsigned int size() const { return _elements.size(); }
+
+    /**
+     * \brief Resizes matrix.
+     * \param rows new number of rows
+     * \param cols new number of columns
+     */
+    void resize(unsigned int rows, unsigned int cols)
+    {
+        _elements.resize(rows * cols);
+        _rows = rows;
+        _cols = cols;
+        zeroize();
+    }
+
+    /**
+     * \brief Checks if all elements in the matrix are valid.
+     * \return true if all elements are valid, false otherwise
+     */
+    bool isValid() const
+    {
+        return check::isValid(data(), size());
+    }
+
+    /** \brief Returns transposed matrix. */
+    MatrixX<TYPE> getTransposed() const
+    {
+        MatrixX<TYPE> result(_cols, _rows);
+        transposeMatrix(*this, &result);
+        return result;
+    }
+
+    /**
+     * \brief Gets std::vector of matrix elements in a row-major order.
+     * \return std::vector<TYPE> of matrix elements
+     */
+    std::vector<TYPE> getStdVector() const
+    {
+        return std::vector<TYPE>(data(), data() + size());
+    }
+
+    /**
+     * \brief Sets matrix elements from std::vector.
+     * \param elements input std::vector of matrix elements in a row-major order
+     */
+    void setFromStdVector(const std::vector<TYPE>& elements)
+    {
+        assert(elements.size() == size());
+        std::copy(elements.begin(), elements.end(), data());
+    }
+
+    /**
+     * \brief Swaps two rows of the matrix.
+     * \param row1 index of the first row
+     * \param row2 index of the second row
+     */
+    void swapRows(unsigned int row1, unsigned int row2)
+    {
+        if (row1 < _rows && row2 < _rows)
+        {
+            std::swap_ranges(data() + row1 * _cols, data() + (row1 + 1) * _cols, data() + row2 * _cols);
+        }
+    }
+
+    /**
+     * \brief Returns a string representation of the matrix.
+     * \return String representation of the matrix
+     */
+    std::string toString() const
+    {
+        std::stringstream ss;
+        for (unsigned int r = 0; r < _rows; ++r)
+        {
+            for (unsigned int c = 0; c < _cols; ++c)
+            {
+                if (r > 0 || c > 0) ss << "\t";
+                ss << (*this)(r,c);
+            }
+        }
+        return ss.str();
+    }
+
+    /**
+     * \brief Negates (inverts) the matrix.
+     */
+    void negate()
+    {
+        for (unsigned int i = 0; i < size(); ++i)
+        {
+            data()[i] = -data()[i];
+        }
+    }
+
+    /**
+     * \brief Sets all matrix elements to zero.
+     */
+    void zeroize()
+    {
+        std::fill(data(), data() + size(), TYPE{0});
+    }
+
+    /**
+     * \brief Elements accessor.
+     *
+     * Please notice that this operator is NOT bounds-checked.
+     *
+     * \param row element row number
+     * \param col element column number
+     * \return element at given row and column
+     */
+    inline TYPE operator()(unsigned int row, unsigned int col) const
+    {
+        return data()[row * _cols + col];
+    }
+
+    /**
+     * \brief Elements accessor.
+     *
+     * Please notice that this operator is NOT bounds-checked.
+     *
+     * \param row element row number
+     * \param col element column number
+     * \return element at given row and column
+     */
+    inline TYPE& operator()(unsigned int row, unsigned int col)
+    {
+        return data()[row * _cols + col];
+    }
+
+    /**
+     * \brief Elements accessor.
+     *
+     * Please notice that this operator is NOT bounds-checked.
+     *
+     * \param index element index in a row-major order
+     * \return element at given index
+     */
+    inline TYPE operator()(unsigned int index) const
+    {
+        return data()[index];
+    }
+
+    /**
+     * \brief Elements accessor.
+     *
+     * Please notice that this operator is NOT bounds-checked.
+     *
+     * \param index element index in a row-major order
+     * \return element at given index
+     */
+    inline TYPE& operator()(unsigned int index)
+    {
+        return data()[index];
+    }
+
+    /** \return pointer to the matrix elements */
+    inline const TYPE* data() const { return _elements.data(); }
+
+    /** \return pointer to the matrix elements */
+    inline TYPE* data() { return _elements.data(); }
+
+    /**
+     * \brief Addition operator.
+     * \param mat matrix to be added
+     * \return sum of the matrices
+     */
+    MatrixX<TYPE> operator+(const MatrixX<TYPE>& mat) const
+    {
+        MatrixX<TYPE> result(_rows, _cols);
+        addMatrices(*this, mat, &result);
+        return result;
+    }
+
+    /**
+     * \brief Negation operator.
+     * \return negated matrix
+     */
+    MatrixX<TYPE> operator-() const
+    {
+        MatrixX<TYPE> result(*this);
+        result.negate();
+        return result;
+    }
+
+    /**
+     * \brief Subtraction operator.
+     * \param mat matrix to be subtracted
+     * \return difference of the matrices
+     */
+    MatrixX<TYPE> operator-(const MatrixX<TYPE>& mat) const
+    {
+        MatrixX<TYPE> result(_rows, _cols);
+        subtractMatrices(*this, mat, &result);
+        return result;
+    }
+
+    /**
+     * \brief Multiplication by a scalar operator.
+     * \param val value to be multiplied by
+     * \return product of the matrix multiplied by the value
+     */
+    MatrixX<TYPE> operator*(TYPE val) const
+    {
+        MatrixX<TYPE> result(_rows, _cols);
+        multiplyMatrixByScalar(*this, val, &result);
+        return result;
+    }
+
+    /**
+     * \brief Multiplication by a vector operator.
+     * \param vect vector to be multiplied by
+     * \return product of the matrix multiplied by the vector
+     */
+    VectorX<TYPE> operator*(const VectorX<TYPE>& vect) const
+    {
+        VectorX<TYPE> result(_rows);
+        multiplyMatrixByVector(*this, vect, &result);
+        return result;
+    }
+
+    /**
+     * \brief Multiplication by a matrix operator.
+     * \param mat matrix to be multiplied by
+     * \return product of the matrices
+     */
+    MatrixX<TYPE> operator*(const MatrixX<TYPE>& mat) const
+    {
+        MatrixX<TYPE> result(_rows, mat.cols());
+        multiplyMatrixByMatrix(*this, mat, &result);
+        return result;
+    }
+
+    /**
+     * \brief Division by a scalar operator.
+     * \param val value to be divided by
+     * \return quotient of the matrix divided by the value
+     */
+    MatrixX<TYPE> operator/(TYPE val) const
+    {
+        MatrixX<TYPE> result(_rows, _cols);
+        multiplyMatrixByScalar(*this, TYPE{1} / val, &result);
+        return result;
+    }
+
+    /**
+     * \brief Unary addition operator.
+     * \param mat matrix to be added
+     * \return reference to this matrix
+     */
+    MatrixX<TYPE>& operator+=(const MatrixX<TYPE>& mat)
+    {
+        addMatrices(*this, mat, this);
+        return *this;
+    }
+
+    /**
+     * \brief Unary subtraction operator.
+     * \param mat matrix to be subtracted
+     * \return reference to this matrix
+     */
+    MatrixX<TYPE>& operator-=(const MatrixX<TYPE>& mat)
+    {
+        subtractMatrices(*this, mat, this);
+        return *this;
+    }
+
+    /**
+     * \brief Unary multiplication operator (by scalar).
+     * \param val value to be multiplied by
+     * \return reference to this matrix
+     */
+    MatrixX<TYPE>& operator*=(TYPE val)
+    {
+        multiplyMatrixByScalar(*this, val, this);
+        return *this;
+    }
+
+    /**
+     * \brief Unary division operator (by scalar).
+     * \param val value to be divided by
+     * \return reference to this matrix
+     */
+    MatrixX<TYPE>& operator/=(TYPE val)
+    {
+        multiplyMatrixByScalar(*this, TYPE{1} / val, this);
+        return *this;
+    }
+
+    /**
+     * \brief Equality operator.
+     * \param mat matrix to be compared with
+     * \return true if the matrices are equal, false otherwise
+     */
+    bool operator==(const MatrixX<TYPE>& mat) const
+    {
+        return _rows == mat._rows && _cols == mat._cols
+            && std::equal(data(), data() + size(), mat.data());
+    }
+
+    /**
+     * \brief Inequality operator.
+     * \param mat matrix to be compared with
+     * \return true if the matrices are not equal, false otherwise
+     */
+    bool operator!=(const MatrixX<TYPE>& mat) const
+    {
+        return !(*this == mat);
+    }
+
+private:
+
+    DynamicStorage<TYPE, kInlineSize> _elements;    ///< matrix elements
+    unsigned int _rows = 0;                         ///< number of rows
+    unsigned int _cols = 0;                         ///< number of columns
+};
+
+/**
+ * \brief Adds two matrices.
+ * \tparam TYPE type of the matrices elements
+ * \param lhs left-hand side matrix
+ * \param rhs right-hand side matrix
+ * \param result output result matrix, may be one of the operands
+ */
+template <typename TYPE>
+void addMatrices(const MatrixX<TYPE>& lhs, const MatrixX<TYPE>& rhs, MatrixX<TYPE>* result)
+{
+    assert(lhs.rows() == rhs.rows() && lhs.cols() == rhs.cols());
+    assert(lhs.rows() == result->rows() && lhs.cols() == result->cols());
+    for (unsigned int i = 0; i < lhs.size(); ++i)
+    {
+        (*result)(i) = lhs(i) + rhs(i);
+    }
+}
+
+/**
+ * \brief Subtracts two matrices.
+ * \tparam TYPE type of the matrices elements
+ * \param lhs left-hand side matrix
+ * \param rhs right-hand side matrix
+ * \param result output result matrix, may be one of the operands
+ */
+template <typename TYPE>
+void subtractMatrices(const MatrixX<TYPE>& lhs, const MatrixX<TYPE>& rhs, MatrixX<TYPE>* result)
+{
+    assert(lhs.rows() == rhs.rows() && lhs.cols() == rhs.cols());
+    assert(lhs.rows() == result->rows() && lhs.cols() == result->cols());
+    for (unsigned int i = 0; i < lhs.size(); ++i)
+    {
+        (*result)(i) = lhs(i) - rhs(i);
+    }
+}
+
+/**
+ * \brief Multiplication a matrix by a value.
+ * \tparam TYPE type of the matrix elements
+ * \param mat matrix
+ * \param val value to multiply the matrix by
+ * \param result output result matrix, may be the same as mat
+ */
+template <typename TYPE>
+void multiplyMatrixByScalar(const MatrixX<TYPE>& mat, TYPE val, MatrixX<TYPE>* result)
+{
+    assert(mat.rows() == result->rows() && mat.cols() == result->cols());
+    for (unsigned int i = 0; i < mat.size(); ++i)
+    {
+        (*result)(i) = mat(i) * val;
+    }
+}
+
+/**
+ * \brief Multiplication a matrix by a vector algorithm.
+ * \tparam TYPE type of the matrix and vectors elements
+ * \param mat matrix
+ * \param vect vector
+ * \param result output result vector, must not be the same as vect
+ */
+template <typename TYPE>
+void multiplyMatrixByVector(const MatrixX<TYPE>& mat, const VectorX<TYPE>& vect, VectorX<TYPE>* result)
+{
+    assert(mat.cols() == vect.size() && mat.rows() == result->size());
+    assert(&vect != result);
+    for (unsigned int r = 0; r < mat.rows(); ++r)
+    {
+        const TYPE* mat_row = mat.data() + r * mat.cols();
+        TYPE sum = TYPE{0};
+        for (unsigned int c = 0; c < mat.cols(); ++c)
+        {
+            sum += mat_row[c] * vect(c);
+        }
+        (*result)(r) = sum;
+    }
+}
+
+/**
+ * \brief Multiplication a matrix by a matrix algorithm.
+ *
+ * The product is computed in kBlockSize x kBlockSize tiles, so the tiles
+ * of all three matrices stay in cache while they are used. Within a tile
+ * the loops go in i-k-j order, so the innermost loop runs over contiguous
+ * rows of the right-hand side and result matrices and can be vectorized.
+ *
+ * \tparam TYPE type of the matrices elements
+ * \param lhs left-hand side matrix
+ * \param rhs right-hand side matrix
+ * \param result output result matrix, must not be one of the operands
+ */
+template <typename TYPE>
+void multiplyMatrixByMatrix(const MatrixX<TYPE>& lhs, const MatrixX<TYPE>& rhs, MatrixX<TYPE>* result)
+{
+    // 3 tiles of 64x64 doubles take 96 kB, which fits L2 cache of most CPUs
+    constexpr unsigned int kBlockSize = 64;
+
+    assert(lhs.cols() == rhs.rows());
+    assert(lhs.rows() == result->rows() && rhs.cols() == result->cols());
+    assert(&lhs != result && &rhs != result);
+
+    const unsigned int m = lhs.rows();
+    const unsigned int n = lhs.cols();
+    const unsigned int p = rhs.cols();
+
+    result->zeroize();
+
+    for (unsigned int i0 = 0; i0 < m; i0 += kBlockSize)
+    {
+        const unsigned int i1 = std::min(i0 + kBlockSize, m);
+        for (unsigned int k0 = 0; k0 < n; k0 += kBlockSize)
+        {
+            const unsigned int k1 = std::min(k0 + kBlockSize, n);
+            for (unsigned int j0 = 0; j0 < p; j0 += kBlockSize)
+            {
+                const unsigned int j1 = std::min(j0 + kBlockSize, p);
+                for (unsigned int i = i0; i < i1; ++i)
+                {
+                    TYPE* res_row = result->data() + i * p;
+                    const TYPE* lhs_row = lhs.data() + i * n;
+                    for (unsigned int k = k0; k < k1; ++k)
+                    {
+                        const TYPE a_ik = lhs_row[k];
+                        const TYPE* rhs_row = rhs.data() + k * p;
+                        for (unsigned int j = j0; j < j1; ++j)
+                        {
+                            res_row[j] += a_ik * rhs_row[j];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * \brief Transposes matrix.
+ * \tparam TYPE type of the matrix elements
+ * \param mat matrix to be transposed
+ * \param result output result matrix, must not be the same as mat
+ */
+template <typename TYPE>
+void transposeMatrix(const MatrixX<TYPE>& mat, MatrixX<TYPE>* result)
+{
+    assert(mat.rows() == result->cols() && mat.cols() == result->rows());
+    for (unsigned int r = 0; r < mat.rows(); ++r)
+    {
+        for (unsigned int c = 0; c < mat.cols(); ++c)
+        {
+            (*result)(c, r) = mat(r, c);
+        }
+    }
+}
+
+/**
+ * \brief Multiplication operator.
+ * \tparam LHS_TYPE type of the left-hand side scalar
+ * \tparam RHS_TYPE type of the right-hand side matrix elements
+ * \param val value to be multiplied by
+ * \param mat matrix to be multiplied
+ * \return product of the matrix multiplied by the value
+ */
+template <typename LHS_TYPE, typename RHS_TYPE>
+requires std::is_arithmetic<LHS_TYPE>::value
+MatrixX<RHS_TYPE> operator*(LHS_TYPE val, const MatrixX<RHS_TYPE>& mat)
+{
+    return mat * static_cast<RHS_TYPE>(val);
+}
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_MATRIXX_H_
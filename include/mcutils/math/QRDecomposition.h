@@ -0,0 +1,276 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_QRDECOMPOSITION_H_
+#define MCUTILS_MATH_QRDECOMPOSITION_H_
+
+#include <cmath>
+#include <type_traits>
+
+#include <mcutils/Result.h>
+
+#include <mcutils/math/Matrix.h>
+#include <mcutils/math/Vector.h>
+
+namespace mc {
+
+/**
+ * \brief QR decomposition of a square matrix using Householder reflections.
+ *
+ * Decomposes matrix as A = Q*R, where Q is orthogonal matrix and R is upper
+ * triangular matrix. It is about twice as expensive as LU decomposition,
+ * but numerically more stable for ill-conditioned matrices. Q is not formed
+ * explicitly, Householder vectors are kept instead.
+ *
+ * ### References:
+ * - Press W., et al.: Numerical Recipes: The Art of Scientific Computing, 2007, p.102
+ * - Golub G., Van Loan C.: Matrix Computations, 2013, p.246
+ * - [QR decomposition - Wikipedia](https://en.wikipedia.org/wiki/QR_decomposition)
+ *
+ * \tparam TYPE type of the matrix elements
+ * \tparam SIZE size of the matrix
+ */
+template <typename TYPE, unsigned int SIZE>
+requires std::is_floating_point<TYPE>::value
+class QRDecomposition
+{
+public:
+
+    /** \brief Constructor. */
+    QRDecomposition() = default;
+
+    /**
+     * \brief Constructor.
+     * \param mtr matrix to be decomposed
+     * \param eps minimum value treated as not-zero
+     */
+    explicit QRDecomposition(const MatrixNxN<TYPE, SIZE>& mtr, double eps = 1.0e-9)
+    {
+        decompose(mtr, eps);
+    }
+
+    /**
+     * \brief Decomposes matrix.
+     * \param mtr matrix to be decomposed
+     * \param eps minimum value treated as not-zero
+     * \return mc::Result::Success on success and mc::Result::Failure if the matrix is singular
+     */
+    Result decompose(const MatrixNxN<TYPE, SIZE>& mtr, double eps = 1.0e-9)
+    {
+        _qr = mtr;
+        _sign = 1;
+        _valid = true;
+
+        for (unsigned int k = 0; k < SIZE; ++k)
+        {
+            TYPE norm = TYPE{0};
+            for (unsigned int i = k; i < SIZE; ++i)
+            {
+                norm = hypot(norm, _qr(i,k));
+            }
+
+            if (norm != TYPE{0})
+            {
+                // Householder vector v = x/norm + e_k stored in place of the column
+                if (_qr(k,k) < TYPE{0})
+                {
+                    norm = -norm;
+                }
+
+                const TYPE norm_inv = TYPE{1} / norm;
+                for (unsigned int i = k; i < SIZE; ++i)
+                {
+                    _qr(i,k) *= norm_inv;
+                }
+                _qr(k,k) += TYPE{1};
+
+                // applying reflection to the remaining columns
+                for (unsigned int j = k + 1; j < SIZE; ++j)
+                {
+                    TYPE s = TYPE{0};
+                    for (unsigned int i = k; i < SIZE; ++i)
+                    {
+                        s += _qr(i,k) * _qr(i,j);
+                    }
+                    s = -s / _qr(k,k);
+                    for (unsigned int i = k; i < SIZE; ++i)
+                    {
+                        _qr(i,j) += s * _qr(i,k);
+                    }
+                }
+
+                _sign = -_sign;
+            }
+
+            _rdiag[k] = -norm;
+
+            if (fabs(_rdiag[k]) < fabs(eps))
+            {
+                _valid = false;
+            }
+        }
+
+        return _valid ? Result::Success : Result::Failure;
+    }
+
+    /**
+     * \brief Solves system of linear equations A*x = rhs.
+     * \param rhs right hand side vector
+     * \param x result vector, may be the same object as rhs
+     * \return mc::Result::Success on success and mc::Result::Failure if the decomposition is not valid
+     */
+    Result solve(const VectorN<TYPE, SIZE>& rhs, VectorN<TYPE, SIZE>* x) const
+    {
+        if (!_valid)
+        {
+            return Result::Failure;
+        }
+
+        VectorN<TYPE, SIZE> y = rhs;
+
+        // y = Q^T*rhs
+        for (unsigned int k = 0; k < SIZE; ++k)
+        {
+            TYPE s = TYPE{0};
+            for (unsigned int i = k; i < SIZE; ++i)
+            {
+                s += _qr(i,k) * y(i);
+            }
+            s = -s / _qr(k,k);
+            for (unsigned int i = k; i < SIZE; ++i)
+            {
+                y(i) += s * _qr(i,k);
+            }
+        }
+
+        // back substitution, R*x = y
+        for (unsigned int k = SIZE; k-- > 0;)
+        {
+            y(k) /= _rdiag[k];
+            for (unsigned int i = 0; i < k; ++i)
+            {
+                y(i) -= y(k) * _qr(i,k);
+            }
+        }
+
+        *x = y;
+
+        return Result::Success;
+    }
+
+    /**
+     * \brief Calculates inverse of the decomposed matrix.
+     * \param inv result inverse matrix
+     * \return mc::Result::Success on success and mc::Result::Failure if the decomposition is not valid
+     */
+    Result getInverse(MatrixNxN<TYPE, SIZE>* inv) const
+    {
+        if (!_valid)
+        {
+            return Result::Failure;
+        }
+
+        VectorN<TYPE, SIZE> col;
+        for (unsigned int c = 0; c < SIZE; ++c)
+        {
+            VectorN<TYPE, SIZE> e;
+            e(c) = TYPE{1};
+            solve(e, &col);
+            for (unsigned int r = 0; r < SIZE; ++r)
+            {
+                (*inv)(r,c) = col(r);
+            }
+        }
+
+        return Result::Success;
+    }
+
+    /**
+     * \brief Returns determinant of the decomposed matrix.
+     * Each Householder reflection has determinant -1.
+     * \return determinant of the decomposed matrix
+     */
+    TYPE getDeterminant() const
+    {
+        TYPE det = static_cast<TYPE>(_sign);
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            det *= _rdiag[i];
+        }
+        return det;
+    }
+
+    /** \brief Returns upper triangular matrix R. */
+    MatrixNxN<TYPE, SIZE> getR() const
+    {
+        MatrixNxN<TYPE, SIZE> result;
+        for (unsigned int r = 0; r < SIZE; ++r)
+        {
+            result(r,r) = _rdiag[r];
+            for (unsigned int c = r + 1; c < SIZE; ++c)
+            {
+                result(r,c) = _qr(r,c);
+            }
+        }
+        return result;
+    }
+
+    /** \brief Returns orthogonal matrix Q. */
+    MatrixNxN<TYPE, SIZE> getQ() const
+    {
+        MatrixNxN<TYPE, SIZE> result;
+        for (unsigned int k = SIZE; k-- > 0;)
+        {
+            result(k,k) = TYPE{1};
+            for (unsigned int j = k; j < SIZE; ++j)
+            {
+                if (_qr(k,k) != TYPE{0})
+                {
+                    TYPE s = TYPE{0};
+                    for (unsigned int i = k; i < SIZE; ++i)
+                    {
+                        s += _qr(i,k) * result(i,j);
+                    }
+                    s = -s / _qr(k,k);
+                    for (unsigned int i = k; i < SIZE; ++i)
+                    {
+                        result(i,j) += s * _qr(i,k);
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    /** \brief Returns true if the decomposition is valid, false otherwise. */
+    inline bool isValid() const { return _valid; }
+
+private:
+
+    MatrixNxN<TYPE, SIZE> _qr;      ///< Householder vectors and R matrix above diagonal
+    TYPE _rdiag[SIZE] = {};         ///< diagonal of R matrix
+    int _sign = 1;                  ///< determinant of Q matrix
+    bool _valid = false;            ///< specifies if decomposition is valid
+};
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_QRDECOMPOSITION_H_
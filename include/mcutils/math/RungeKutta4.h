@@ -23,12 +23,30 @@
 #define MCUTILS_MATH_RUNGEKUTTA4_H_
 
 #include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <mcutils/math/LazyExpr.h>
 
 namespace mc {
 
 /**
  * \brief Runge-Kutta 4th order numerical integration class template.
  *
+ * By default the derivative function is stored as std::function, which
+ * can be set at any time with setFun(). For performance critical code the
+ * derivative function type can be given as DERIV_FUN, e.g. a lambda or
+ * a function object type, so the calls are inlined, e.g.
+ * \code
+ * auto fun = [](const mc::Vector6d& s) { ... };
+ * mc::RungeKutta4<mc::Vector6d, double, decltype(fun)> rk(fun);
+ * rk.integrate(dt, &state);
+ * \endcode
+ *
+ * The derivative function is either called as `T_VALUE fun(const T_VALUE&)`
+ * or, if it accepts such arguments, as `void fun(const T_VALUE&, T_VALUE*)`
+ * writing derivative into the given value.
+ *
  * ### References:
  * - Press W., et al.: Numerical Recipes: The Art of Scientific Computing, 2007, p.907
  * - Krupowicz A.: Metody numeryczne zagadnien poczatkowych rownan rozniczkowych zwyczajnych, 1986, p.185. [in Polish]
@@ -37,13 +55,25 @@ namespace mc {
  *
  * \tparam T_VALUE type of the integrated value
  * \tparam T_STEP type of the integration step
+ * \tparam DERIV_FUN type of the derivative function
  */
-template <typename T_VALUE, typename T_STEP>
+template <typename T_VALUE, typename T_STEP,
+          typename DERIV_FUN = std::function<T_VALUE(const T_VALUE&)>>
 class RungeKutta4
 {
 public:
 
-    using DerivFun = std::function<T_VALUE(const T_VALUE&)>;
+    using DerivFun = DERIV_FUN;
+
+    RungeKutta4() = default;
+
+    /**
+     * \brief Constructor.
+     * \param fun function which calculates vector derivative
+     */
+    explicit RungeKutta4(DerivFun fun)
+        : _fun(std::move(fun))
+    {}
 
     /**
      * \brief Integrates using Runge-Kutta 4th order integration algorithm.
@@ -53,34 +83,68 @@ public:
      */
     T_VALUE integrate(T_STEP dx, const T_VALUE& yn)
     {
-        T_VALUE y0 = yn;
+        T_VALUE result = yn;
+        integrate(dx, &result);
+        return result;
+    }
+
+    /**
+     * \brief Integrates in place using Runge-Kutta 4th order integration algorithm.
+     * Intermediate values are kept on the stack, so for fixed size vectors
+     * no memory is allocated.
+     * \param dx integration step
+     * \param y value to be integrated, replaced by the integration result
+     */
+    void integrate(T_STEP dx, T_VALUE* y)
+    {
+        T_VALUE y0;
+        T_VALUE k1;
+        T_VALUE k2;
+        T_VALUE k3;
+        T_VALUE k4;
 
         // k1 - derivatives calculation
-        T_VALUE k1 = _fun(y0);
+        calcDeriv(*y, &k1);
+
+        // vectors and matrices sums are evaluated lazily in a single loop,
+        // without temporaries, see LazyExprBase
 
         // k2 - derivatives calculation
-        y0 = yn + k1 * (dx / 2.0);
-        T_VALUE k2 = _fun(y0);
+        y0 = lazy(*y) + lazy(k1) * (dx / 2.0);
+        calcDeriv(y0, &k2);
 
         // k3 - derivatives calculation
-        y0 = yn + k2 * (dx / 2.0);
-        T_VALUE k3 = _fun(y0);
+        y0 = lazy(*y) + lazy(k2) * (dx / 2.0);
+        calcDeriv(y0, &k3);
 
         // k4 - derivatives calculation
-        y0 = yn + k3 * dx;
-        T_VALUE k4 = _fun(y0);
+        y0 = lazy(*y) + lazy(k3) * dx;
+        calcDeriv(y0, &k4);
 
         // integration
-        return yn + (k1 + k2 * 2.0 + k3 * 2.0 + k4) * (dx / 6.0);
+        *y = lazy(*y) + (lazy(k1) + lazy(k2) * 2.0 + lazy(k3) * 2.0 + lazy(k4)) * (dx / 6.0);
     }
 
     inline DerivFun fun() const { return _fun; }
 
-    void setFun(DerivFun fun) { _fun = fun; }
+    void setFun(DerivFun fun) { _fun = std::move(fun); }
 
 private:
 
     DerivFun _fun;  ///< function which calculates vector derivative
+
+    /**
+     * \brief Calls derivative function.
+     * \param y value
+     * \param dy output derivative
+     */
+    inline void calcDeriv(const T_VALUE& y, T_VALUE* dy)
+    {
+        if constexpr (std::is_invocable_v<DerivFun&, const T_VALUE&, T_VALUE*>)
+            _fun(y, dy);
+        else
+            *dy = _fun(y);
+    }
 };
 
 } // namespace mc
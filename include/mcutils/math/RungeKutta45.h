@@ -0,0 +1,107 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_RUNGEKUTTA45_H_
+#define MCUTILS_MATH_RUNGEKUTTA45_H_
+
+#include <functional>
+
+#include <mcutils/math/EmbeddedRungeKutta.h>
+
+namespace mc {
+
+/**
+ * \brief Dormand-Prince 5(4) Butcher tableau.
+ *
+ * ### References:
+ * - Dormand J., Prince P.: A family of embedded Runge-Kutta formulae, 1980
+ * - Hairer E., Norsett S., Wanner G.: Solving Ordinary Differential Equations I, 1993, p.178, p.192
+ * - [Dormand–Prince method - Wikipedia](https://en.wikipedia.org/wiki/Dormand%E2%80%93Prince_method)
+ */
+struct DormandPrince45Tableau
+{
+    static constexpr unsigned int kStages = 7;
+    static constexpr unsigned int kOrder  = 4;
+
+    static constexpr bool kFsal        = true;
+    static constexpr bool kDenseOutput = true;
+
+    static constexpr double c[kStages] = {
+        0.0, 1.0 / 5.0, 3.0 / 10.0, 4.0 / 5.0, 8.0 / 9.0, 1.0, 1.0
+    };
+
+    static constexpr double a[kStages][kStages] = {
+        { 0.0 },
+        { 1.0 / 5.0 },
+        { 3.0 / 40.0, 9.0 / 40.0 },
+        { 44.0 / 45.0, -56.0 / 15.0, 32.0 / 9.0 },
+        { 19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0, -212.0 / 729.0 },
+        { 9017.0 / 3168.0, -355.0 / 33.0, 46732.0 / 5247.0, 49.0 / 176.0, -5103.0 / 18656.0 },
+        { 35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0 }
+    };
+
+    /** 5th order solution weights */
+    static constexpr double b[kStages] = {
+        35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0, 0.0
+    };
+
+    /** difference between 5th and 4th order solutions weights */
+    static constexpr double e[kStages] = {
+        35.0 / 384.0 - 5179.0 / 57600.0,
+        0.0,
+        500.0 / 1113.0 - 7571.0 / 16695.0,
+        125.0 / 192.0 - 393.0 / 640.0,
+        -2187.0 / 6784.0 + 92097.0 / 339200.0,
+        11.0 / 84.0 - 187.0 / 2100.0,
+        -1.0 / 40.0
+    };
+
+    /** continuous extension coefficients */
+    static constexpr double d[kStages] = {
+        -12715105075.0 / 11282082432.0,
+        0.0,
+        87487479700.0 / 32700410799.0,
+        -10690763975.0 / 1880347072.0,
+        701980252875.0 / 199316789632.0,
+        -1453857185.0 / 822651844.0,
+        69997945.0 / 29380423.0
+    };
+};
+
+/**
+ * \brief Adaptive step Runge-Kutta 5(4) Dormand-Prince numerical integration
+ * class template.
+ *
+ * Seven stages, but the last one is reused as the first stage of the next
+ * step, so each accepted step costs six derivative function evaluations.
+ * Dense output is of the 4th order. See EmbeddedRungeKutta.
+ *
+ * \tparam T_VALUE type of the integrated value
+ * \tparam T_STEP type of the integration step
+ * \tparam DERIV_FUN type of the derivative function
+ */
+template <typename T_VALUE, typename T_STEP,
+          typename DERIV_FUN = std::function<T_VALUE(const T_VALUE&)>>
+using RungeKutta45 = EmbeddedRungeKutta<DormandPrince45Tableau, T_VALUE, T_STEP, DERIV_FUN>;
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_RUNGEKUTTA45_H_
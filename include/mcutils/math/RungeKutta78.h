@@ -0,0 +1,102 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_RUNGEKUTTA78_H_
+#define MCUTILS_MATH_RUNGEKUTTA78_H_
+
+#include <functional>
+
+#include <mcutils/math/EmbeddedRungeKutta.h>
+
+namespace mc {
+
+/**
+ * \brief Runge-Kutta-Fehlberg 7(8) Butcher tableau.
+ *
+ * ### References:
+ * - Fehlberg E.: Classical Fifth-, Sixth-, Seventh-, and Eighth-Order Runge-Kutta Formulas with Stepsize Control, NASA TR R-287, 1968, p.65
+ * - Hairer E., Norsett S., Wanner G.: Solving Ordinary Differential Equations I, 1993, p.180
+ */
+struct Fehlberg78Tableau
+{
+    static constexpr unsigned int kStages = 13;
+    static constexpr unsigned int kOrder  = 7;
+
+    static constexpr bool kFsal        = false;
+    static constexpr bool kDenseOutput = false;
+
+    static constexpr double c[kStages] = {
+        0.0, 2.0 / 27.0, 1.0 / 9.0, 1.0 / 6.0, 5.0 / 12.0, 1.0 / 2.0, 5.0 / 6.0,
+        1.0 / 6.0, 2.0 / 3.0, 1.0 / 3.0, 1.0, 0.0, 1.0
+    };
+
+    static constexpr double a[kStages][kStages] = {
+        { 0.0 },
+        { 2.0 / 27.0 },
+        { 1.0 / 36.0, 1.0 / 12.0 },
+        { 1.0 / 24.0, 0.0, 1.0 / 8.0 },
+        { 5.0 / 12.0, 0.0, -25.0 / 16.0, 25.0 / 16.0 },
+        { 1.0 / 20.0, 0.0, 0.0, 1.0 / 4.0, 1.0 / 5.0 },
+        { -25.0 / 108.0, 0.0, 0.0, 125.0 / 108.0, -65.0 / 27.0, 125.0 / 54.0 },
+        { 31.0 / 300.0, 0.0, 0.0, 0.0, 61.0 / 225.0, -2.0 / 9.0, 13.0 / 900.0 },
+        { 2.0, 0.0, 0.0, -53.0 / 6.0, 704.0 / 45.0, -107.0 / 9.0, 67.0 / 90.0, 3.0 },
+        { -91.0 / 108.0, 0.0, 0.0, 23.0 / 108.0, -976.0 / 135.0, 311.0 / 54.0, -19.0 / 60.0,
+          17.0 / 6.0, -1.0 / 12.0 },
+        { 2383.0 / 4100.0, 0.0, 0.0, -341.0 / 164.0, 4496.0 / 1025.0, -301.0 / 82.0,
+          2133.0 / 4100.0, 45.0 / 82.0, 45.0 / 164.0, 18.0 / 41.0 },
+        { 3.0 / 205.0, 0.0, 0.0, 0.0, 0.0, -6.0 / 41.0, -3.0 / 205.0, -3.0 / 41.0,
+          3.0 / 41.0, 6.0 / 41.0, 0.0 },
+        { -1777.0 / 4100.0, 0.0, 0.0, -341.0 / 164.0, 4496.0 / 1025.0, -289.0 / 82.0,
+          2193.0 / 4100.0, 51.0 / 82.0, 33.0 / 164.0, 12.0 / 41.0, 0.0, 1.0 }
+    };
+
+    /** 8th order solution weights */
+    static constexpr double b[kStages] = {
+        0.0, 0.0, 0.0, 0.0, 0.0, 34.0 / 105.0, 9.0 / 35.0, 9.0 / 35.0, 9.0 / 280.0,
+        9.0 / 280.0, 0.0, 41.0 / 840.0, 41.0 / 840.0
+    };
+
+    /** difference between 8th and 7th order solutions weights */
+    static constexpr double e[kStages] = {
+        -41.0 / 840.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+        -41.0 / 840.0, 41.0 / 840.0, 41.0 / 840.0
+    };
+};
+
+/**
+ * \brief Adaptive step Runge-Kutta-Fehlberg 7(8) numerical integration
+ * class template.
+ *
+ * Thirteen derivative function evaluations per step, which pays off with
+ * much larger steps than RungeKutta45 when tight tolerances are required.
+ * Dense output uses cubic Hermite interpolation. See EmbeddedRungeKutta.
+ *
+ * \tparam T_VALUE type of the integrated value
+ * \tparam T_STEP type of the integration step
+ * \tparam DERIV_FUN type of the derivative function
+ */
+template <typename T_VALUE, typename T_STEP,
+          typename DERIV_FUN = std::function<T_VALUE(const T_VALUE&)>>
+using RungeKutta78 = EmbeddedRungeKutta<Fehlberg78Tableau, T_VALUE, T_STEP, DERIV_FUN>;
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_RUNGEKUTTA78_H_
@@ -0,0 +1,168 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_SIMD_H_
+#define MCUTILS_MATH_SIMD_H_
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#   include <arm_neon.h>
+#   define MCUTILS_SIMD_DOUBLE2
+#elif defined(__SSE2__) || defined(_M_X64)
+#   include <immintrin.h>
+#   define MCUTILS_SIMD_DOUBLE2
+#endif
+
+#if defined(MCUTILS_SIMD_DOUBLE2)
+
+namespace mc {
+namespace simd {
+
+// Thin wrappers around 2 doubles wide SSE2 or NEON registers, so the kernels
+// can be written once for both architectures. Comparisons return masks of
+// the same type with all bits of a lane set if the condition is true.
+
+#   if defined(__ARM_NEON) && defined(__aarch64__)
+
+using Double2 = float64x2_t;
+
+inline Double2 load2(const double* ptr) { return vld1q_f64(ptr); }
+inline void store2(double* ptr, Double2 val) { vst1q_f64(ptr, val); }
+inline Double2 set2(double val) { return vdupq_n_f64(val); }
+inline Double2 set2(double lo, double hi) { return vsetq_lane_f64(hi, vdupq_n_f64(lo), 1); }
+inline double getLo2(Double2 a) { return vgetq_lane_f64(a, 0); }
+inline double getHi2(Double2 a) { return vgetq_lane_f64(a, 1); }
+inline Double2 add2(Double2 a, Double2 b) { return vaddq_f64(a, b); }
+inline Double2 sub2(Double2 a, Double2 b) { return vsubq_f64(a, b); }
+inline Double2 mul2(Double2 a, Double2 b) { return vmulq_f64(a, b); }
+inline Double2 div2(Double2 a, Double2 b) { return vdivq_f64(a, b); }
+inline Double2 fma2(Double2 a, Double2 b, Double2 c) { return vfmaq_f64(c, a, b); }
+inline Double2 sqrt2(Double2 a) { return vsqrtq_f64(a); }
+inline Double2 min2(Double2 a, Double2 b) { return vminq_f64(a, b); }
+inline Double2 max2(Double2 a, Double2 b) { return vmaxq_f64(a, b); }
+inline Double2 round2(Double2 a) { return vrndnq_f64(a); }
+inline Double2 unpackLo2(Double2 a, Double2 b) { return vzip1q_f64(a, b); }
+inline Double2 unpackHi2(Double2 a, Double2 b) { return vzip2q_f64(a, b); }
+
+inline Double2 and2(Double2 a, Double2 b)
+{
+    return vreinterpretq_f64_u64(vandq_u64(vreinterpretq_u64_f64(a), vreinterpretq_u64_f64(b)));
+}
+
+inline Double2 or2(Double2 a, Double2 b)
+{
+    return vreinterpretq_f64_u64(vorrq_u64(vreinterpretq_u64_f64(a), vreinterpretq_u64_f64(b)));
+}
+
+inline Double2 xor2(Double2 a, Double2 b)
+{
+    return vreinterpretq_f64_u64(veorq_u64(vreinterpretq_u64_f64(a), vreinterpretq_u64_f64(b)));
+}
+
+inline Double2 cmpEq2(Double2 a, Double2 b) { return vreinterpretq_f64_u64(vceqq_f64(a, b)); }
+inline Double2 cmpLt2(Double2 a, Double2 b) { return vreinterpretq_f64_u64(vcltq_f64(a, b)); }
+inline Double2 cmpGt2(Double2 a, Double2 b) { return vreinterpretq_f64_u64(vcgtq_f64(a, b)); }
+
+inline Double2 cmpOrd2(Double2 a, Double2 b)
+{
+    return vreinterpretq_f64_u64(vandq_u64(vceqq_f64(a, a), vceqq_f64(b, b)));
+}
+
+inline Double2 select2(Double2 mask, Double2 a, Double2 b)
+{
+    return vbslq_f64(vreinterpretq_u64_f64(mask), a, b);
+}
+
+inline bool any2(Double2 mask)
+{
+    return vmaxvq_u32(vreinterpretq_u32_f64(mask)) != 0;
+}
+
+#   else
+
+using Double2 = __m128d;
+
+inline Double2 load2(const double* ptr) { return _mm_loadu_pd(ptr); }
+inline void store2(double* ptr, Double2 val) { _mm_storeu_pd(ptr, val); }
+inline Double2 set2(double val) { return _mm_set1_pd(val); }
+inline Double2 set2(double lo, double hi) { return _mm_setr_pd(lo, hi); }
+inline double getLo2(Double2 a) { return _mm_cvtsd_f64(a); }
+inline double getHi2(Double2 a) { return _mm_cvtsd_f64(_mm_unpackhi_pd(a, a)); }
+inline Double2 add2(Double2 a, Double2 b) { return _mm_add_pd(a, b); }
+inline Double2 sub2(Double2 a, Double2 b) { return _mm_sub_pd(a, b); }
+inline Double2 mul2(Double2 a, Double2 b) { return _mm_mul_pd(a, b); }
+inline Double2 div2(Double2 a, Double2 b) { return _mm_div_pd(a, b); }
+#       if defined(__FMA__)
+inline Double2 fma2(Double2 a, Double2 b, Double2 c) { return _mm_fmadd_pd(a, b, c); }
+#       else
+inline Double2 fma2(Double2 a, Double2 b, Double2 c) { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+#       endif
+inline Double2 sqrt2(Double2 a) { return _mm_sqrt_pd(a); }
+inline Double2 min2(Double2 a, Double2 b) { return _mm_min_pd(a, b); }
+inline Double2 max2(Double2 a, Double2 b) { return _mm_max_pd(a, b); }
+inline Double2 unpackLo2(Double2 a, Double2 b) { return _mm_unpacklo_pd(a, b); }
+inline Double2 unpackHi2(Double2 a, Double2 b) { return _mm_unpackhi_pd(a, b); }
+
+/**
+ * Rounds to the nearest integer, ties to even. SSE2 has no rounding
+ * instruction, adding and subtracting 1.5 * 2^52 leaves no fraction bits.
+ * Valid for |a| < 2^51.
+ */
+inline Double2 round2(Double2 a)
+{
+    const Double2 magic = _mm_set1_pd(6755399441055744.0);
+    return _mm_sub_pd(_mm_add_pd(a, magic), magic);
+}
+
+inline Double2 and2(Double2 a, Double2 b) { return _mm_and_pd(a, b); }
+inline Double2 or2(Double2 a, Double2 b) { return _mm_or_pd(a, b); }
+inline Double2 xor2(Double2 a, Double2 b) { return _mm_xor_pd(a, b); }
+
+inline Double2 cmpEq2(Double2 a, Double2 b) { return _mm_cmpeq_pd(a, b); }
+inline Double2 cmpLt2(Double2 a, Double2 b) { return _mm_cmplt_pd(a, b); }
+inline Double2 cmpGt2(Double2 a, Double2 b) { return _mm_cmpgt_pd(a, b); }
+inline Double2 cmpOrd2(Double2 a, Double2 b) { return _mm_cmpord_pd(a, b); }
+
+inline Double2 select2(Double2 mask, Double2 a, Double2 b)
+{
+    return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+}
+
+inline bool any2(Double2 mask) { return _mm_movemask_pd(mask) != 0; }
+
+#   endif
+
+inline Double2 abs2(Double2 a) { return select2(set2(-0.0), set2(0.0), a); }
+inline Double2 signBit2(Double2 a) { return and2(a, set2(-0.0)); }
+
+#   if defined(__AVX__)
+#       if defined(__FMA__)
+inline __m256d fma4(__m256d a, __m256d b, __m256d c) { return _mm256_fmadd_pd(a, b, c); }
+#       else
+inline __m256d fma4(__m256d a, __m256d b, __m256d c) { return _mm256_add_pd(_mm256_mul_pd(a, b), c); }
+#       endif
+#   endif
+
+} // namespace simd
+} // namespace mc
+
+#endif // MCUTILS_SIMD_DOUBLE2
+
+#endif // MCUTILS_MATH_SIMD_H_
@@ -0,0 +1,453 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_SPARSEMATRIX_H_
+#define MCUTILS_MATH_SPARSEMATRIX_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+#include <mcutils/math/MatrixX.h>
+#include <mcutils/math/VectorX.h>
+
+namespace mc {
+
+/**
+ * \brief Sparse matrix non-zero element given by its row and column.
+ * \tparam TYPE element type
+ */
+template <typename TYPE>
+struct SparseEntry
+{
+    unsigned int row = 0;   ///< row index
+    unsigned int col = 0;   ///< column index
+    TYPE value = TYPE{0};   ///< element value
+};
+
+namespace detail {
+
+/**
+ * \brief Compresses entries into sparse storage.
+ *
+ * Entries are sorted by the major index (row for CSR, column for CSC) and
+ * then by the minor index. Duplicated entries are summed up. Entries of
+ * indices out of the matrix dimensions are skipped.
+ *
+ * \param entries non-zero entries
+ * \param major_count number of rows for CSR or columns for CSC
+ * \param minor_count number of columns for CSR or rows for CSC
+ * \param row_major true for CSR, false for CSC
+ * \param ptr output offsets of the rows (CSR) or columns (CSC)
+ * \param idx output column (CSR) or row (CSC) indices
+ * \param values output element values
+ */
+template <typename TYPE>
+void compressSparseEntries(std::vector<SparseEntry<TYPE>> entries,
+                           unsigned int major_count, unsigned int minor_count, bool row_major,
+                           std::vector<unsigned int>* ptr,
+                           std::vector<unsigned int>* idx,
+                           std::vector<TYPE>* values)
+{
+    auto major = [row_major](const SparseEntry<TYPE>& e) { return row_major ? e.row : e.col; };
+    auto minor = [row_major](const SparseEntry<TYPE>& e) { return row_major ? e.col : e.row; };
+
+    std::sort(entries.begin(), entries.end(),
+              [&](const SparseEntry<TYPE>& lhs, const SparseEntry<TYPE>& rhs)
+              {
+                  return major(lhs) < major(rhs) || (major(lhs) == major(rhs) && minor(lhs) < minor(rhs));
+              });
+
+    ptr->assign(major_count + 1, 0);
+    idx->clear();
+    values->clear();
+    idx->reserve(entries.size());
+    values->reserve(entries.size());
+
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        assert(major(entries[i]) < major_count && minor(entries[i]) < minor_count);
+        if (major(entries[i]) >= major_count || minor(entries[i]) >= minor_count)
+        {
+            continue;
+        }
+
+        const bool duplicate = i > 0
+                && major(entries[i]) == major(entries[i - 1])
+                && minor(entries[i]) == minor(entries[i - 1]);
+        if (duplicate)
+        {
+            values->back() += entries[i].value;
+        }
+        else
+        {
+            idx->push_back(minor(entries[i]));
+            values->push_back(entries[i].value);
+            (*ptr)[major(entries[i]) + 1] += 1;
+        }
+    }
+
+    for (unsigned int i = 0; i < major_count; ++i)
+    {
+        (*ptr)[i + 1] += (*ptr)[i];
+    }
+}
+
+} // namespace detail
+
+/**
+ * \brief Sparse matrix in Compressed Sparse Row (CSR) format.
+ *
+ * Only non-zero elements are stored, row by row, so memory usage and
+ * matrix by vector product cost are proportional to the number of non-zero
+ * elements. CSR is the preferred format for the iterative solvers, as
+ * matrix by vector product streams through the elements of each row.
+ *
+ * ### References:
+ * - Saad Y.: Iterative Methods for Sparse Linear Systems, 2003, p.92
+ * - [Sparse matrix - Wikipedia](https://en.wikipedia.org/wiki/Sparse_matrix)
+ *
+ * \tparam TYPE matrix elements type
+ */
+template <typename TYPE>
+requires std::is_arithmetic<TYPE>::value
+class SparseMatrixCSR
+{
+public:
+
+    SparseMatrixCSR() = default;
+
+    /**
+     * \brief Constructor.
+     * \param rows number of rows
+     * \param cols number of columns
+     * \param entries non-zero entries in any order, duplicated entries are summed up,
+     * entries out of the matrix dimensions are not allowed (skipped in release builds)
+     */
+    SparseMatrixCSR(unsigned int rows, unsigned int cols,
+                    const std::vector<SparseEntry<TYPE>>& entries)
+        : _rows(rows)
+        , _cols(cols)
+    {
+        detail::compressSparseEntries(entries, rows, cols, true, &_row_ptr, &_col_idx, &_values);
+    }
+
+    /**
+     * \brief Constructor.
+     * \param mat dense matrix, elements with absolute value not greater than eps are skipped
+     * \param eps maximum value treated as zero
+     */
+    explicit SparseMatrixCSR(const MatrixX<TYPE>& mat, double eps = 0.0)
+        : SparseMatrixCSR(mat.rows(), mat.cols(), getEntries(mat, eps))
+    {}
+
+    /** \return number of rows */
+    inline unsigned int rows() const { return _rows; }
+
+    /** \return number of columns */
+    inline unsigned int cols() const { return _cols; }
+
+    /** \return number of stored non-zero elements */
+    inline unsigned int getNonZeros() const { return static_cast<unsigned int>(_values.size()); }
+
+    /** \return offsets of the rows in the elements arrays, rows() + 1 elements */
+    inline const std::vector<unsigned int>& getRowPtr() const { return _row_ptr; }
+
+    /** \return column indices of the non-zero elements */
+    inline const std::vector<unsigned int>& getColIndices() const { return _col_idx; }
+
+    /** \return values of the non-zero elements */
+    inline const std::vector<TYPE>& getValues() const { return _values; }
+
+    /**
+     * \brief Returns element value.
+     * This function uses binary search within the row.
+     * \param row element row number
+     * \param col element column number
+     * \return element value, zero if element is not stored
+     */
+    TYPE operator()(unsigned int row, unsigned int col) const
+    {
+        auto begin = _col_idx.begin() + _row_ptr[row];
+        auto end   = _col_idx.begin() + _row_ptr[row + 1];
+        auto it = std::lower_bound(begin, end, col);
+        return (it != end && *it == col) ? _values[it - _col_idx.begin()] : TYPE{0};
+    }
+
+    /** \return matrix diagonal */
+    VectorX<TYPE> getDiagonal() const
+    {
+        VectorX<TYPE> result(std::min(_rows, _cols));
+        for (unsigned int i = 0; i < result.size(); ++i)
+        {
+            result(i) = (*this)(i, i);
+        }
+        return result;
+    }
+
+    /** \return dense matrix */
+    MatrixX<TYPE> getMatrixX() const
+    {
+        MatrixX<TYPE> result(_rows, _cols);
+        for (unsigned int r = 0; r < _rows; ++r)
+        {
+            for (unsigned int k = _row_ptr[r]; k < _row_ptr[r + 1]; ++k)
+            {
+                result(r, _col_idx[k]) = _values[k];
+            }
+        }
+        return result;
+    }
+
+    /**
+     * \brief Multiplication by a vector operator.
+     * \param vect vector to be multiplied by
+     * \return product of the matrix multiplied by the vector
+     */
+    VectorX<TYPE> operator*(const VectorX<TYPE>& vect) const
+    {
+        VectorX<TYPE> result(_rows);
+        multiplyMatrixByVector(*this, vect, &result);
+        return result;
+    }
+
+private:
+
+    unsigned int _rows = 0;                 ///< number of rows
+    unsigned int _cols = 0;                 ///< number of columns
+    std::vector<unsigned int> _row_ptr;     ///< offsets of the rows
+    std::vector<unsigned int> _col_idx;     ///< column indices
+    std::vector<TYPE> _values;              ///< non-zero elements values
+
+    static std::vector<SparseEntry<TYPE>> getEntries(const MatrixX<TYPE>& mat, double eps)
+    {
+        std::vector<SparseEntry<TYPE>> entries;
+        for (unsigned int r = 0; r < mat.rows(); ++r)
+        {
+            for (unsigned int c = 0; c < mat.cols(); ++c)
+            {
+                if (fabs(static_cast<double>(mat(r,c))) > eps)
+                {
+                    entries.push_back({ r, c, mat(r,c) });
+                }
+            }
+        }
+        return entries;
+    }
+};
+
+/**
+ * \brief Sparse matrix in Compressed Sparse Column (CSC) format.
+ *
+ * Only non-zero elements are stored, column by column. CSC is convenient
+ * when matrix is assembled or modified column-wise.
+ *
+ * ### References:
+ * - Saad Y.: Iterative Methods for Sparse Linear Systems, 2003, p.92
+ * - [Sparse matrix - Wikipedia](https://en.wikipedia.org/wiki/Sparse_matrix)
+ *
+ * \tparam TYPE matrix elements type
+ */
+template <typename TYPE>
+requires std::is_arithmetic<TYPE>::value
+class SparseMatrixCSC
+{
+public:
+
+    SparseMatrixCSC() = default;
+
+    /**
+     * \brief Constructor.
+     * \param rows number of rows
+     * \param cols number of columns
+     * \param entries non-zero entries in any order, duplicated entries are summed up,
+     * entries out of the matrix dimensions are not allowed (skipped in release builds)
+     */
+    SparseMatrixCSC(unsigned int rows, unsigned int cols,
+                    const std::vector<SparseEntry<TYPE>>& entries)
+        : _rows(rows)
+        , _cols(cols)
+    {
+        detail::compressSparseEntries(entries, cols, rows, false, &_col_ptr, &_row_idx, &_values);
+    }
+
+    /**
+     * \brief Converting constructor.
+     * \param mat matrix in CSR format
+     */
+    explicit SparseMatrixCSC(const SparseMatrixCSR<TYPE>& mat)
+        : _rows(mat.rows())
+        , _cols(mat.cols())
+    {
+        std::vector<SparseEntry<TYPE>> entries;
+        entries.reserve(mat.getNonZeros());
+        for (unsigned int r = 0; r < mat.rows(); ++r)
+        {
+            for (unsigned int k = mat.getRowPtr()[r]; k < mat.getRowPtr()[r + 1]; ++k)
+            {
+                entries.push_back({ r, mat.getColIndices()[k], mat.getValues()[k] });
+            }
+        }
+        detail::compressSparseEntries(entries, _cols, _rows, false, &_col_ptr, &_row_idx, &_values);
+    }
+
+    /** \return number of rows */
+    inline unsigned int rows() const { return _rows; }
+
+    /** \return number of columns */
+    inline unsigned int cols() const { return _cols; }
+
+    /** \return number of stored non-zero elements */
+    inline unsigned int getNonZeros() const { return static_cast<unsigned int>(_values.size()); }
+
+    /** \return offsets of the columns in the elements arrays, cols() + 1 elements */
+    inline const std::vector<unsigned int>& getColPtr() const { return _col_ptr; }
+
+    /** \return row indices of the non-zero elements */
+    inline const std::vector<unsigned int>& getRowIndices() const { return _row_idx; }
+
+    /** \return values of the non-zero elements */
+    inline const std::vector<TYPE>& getValues() const { return _values; }
+
+    /**
+     * \brief Returns element value.
+     * This function uses binary search within the column.
+     * \param row element row number
+     * \param col element column number
+     * \return element value, zero if element is not stored
+     */
+    TYPE operator()(unsigned int row, unsigned int col) const
+    {
+        auto begin = _row_idx.begin() + _col_ptr[col];
+        auto end   = _row_idx.begin() + _col_ptr[col + 1];
+        auto it = std::lower_bound(begin, end, row);
+        return (it != end && *it == row) ? _values[it - _row_idx.begin()] : TYPE{0};
+    }
+
+    /** \return matrix diagonal */
+    VectorX<TYPE> getDiagonal() const
+    {
+        VectorX<TYPE> result(std::min(_rows, _cols));
+        for (unsigned int i = 0; i < result.size(); ++i)
+        {
+            result(i) = (*this)(i, i);
+        }
+        return result;
+    }
+
+    /** \return dense matrix */
+    MatrixX<TYPE> getMatrixX() const
+    {
+        MatrixX<TYPE> result(_rows, _cols);
+        for (unsigned int c = 0; c < _cols; ++c)
+        {
+            for (unsigned int k = _col_ptr[c]; k < _col_ptr[c + 1]; ++k)
+            {
+                result(_row_idx[k], c) = _values[k];
+            }
+        }
+        return result;
+    }
+
+    /**
+     * \brief Multiplication by a vector operator.
+     * \param vect vector to be multiplied by
+     * \return product of the matrix multiplied by the vector
+     */
+    VectorX<TYPE> operator*(const VectorX<TYPE>& vect) const
+    {
+        VectorX<TYPE> result(_rows);
+        multiplyMatrixByVector(*this, vect, &result);
+        return result;
+    }
+
+private:
+
+    unsigned int _rows = 0;                 ///< number of rows
+    unsigned int _cols = 0;                 ///< number of columns
+    std::vector<unsigned int> _col_ptr;     ///< offsets of the columns
+    std::vector<unsigned int> _row_idx;     ///< row indices
+    std::vector<TYPE> _values;              ///< non-zero elements values
+};
+
+/**
+ * \brief Multiplication a sparse matrix by a vector algorithm.
+ * \tparam TYPE type of the matrix and vectors elements
+ * \param mat matrix
+ * \param vect vector
+ * \param result output result vector, must not be the same as vect
+ */
+template <typename TYPE>
+void multiplyMatrixByVector(const SparseMatrixCSR<TYPE>& mat, const VectorX<TYPE>& vect, VectorX<TYPE>* result)
+{
+    assert(mat.cols() == vect.size() && mat.rows() == result->size());
+    assert(&vect != result);
+
+    const unsigned int* row_ptr = mat.getRowPtr().data();
+    const unsigned int* col_idx = mat.getColIndices().data();
+    const TYPE* values = mat.getValues().data();
+    const TYPE* x = vect.data();
+
+    for (unsigned int r = 0; r < mat.rows(); ++r)
+    {
+        TYPE sum = TYPE{0};
+        for (unsigned int k = row_ptr[r]; k < row_ptr[r + 1]; ++k)
+        {
+            sum += values[k] * x[col_idx[k]];
+        }
+        (*result)(r) = sum;
+    }
+}
+
+/**
+ * \brief Multiplication a sparse matrix by a vector algorithm.
+ * \tparam TYPE type of the matrix and vectors elements
+ * \param mat matrix
+ * \param vect vector
+ * \param result output result vector, must not be the same as vect
+ */
+template <typename TYPE>
+void multiplyMatrixByVector(const SparseMatrixCSC<TYPE>& mat, const VectorX<TYPE>& vect, VectorX<TYPE>* result)
+{
+    assert(mat.cols() == vect.size() && mat.rows() == result->size());
+    assert(&vect != result);
+
+    const unsigned int* col_ptr = mat.getColPtr().data();
+    const unsigned int* row_idx = mat.getRowIndices().data();
+    const TYPE* values = mat.getValues().data();
+    TYPE* y = result->data();
+
+    result->zeroize();
+    for (unsigned int c = 0; c < mat.cols(); ++c)
+    {
+        const TYPE x_c = vect(c);
+        for (unsigned int k = col_ptr[c]; k < col_ptr[c + 1]; ++k)
+        {
+            y[row_idx[k]] += values[k] * x_c;
+        }
+    }
+}
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_SPARSEMATRIX_H_
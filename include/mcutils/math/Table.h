@@ -22,13 +22,24 @@
 #ifndef MCUTILS_MATH_TABLE_H_
 #define MCUTILS_MATH_TABLE_H_
 
+#include <algorithm>
+#include <cassert>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <limits>
+#include <memory>
+#include <span>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#if defined(__AVX2__)
+#   include <immintrin.h>
+#endif
+
 #include <units.h>
 
 #include <mcutils/misc/Check.h>
@@ -39,45 +50,126 @@ using namespace units::math;
 namespace mc {
 
 /**
- * \brief Table and linear interpolation class template.
+ * \brief Key index search method enum.
+ */
+enum class TableSearch : uint8_t
+{
+    Linear  = 0x0,      ///< linear scan, O(n)
+    Binary  = 0x1,      ///< binary search, O(log n)
+    Uniform = 0x2       ///< direct index calculation for uniformly spaced keys, O(1)
+};
+
+/**
+ * \brief Table interpolation method enum.
+ */
+enum class TableInterpolation : uint8_t
+{
+    Linear      = 0x0,  ///< piecewise linear interpolation
+    CubicSpline = 0x1,  ///< natural cubic spline, continuous first and second derivatives
+    Pchip       = 0x2   ///< piecewise cubic Hermite (monotone cubic), doesn't overshoot data
+};
+
+class TableFile;
+class TableFileWriter;
+
+template <typename KEY_TYPE, typename VAL_TYPE, unsigned int SIZE>
+class FixedTable;
+
+/**
+ * \brief Table lookup cursor.
  *
- * This class represents a table of key-value pairs and provides methods for
- * linear interpolation between the values.
+ * Cursor keeps index of the interval found by the previous query, as change
+ * between two subsequent queries is typically small and it is likely that
+ * the next query is within the same interval. Cursor is owned by the caller,
+ * so a single const table can be shared between threads, each using its own
+ * cursor.
+ */
+struct TableCursor
+{
+    unsigned int index = 0;     ///< index of the interval found by the previous query
+};
+
+/**
+ * \brief Table record.
+ *
+ * Record holds everything needed to interpolate within the interval that
+ * starts at the record key, so a single interpolation touches only two
+ * adjacent records. Value within the interval is given by the polynomial
+ * value + slope*dk + quad*dk^2 + cubic*dk^3, where dk is the distance from
+ * the record key. For linear interpolation quad and cubic are zero.
  *
  * \tparam KEY_TYPE key type
  * \tparam VAL_TYPE value type
  */
 template <typename KEY_TYPE, typename VAL_TYPE>
+struct TableRecord
+{
+    KEY_TYPE key   = KEY_TYPE{0};   ///< key value
+    VAL_TYPE value = VAL_TYPE{0};   ///< table value
+    double   slope = 0.0;           ///< interpolation data (gradient)
+    double   quad  = 0.0;           ///< interpolation data (2nd order coefficient)
+    double   cubic = 0.0;           ///< interpolation data (3rd order coefficient)
+};
+
+/**
+ * \brief Table and interpolation class template.
+ *
+ * This class represents a table of key-value pairs and provides methods for
+ * linear, cubic spline or monotone cubic interpolation between the values.
+ * Polynomial coefficients are calculated once when data is set, so every
+ * interpolation method has similar lookup cost. Table data is stored as
+ * a single array of interleaved records (key, value, coefficients) allocated
+ * with the given allocator. Tables loaded from TableFile or created from
+ * FixedTable reference external records instead, and copy them only when
+ * modified.
+ *
+ * \tparam KEY_TYPE key type
+ * \tparam VAL_TYPE value type
+ * \tparam ALLOCATOR allocator type, rebound to the table record type
+ */
+template <typename KEY_TYPE, typename VAL_TYPE, typename ALLOCATOR = std::allocator<std::byte>>
 class Table
 {
+    friend class TableFile;
+    friend class TableFileWriter;
+
+    template <typename K, typename V, unsigned int S>
+    friend class FixedTable;
+
 public:
 
+    using Record = TableRecord<KEY_TYPE, VAL_TYPE>;
+    using Allocator = typename std::allocator_traits<ALLOCATOR>::template rebind_alloc<Record>;
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+
     /** \brief Copy constructor. */
-    Table(const Table<KEY_TYPE,VAL_TYPE>& table)
-        : _size(table._size)
+    Table(const Table<KEY_TYPE,VAL_TYPE,ALLOCATOR>& table)
+        : _allocator(AllocatorTraits::select_on_container_copy_construction(table._allocator))
+        , _size(table._size)
         , _last(table._last)
+        , _search(table._search)
+        , _interpolation(table._interpolation)
+        , _key_step_inv(table._key_step_inv)
     {
         if (_size > 0)
         {
             createArrays();
-
-            for (unsigned int i = 0; i < _size; ++i)
-            {
-                _key_values[i] = table._key_values[i];
-                _table_data[i] = table._table_data[i];
-                _inter_data[i] = table._inter_data[i];
-            }
+            std::copy(table._records, table._records + _size, _records);
         }
     }
 
     /** \brief Move constructor. */
-    Table(Table<KEY_TYPE,VAL_TYPE>&& table) noexcept
-        : _size(std::exchange(table._size, 0))
+    Table(Table<KEY_TYPE,VAL_TYPE,ALLOCATOR>&& table) noexcept
+        : _allocator(std::move(table._allocator))
+        , _size(std::exchange(table._size, 0))
         , _last(std::exchange(table._last, 0))
 
-        , _key_values(std::exchange(table._key_values, nullptr))
-        , _table_data(std::exchange(table._table_data, nullptr))
-        , _inter_data(std::exchange(table._inter_data, nullptr))
+        , _records(std::exchange(table._records, nullptr))
+        , _view(std::exchange(table._view, false))
+
+        , _search(table._search)
+        , _interpolation(table._interpolation)
+        , _key_step_inv(table._key_step_inv)
     {}
 
     /**
@@ -88,17 +180,19 @@ public:
      *
      * \param val value
      * \param key key value
+     * \param allocator allocator
      */
-    explicit Table(VAL_TYPE val = VAL_TYPE{0}, KEY_TYPE key = KEY_TYPE{0})
+    explicit Table(VAL_TYPE val = VAL_TYPE{0}, KEY_TYPE key = KEY_TYPE{0},
+                   const ALLOCATOR& allocator = ALLOCATOR())
+        : _allocator(allocator)
     {
         _size = 1;
         _last = 0;
 
         createArrays();
 
-        _key_values[0] = key;
-        _table_data[0] = val;
-        _inter_data[0] = 0.0;
+        _records[0].key = key;
+        _records[0].value = val;
     }
 
     /**
@@ -108,8 +202,11 @@ public:
      *
      * \param key_values key values ordered vector
      * \param table_data table values ordered vector
+     * \param allocator allocator
      */
-    Table(const std::vector<KEY_TYPE>& key_values, const std::vector<VAL_TYPE>& table_data)
+    Table(const std::vector<KEY_TYPE>& key_values, const std::vector<VAL_TYPE>& table_data,
+          const ALLOCATOR& allocator = ALLOCATOR())
+        : _allocator(allocator)
     {
         setData(key_values, table_data);
     }
@@ -128,7 +225,7 @@ public:
     {
         if (_size > 0 && index < _size)
         {
-            return _key_values[index];
+            return _records[index].key;
         }
 
         return KEY_TYPE{std::numeric_limits<double>::quiet_NaN()};
@@ -145,10 +242,10 @@ public:
 
         for (unsigned int i = 0; i < _size; ++i)
         {
-            if (_table_data[i] < min_value)
+            if (_records[i].value < min_value)
             {
-                result = _key_values[i];
-                min_value = _table_data[i];
+                result = _records[i].key;
+                min_value = _records[i].value;
             }
         }
 
@@ -168,14 +265,14 @@ public:
 
         for (unsigned int i = 0; i < _size; ++i)
         {
-            if (_table_data[i] < min_value)
+            if (_records[i].value < min_value)
             {
-                if (_key_values[i] <= key_max)
+                if (_records[i].key <= key_max)
                 {
-                    if (_key_values[i] >= key_min)
+                    if (_records[i].key >= key_min)
                     {
-                        result = _key_values[i];
-                        min_value = _table_data[i];
+                        result = _records[i].key;
+                        min_value = _records[i].value;
                     }
                 }
                 else
@@ -199,10 +296,10 @@ public:
 
         for (unsigned int i = 0; i < _size; ++i)
         {
-            if (_table_data[i] > max_value)
+            if (_records[i].value > max_value)
             {
-                result = _key_values[i];
-                max_value = _table_data[i];
+                result = _records[i].key;
+                max_value = _records[i].value;
             }
         }
 
@@ -222,14 +319,14 @@ public:
 
         for (unsigned int i = 0; i < _size; ++i)
         {
-            if (_table_data[i] > max_value)
+            if (_records[i].value > max_value)
             {
-                if (_key_values[i] <= key_max)
+                if (_records[i].key <= key_max)
                 {
-                    if (_key_values[i] >= key_min)
+                    if (_records[i].key >= key_min)
                     {
-                        result = _key_values[i];
-                        max_value = _table_data[i];
+                        result = _records[i].key;
+                        max_value = _records[i].value;
                     }
                 }
                 else
@@ -245,8 +342,9 @@ public:
     /**
      * \brief Returns table value for the given key.
      *
-     * Returns table value for the given key value using linear interpolation
-     * algorithm.
+     * Returns table value for the given key value using the table
+     * interpolation method. This function doesn't modify table state, so it is safe to
+     * call it concurrently on a shared table.
      *
      * \param key_value key value
      * \return interpolated value on success or NaN on failure
@@ -255,40 +353,112 @@ public:
     {
         if (_size > 0)
         {
-            // checking if previous index is still valid
-            // change between two subsequent queries is typically small
-            // it is possible that new query is within the same interval
-            // so there is no need to iterate through all the data
-            if (doesIndexMatchKey(_prev, key_value))
+            if (key_value <= _records[0].key)
             {
-                return calculateInterpolatedValue(_prev, key_value);
+                return _records[0].value;
             }
 
-            if (key_value <= _key_values[0])
+            if (key_value >= _records[_last].key)
             {
-                _prev = 0;
-                return _table_data[0];
+                return _records[_last].value;
             }
 
-            if (key_value >= _key_values[_last])
+            if (_last > 0)
             {
-                _prev = _last;
-                return _table_data[_last];
+                return calculateInterpolatedValue(findIndex(key_value), key_value);
             }
+        }
 
-            for (unsigned int i = 0; i < _size; ++i)
+        return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
+    }
+
+    /**
+     * \brief Returns table value for the given key.
+     *
+     * Returns table value for the given key value using the table
+     * interpolation method. Interval stored in the given cursor is checked first and
+     * the search is done only if the key is outside of it.
+     *
+     * \param key_value key value
+     * \param cursor lookup cursor
+     * \return interpolated value on success or NaN on failure
+     */
+    VAL_TYPE getValue(KEY_TYPE key_value, TableCursor& cursor) const
+    {
+        if (_size > 0)
+        {
+            if (key_value <= _records[0].key)
+            {
+                return _records[0].value;
+            }
+
+            if (key_value >= _records[_last].key)
             {
-                if (doesIndexMatchKey(i, key_value))
+                return _records[_last].value;
+            }
+
+            if (_last > 0)
+            {
+                // cursor might have been used with another table, so it has to be bound checked
+                if (!(cursor.index < _last && doesIndexMatchKey(cursor.index, key_value)))
                 {
-                    _prev = i;
-                    return calculateInterpolatedValue(i, key_value);
+                    cursor.index = findIndex(key_value);
                 }
+
+                return calculateInterpolatedValue(cursor.index, key_value);
             }
         }
 
         return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
     }
 
+    /**
+     * \brief Returns table values for the given keys.
+     *
+     * Batch version of getValue(). Interval search is branchless, so it has
+     * the same cost for every key and doesn't suffer from branch
+     * mispredictions. For double tables compiled with AVX2 enabled 4 keys
+     * are processed at once using gather instructions.
+     *
+     * \param key_values key values
+     * \param values output values, size should match key values size
+     */
+    void getValues(std::span<const KEY_TYPE> key_values, std::span<VAL_TYPE> values) const
+    {
+        assert(key_values.size() == values.size());
+
+        const size_t count = std::min(key_values.size(), values.size());
+        size_t i = 0;
+
+        if (_last > 0)
+        {
+#           if defined(__AVX2__)
+            if constexpr (std::is_same<KEY_TYPE, double>::value && std::is_same<VAL_TYPE, double>::value)
+            {
+                i = getValuesAVX2(key_values.data(), values.data(), count);
+            }
+#           endif
+
+            for (; i < count; ++i)
+            {
+                const KEY_TYPE key_value = key_values[i];
+
+                VAL_TYPE value = calculateInterpolatedValue(findIndexBranchless(key_value), key_value);
+                value = (key_value <= _records[0].key)     ? _records[0].value     : value;
+                value = (key_value >= _records[_last].key) ? _records[_last].value : value;
+
+                values[i] = value;
+            }
+        }
+        else
+        {
+            for (; i < count; ++i)
+            {
+                values[i] = getValue(key_values[i]);
+            }
+        }
+    }
+
     /**
      * \brief Returns table value for the given key index.
      * \param key_index key index
@@ -298,7 +468,7 @@ public:
     {
         if (_size > 0 && key_index < _size)
         {
-            return _table_data[key_index];
+            return _records[key_index].value;
         }
 
         return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
@@ -312,7 +482,7 @@ public:
     {
         if (_size > 0)
         {
-            return _table_data[0];
+            return _records[0].value;
         }
 
         return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
@@ -326,7 +496,7 @@ public:
     {
         if (_size > 0)
         {
-            return _table_data[_last];
+            return _records[_last].value;
         }
 
         return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
@@ -346,9 +516,9 @@ public:
 
             for (unsigned int i = 0; i < _size; ++i)
             {
-                if ( _table_data[i] < result )
+                if ( _records[i].value < result )
                 {
-                    result = _table_data[i];
+                    result = _records[i].value;
                 }
             }
         }
@@ -370,9 +540,9 @@ public:
 
             for (unsigned int i = 0; i < _size; ++i)
             {
-                if (_table_data[i] > result)
+                if (_records[i].value > result)
                 {
-                    result = _table_data[i];
+                    result = _records[i].value;
                 }
             }
         }
@@ -390,9 +560,11 @@ public:
 
         for (unsigned int i = 0; i < _size; ++i)
         {
-            if (result) result = check::isValid(_key_values[i]);
-            if (result) result = check::isValid(_table_data[i]);
-            if (result) result = check::isValid(_inter_data[i]);
+            if (result) result = check::isValid(_records[i].key);
+            if (result) result = check::isValid(_records[i].value);
+            if (result) result = check::isValid(_records[i].slope);
+            if (result) result = check::isValid(_records[i].quad);
+            if (result) result = check::isValid(_records[i].cubic);
 
             if (!result) break;
         }
@@ -400,15 +572,57 @@ public:
         return result;
     }
 
+    /**
+     * \brief Returns key index search method.
+     * \return key index search method
+     */
+    inline TableSearch getSearch() const { return _search; }
+
+    /**
+     * \brief Sets key index search method.
+     *
+     * Search method is selected automatically whenever table data is set,
+     * this function allows to override it, e.g. to declare keys that are
+     * only approximately uniformly spaced as uniform. Every method returns
+     * the same results, they differ only in performance.
+     *
+     * \param search key index search method
+     */
+    inline void setSearch(TableSearch search) { _search = search; }
+
+    /**
+     * \brief Returns interpolation method.
+     * \return interpolation method
+     */
+    inline TableInterpolation getInterpolation() const { return _interpolation; }
+
+    /**
+     * \brief Sets interpolation method.
+     *
+     * Interpolation method is kept when table data is set. Outside of the keys
+     * range table values are clamped regardless of the method.
+     *
+     * \param interpolation interpolation method
+     */
+    void setInterpolation(TableInterpolation interpolation)
+    {
+        detach();
+
+        _interpolation = interpolation;
+        updateInterpolationData();
+    }
+
     /**
      * \brief Multiplies keys by the given factor.
      * \param factor given factor
      */
     void multiplyKeys(double factor)
     {
+        detach();
+
         for (unsigned int i = 0; i < _size; ++i)
         {
-            _key_values[i] *= factor;
+            _records[i].key *= factor;
         }
 
         updateInterpolationData();
@@ -420,9 +634,11 @@ public:
      */
     void multiplyValues(double factor)
     {
+        detach();
+
         for (unsigned int i = 0; i < _size; ++i)
         {
-            _table_data[i] *= factor;
+            _records[i].value *= factor;
         }
 
         updateInterpolationData();
@@ -439,7 +655,6 @@ public:
 
         _size = 0;
         _last = 0;
-        _prev = 0;
 
         if (key_values.size() > 0 && key_values.size() == table_data.size())
         {
@@ -450,58 +665,68 @@ public:
 
             for (unsigned int i = 0; i < _size; ++i)
             {
-                _key_values[i] = key_values[i];
-                _table_data[i] = table_data[i];
-                _inter_data[i] = 0.0;
+                _records[i].key = key_values[i];
+                _records[i].value = table_data[i];
             }
 
             updateInterpolationData();
         }
+
+        _search = areKeysUniform() ? TableSearch::Uniform : TableSearch::Binary;
     }
 
     /**
      * \brief Sets table data from string.
      *
-     * Values in the given string should be separated with whitespaces.
+     * Values in the given string should be separated with whitespaces. Keys
+     * and values are parsed directly into the table storage, which is sized
+     * up front. On failure table is set to a single NaN record.
      *
      * \param str given string
+     * \return parsing result, with position of the first invalid token on failure
      */
-    void setFromString(const char* str)
+    str::ParseResult setFromString(const char* str)
     {
-        std::vector<KEY_TYPE> key_values_temp;
-        std::vector<VAL_TYPE> table_data_temp;
+        str::NumberReader reader(str);
 
-        std::stringstream ss(str::stripSpaces(str));
-        bool valid = true;
+        const size_t count = reader.countNumbers();
 
-        while (!ss.eof() && valid)
-        {
-            double key = std::numeric_limits<double>::quiet_NaN();
-            double val = std::numeric_limits<double>::quiet_NaN();
+        deleteArrays();
 
-            ss >> key;
-            ss >> val;
+        // odd or zero count is reported by the reader as missing data
+        _size = static_cast<unsigned int>(std::max<size_t>(1, (count + 1) / 2));
+        _last = _size - 1;
 
-            valid &= check::isValid(key) && check::isValid(val);
+        createArrays();
 
-            if (valid)
+        for (unsigned int i = 0; i < _size; ++i)
+        {
+            double key = 0.0;
+            double val = 0.0;
+
+            if (!reader.read(&key) || !reader.read(&val))
             {
-                key_values_temp.push_back(KEY_TYPE{key});
-                table_data_temp.push_back(VAL_TYPE{val});
+                break;
             }
 
+            _records[i].key   = KEY_TYPE{key};
+            _records[i].value = VAL_TYPE{val};
         }
 
-        std::vector<KEY_TYPE> key_values { KEY_TYPE{ std::numeric_limits<double>::quiet_NaN() } };
-        std::vector<VAL_TYPE> table_data { VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() } };
+        str::ParseResult result = reader.getResult();
 
-        if (valid)
+        if (result.valid)
+        {
+            updateInterpolationData();
+            _search = areKeysUniform() ? TableSearch::Uniform : TableSearch::Binary;
+        }
+        else
         {
-            key_values = key_values_temp;
-            table_data = table_data_temp;
+            setData({ KEY_TYPE{ std::numeric_limits<double>::quiet_NaN() } },
+                    { VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() } });
         }
 
-        setData(key_values, table_data);
+        return result;
     }
 
     /**
@@ -513,8 +738,8 @@ public:
 
         for (unsigned int i = 0; i < _size; ++i)
         {
-            ss << static_cast<double>(_key_values[i]) << "\t";
-            ss << static_cast<double>(_table_data[i]) << std::endl;
+            ss << static_cast<double>(_records[i].key) << "\t";
+            ss << static_cast<double>(_records[i].value) << std::endl;
         }
 
         return ss.str();
@@ -522,26 +747,37 @@ public:
 
     inline unsigned int size() const { return _size; }
 
-    /** \brief Addition operator. */
-    Table<KEY_TYPE,VAL_TYPE> operator+(const Table<KEY_TYPE,VAL_TYPE>& table) const
+    /**
+     * \brief Addition operator.
+     * Result has keys, search and interpolation methods of this table.
+     */
+    Table<KEY_TYPE,VAL_TYPE,ALLOCATOR> operator+(const Table<KEY_TYPE,VAL_TYPE,ALLOCATOR>& table) const
     {
-        std::vector<KEY_TYPE> key_values;
-        std::vector<VAL_TYPE> table_data;
+        Table<KEY_TYPE,VAL_TYPE,ALLOCATOR> result(*this);
 
         for (unsigned int i = 0; i < _size; ++i)
         {
-            KEY_TYPE key = _key_values[i];
-            VAL_TYPE val = _table_data[i] + table.getValue(key);
-
-            key_values.push_back(key);
-            table_data.push_back(val);
+            result._records[i].value = _records[i].value + table.getValue(_records[i].key);
         }
 
-        return Table<KEY_TYPE,VAL_TYPE> (key_values, table_data);
+        result.updateInterpolationData();
+
+        return result;
+    }
+
+    /**
+     * \brief Multiplication operator (by number).
+     * Result has keys, search and interpolation methods of this table.
+     */
+    Table<KEY_TYPE,VAL_TYPE,ALLOCATOR> operator*(double val) const
+    {
+        Table<KEY_TYPE,VAL_TYPE,ALLOCATOR> result(*this);
+        result.multiplyValues(val);
+        return result;
     }
 
     /** \brief Assignment operator. */
-    Table<KEY_TYPE,VAL_TYPE>& operator=(const Table<KEY_TYPE,VAL_TYPE>& table)
+    Table<KEY_TYPE,VAL_TYPE,ALLOCATOR>& operator=(const Table<KEY_TYPE,VAL_TYPE,ALLOCATOR>& table)
     {
         if (this != &table)
         {
@@ -550,16 +786,14 @@ public:
             _size = table._size;
             _last = table._last;
 
+            _search = table._search;
+            _interpolation = table._interpolation;
+            _key_step_inv = table._key_step_inv;
+
             if (_size > 0)
             {
                 createArrays();
-
-                for (unsigned int i = 0; i < _size; ++i)
-                {
-                    _key_values[i] = table._key_values[i];
-                    _table_data[i] = table._table_data[i];
-                    _inter_data[i] = table._inter_data[i];
-                }
+                std::copy(table._records, table._records + _size, _records);
             }
         }
 
@@ -567,95 +801,488 @@ public:
     }
 
     /** \brief Move assignment operator. */
-    Table<KEY_TYPE,VAL_TYPE>& operator=(Table<KEY_TYPE,VAL_TYPE>&& table)
+    Table<KEY_TYPE,VAL_TYPE,ALLOCATOR>& operator=(Table<KEY_TYPE,VAL_TYPE,ALLOCATOR>&& table)
     {
+        if constexpr (!AllocatorTraits::propagate_on_container_move_assignment::value
+                   && !AllocatorTraits::is_always_equal::value)
+        {
+            // memory allocated by the other allocator cannot be taken over
+            if (_allocator != table._allocator)
+            {
+                return *this = table;
+            }
+        }
+
         deleteArrays();
 
+        if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value)
+        {
+            _allocator = std::move(table._allocator);
+        }
+
         _size = std::exchange(table._size, 0);
         _last = std::exchange(table._last, 0);
 
-        _key_values = std::exchange(table._key_values, nullptr);
-        _table_data = std::exchange(table._table_data, nullptr);
-        _inter_data = std::exchange(table._inter_data, nullptr);
+        _search = table._search;
+        _interpolation = table._interpolation;
+        _key_step_inv = table._key_step_inv;
+
+        _records = std::exchange(table._records, nullptr);
+        _view = std::exchange(table._view, false);
 
         return *this;
     }
 
 private:
 
+    Allocator _allocator;               ///< records allocator
+
     unsigned int _size = 0;             ///< number of table elements
     unsigned int _last = 0;             ///< last element index
 
-    KEY_TYPE* _key_values = nullptr;    ///< key values
-    VAL_TYPE* _table_data = nullptr;    ///< table data
-    double* _inter_data = nullptr;      ///< interpolation data
+    Record* _records = nullptr;         ///< table records
+    bool _view = false;                 ///< specifies if records are not owned (referenced external memory)
 
-    mutable unsigned int _prev = 0;     ///< previous index
+    TableSearch _search = TableSearch::Binary;  ///< key index search method
+    TableInterpolation _interpolation = TableInterpolation::Linear; ///< interpolation method
+    double _key_step_inv = 0.0;         ///< inverse of the mean key step
 
     bool doesIndexMatchKey(unsigned int index, KEY_TYPE key_value) const
     {
-        // no need to bound check, as it is intended to be used only with "_prev" which is always in range
-        return key_value >= _key_values[index] && key_value < _key_values[index+1];
+        // no need to bound check, as it is intended to be used only with indices less than "_last"
+        return key_value >= _records[index].key && key_value < _records[index+1].key;
     }
 
-    VAL_TYPE calculateInterpolatedValue(unsigned int index, KEY_TYPE key_value) const
+    /**
+     * \brief Finds index of the interval containing the given key.
+     * Key value is expected to be within (first key, last key) range.
+     * \param key_value key value
+     * \return interval index
+     */
+    unsigned int findIndex(KEY_TYPE key_value) const
+    {
+        switch (_search)
+        {
+            case TableSearch::Linear:  return findIndexLinear(key_value);
+            case TableSearch::Uniform: return findIndexUniform(key_value);
+            default:                   return findIndexBinary(key_value);
+        }
+    }
+
+    unsigned int findIndexLinear(KEY_TYPE key_value) const
+    {
+        for (unsigned int i = 0; i < _last; ++i)
+        {
+            if (doesIndexMatchKey(i, key_value))
+            {
+                return i;
+            }
+        }
+
+        return 0;
+    }
+
+    unsigned int findIndexBinary(KEY_TYPE key_value) const
+    {
+        // invariant: _records[lo].key <= key_value < _records[hi].key
+        unsigned int lo = 0;
+        unsigned int hi = _last;
+
+        while (hi - lo > 1)
+        {
+            unsigned int mid = (lo + hi) / 2;
+
+            if (key_value < _records[mid].key)
+                hi = mid;
+            else
+                lo = mid;
+        }
+
+        return lo;
+    }
+
+    unsigned int findIndexUniform(KEY_TYPE key_value) const
     {
-        return static_cast<double>(key_value - _key_values[index]) * VAL_TYPE{_inter_data[index]} + _table_data[index];
+        double pos = static_cast<double>(key_value - _records[0].key) * _key_step_inv;
+
+        // comparison is written so that NaN falls into the last interval
+        unsigned int index = (pos < static_cast<double>(_last - 1))
+                           ? static_cast<unsigned int>(pos) : _last - 1;
+
+        // correcting rounding errors and keys that are not exactly uniform
+        while (index > 0 && key_value < _records[index].key) --index;
+        while (index < _last - 1 && key_value >= _records[index+1].key) ++index;
+
+        return index;
+    }
+
+    unsigned int findIndexBranchless(KEY_TYPE key_value) const
+    {
+        // finds the last key not greater than the given one among the first "_last" keys
+        // number of iterations depends only on the table size
+        unsigned int base = 0;
+        unsigned int n = _last;
+
+        while (n > 1)
+        {
+            unsigned int half = n / 2;
+            base = (_records[base + half].key <= key_value) ? base + half : base;
+            n -= half;
+        }
+
+        return base;
     }
 
+#   if defined(__AVX2__)
     /**
-     * \brief Calculates interpolation data (gradient).
-     * \param key_0 current key
-     * \param value_0 current value
-     * \param key_1 next key
-     * \param value_1 next value
-     * \return
+     * \brief Calculates values for the given keys, 4 keys at once.
+     * \param key_values key values
+     * \param values output values
+     * \param count number of keys
+     * \return number of processed keys, remaining ones has to be processed by the scalar code
      */
-    double calculateInterpolationData(KEY_TYPE key_0, VAL_TYPE value_0,
-                                      KEY_TYPE key_1, VAL_TYPE value_1) const
+    size_t getValuesAVX2(const double* key_values, double* values, size_t count) const
     {
-        return static_cast<double>(value_1 - value_0) / static_cast<double>(key_1 - key_0);
+        static_assert(sizeof(Record) == 5 * sizeof(double), "Unexpected table record layout.");
+
+        const double* data = reinterpret_cast<const double*>(_records);
+
+        const __m256d key_first = _mm256_set1_pd(_records[0].key);
+        const __m256d key_last  = _mm256_set1_pd(_records[_last].key);
+        const __m256d val_first = _mm256_set1_pd(_records[0].value);
+        const __m256d val_last  = _mm256_set1_pd(_records[_last].value);
+
+        size_t i = 0;
+
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m256d key = _mm256_loadu_pd(key_values + i);
+
+            // the same branchless search as in findIndexBranchless()
+            // all lanes share the same number of iterations
+            __m256i base = _mm256_setzero_si256();
+            unsigned int n = _last;
+
+            while (n > 1)
+            {
+                unsigned int half = n / 2;
+                __m256i probe = _mm256_add_epi64(base, _mm256_set1_epi64x(half));
+                __m256i probe_offset = recordOffsetAVX2(probe);
+                __m256d probe_key = _mm256_i64gather_pd(data, probe_offset, sizeof(double));
+                __m256d le = _mm256_cmp_pd(probe_key, key, _CMP_LE_OQ);
+                base = _mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(base),
+                                                            _mm256_castsi256_pd(probe), le));
+                n -= half;
+            }
+
+            const __m256i offset = recordOffsetAVX2(base);
+
+            const __m256d k = _mm256_i64gather_pd(data + 0, offset, sizeof(double));
+            const __m256d v = _mm256_i64gather_pd(data + 1, offset, sizeof(double));
+            const __m256d b = _mm256_i64gather_pd(data + 2, offset, sizeof(double));
+            const __m256d c = _mm256_i64gather_pd(data + 3, offset, sizeof(double));
+            const __m256d d = _mm256_i64gather_pd(data + 4, offset, sizeof(double));
+
+            // the same evaluation order as in calculateInterpolatedValue()
+            const __m256d dk = _mm256_sub_pd(key, k);
+            __m256d poly = _mm256_add_pd(_mm256_mul_pd(dk, d), c);
+            poly = _mm256_add_pd(_mm256_mul_pd(dk, poly), b);
+            poly = _mm256_mul_pd(dk, poly);
+
+            __m256d value = _mm256_add_pd(poly, v);
+            value = _mm256_blendv_pd(value, val_first, _mm256_cmp_pd(key, key_first, _CMP_LE_OQ));
+            value = _mm256_blendv_pd(value, val_last , _mm256_cmp_pd(key, key_last , _CMP_GE_OQ));
+
+            _mm256_storeu_pd(values + i, value);
+        }
+
+        return i;
+    }
+
+    /**
+     * \brief Returns offsets (in doubles) of the records of the given indices.
+     * Record is 5 doubles: key, value and 3 polynomial coefficients.
+     */
+    static __m256i recordOffsetAVX2(__m256i index)
+    {
+        return _mm256_add_epi64(_mm256_slli_epi64(index, 2), index);
+    }
+#   endif
+
+    /**
+     * \brief Checks if keys are uniformly spaced.
+     * \return true if all keys steps are equal within tolerance
+     */
+    bool areKeysUniform() const
+    {
+        if (_size < 3)
+        {
+            return false;
+        }
+
+        const double step = static_cast<double>(_records[_last].key - _records[0].key) / _last;
+        const double tol  = 1.0e-9 * fabs(step);
+
+        for (unsigned int i = 0; i < _last; ++i)
+        {
+            double delta = static_cast<double>(_records[i+1].key - _records[i].key);
+
+            if (!(fabs(delta - step) <= tol))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    VAL_TYPE calculateInterpolatedValue(unsigned int index, KEY_TYPE key_value) const
+    {
+        const Record& rec = _records[index];
+        const double dk = static_cast<double>(key_value - rec.key);
+        return VAL_TYPE{dk * (rec.slope + dk * (rec.quad + dk * rec.cubic))} + rec.value;
     }
 
     /** Creates data tables. */
     void createArrays()
     {
-        _key_values = new KEY_TYPE [_size];
-        _table_data = new VAL_TYPE [_size];
-        _inter_data = new double [_size];
+        _records = AllocatorTraits::allocate(_allocator, _size);
+        std::uninitialized_value_construct_n(_records, _size);
     }
 
     /** Deletes data tables. */
     void deleteArrays()
     {
-        if ( _key_values ) { delete[] _key_values; } _key_values = nullptr;
-        if ( _table_data ) { delete[] _table_data; } _table_data = nullptr;
-        if ( _inter_data ) { delete[] _inter_data; } _inter_data = nullptr;
+        if (_records && !_view)
+        {
+            std::destroy_n(_records, _size);
+            AllocatorTraits::deallocate(_allocator, _records, _size);
+        }
+        _records = nullptr;
+        _view = false;
+    }
+
+    /**
+     * \brief Makes table reference the given external records.
+     * Records are not copied, so they have to outlive the table.
+     * \param records records
+     * \param size number of records
+     * \param search key index search method
+     * \param interpolation interpolation method the records were calculated with
+     */
+    void setView(const Record* records, unsigned int size,
+                 TableSearch search, TableInterpolation interpolation)
+    {
+        deleteArrays();
+
+        _size = size;
+        _last = size - 1;
+
+        // records are never modified in place, see detach()
+        _records = const_cast<Record*>(records);
+        _view = true;
+
+        _search = search;
+        _interpolation = interpolation;
+
+        updateKeyStep();
+    }
+
+    /** \brief Makes table own its records, copies them if they are referenced. */
+    void detach()
+    {
+        if (_view)
+        {
+            const Record* records = _records;
+
+            _records = nullptr;
+            _view = false;
+
+            createArrays();
+            std::copy(records, records + _size, _records);
+        }
+    }
+
+    /** \brief Updates inverse of the mean key step. */
+    void updateKeyStep()
+    {
+        _key_step_inv = 0.0;
+
+        if (_last > 0)
+        {
+            _key_step_inv = _last / static_cast<double>(_records[_last].key - _records[0].key);
+        }
     }
 
     /** \brief Updates interpolation data due to table data. */
     void updateInterpolationData()
     {
+        updateKeyStep();
+
         for (unsigned int i = 0; i < _size; ++i)
         {
-            if (i < _last)
+            _records[i].slope = 0.0;
+            _records[i].quad  = 0.0;
+            _records[i].cubic = 0.0;
+        }
+
+        if (_last == 0)
+        {
+            return;
+        }
+
+        std::vector<double> h(_last);       // intervals widths
+        std::vector<double> delta(_last);   // intervals secants
+
+        for (unsigned int i = 0; i < _last; ++i)
+        {
+            h[i] = static_cast<double>(_records[i+1].key - _records[i].key);
+            delta[i] = static_cast<double>(_records[i+1].value - _records[i].value) / h[i];
+        }
+
+        if (_interpolation == TableInterpolation::Linear)
+        {
+            for (unsigned int i = 0; i < _last; ++i)
             {
-                _inter_data[i] = calculateInterpolationData(_key_values[i],
-                                                            _table_data[i],
-                                                            _key_values[i+1],
-                                                            _table_data[i+1]);
+                _records[i].slope = delta[i];
             }
-            else
+
+            return;
+        }
+
+        std::vector<double> deriv = (_interpolation == TableInterpolation::Pchip)
+                                  ? calculateDerivativesPchip(h, delta)
+                                  : calculateDerivativesSpline(h, delta);
+
+        // cubic Hermite polynomial coefficients
+        for (unsigned int i = 0; i < _last; ++i)
+        {
+            _records[i].slope = deriv[i];
+            _records[i].quad  = (3.0 * delta[i] - 2.0 * deriv[i] - deriv[i+1]) / h[i];
+            _records[i].cubic = (deriv[i] + deriv[i+1] - 2.0 * delta[i]) / (h[i] * h[i]);
+        }
+    }
+
+    /**
+     * \brief Calculates first derivatives at keys of the natural cubic spline.
+     * \param h intervals widths
+     * \param delta intervals secants
+     * \return first derivatives at keys
+     */
+    static std::vector<double> calculateDerivativesSpline(const std::vector<double>& h,
+                                                          const std::vector<double>& delta)
+    {
+        const size_t n = h.size();  // number of intervals
+
+        // second derivatives, zero at both ends
+        std::vector<double> m(n + 1, 0.0);
+
+        if (n > 1)
+        {
+            // tridiagonal system solved with the Thomas algorithm
+            std::vector<double> diag(n + 1, 0.0);
+            std::vector<double> rhs(n + 1, 0.0);
+
+            for (size_t i = 1; i < n; ++i)
+            {
+                diag[i] = 2.0 * (h[i-1] + h[i]);
+                rhs[i]  = 6.0 * (delta[i] - delta[i-1]);
+            }
+
+            for (size_t i = 2; i < n; ++i)
+            {
+                double w = h[i-1] / diag[i-1];
+                diag[i] -= w * h[i-1];
+                rhs[i]  -= w * rhs[i-1];
+            }
+
+            for (size_t i = n - 1; i > 0; --i)
             {
-                _inter_data[i] = 0.0;
+                m[i] = (rhs[i] - h[i] * m[i+1]) / diag[i];
             }
         }
+
+        std::vector<double> deriv(n + 1);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            deriv[i] = delta[i] - h[i] * (2.0 * m[i] + m[i+1]) / 6.0;
+        }
+
+        deriv[n] = delta[n-1] + h[n-1] * (m[n-1] + 2.0 * m[n]) / 6.0;
+
+        return deriv;
+    }
+
+    /**
+     * \brief Calculates first derivatives at keys of the monotone cubic.
+     *
+     * Derivatives are calculated with the Fritsch-Butland weighted harmonic
+     * mean, which makes the interpolant monotone wherever data is monotone.
+     *
+     * \param h intervals widths
+     * \param delta intervals secants
+     * \return first derivatives at keys
+     */
+    static std::vector<double> calculateDerivativesPchip(const std::vector<double>& h,
+                                                         const std::vector<double>& delta)
+    {
+        const size_t n = h.size();  // number of intervals
+
+        std::vector<double> deriv(n + 1, delta[0]);
+
+        if (n > 1)
+        {
+            for (size_t i = 1; i < n; ++i)
+            {
+                if (delta[i-1] * delta[i] > 0.0)
+                {
+                    double w1 = 2.0 * h[i] + h[i-1];
+                    double w2 = h[i] + 2.0 * h[i-1];
+                    deriv[i] = (w1 + w2) / (w1 / delta[i-1] + w2 / delta[i]);
+                }
+                else
+                {
+                    deriv[i] = 0.0;
+                }
+            }
+
+            deriv[0] = calculateEndDerivativePchip(h[0], h[1], delta[0], delta[1]);
+            deriv[n] = calculateEndDerivativePchip(h[n-1], h[n-2], delta[n-1], delta[n-2]);
+        }
+
+        return deriv;
+    }
+
+    /**
+     * \brief Calculates monotone cubic end point derivative.
+     * Non-centered three-point formula, limited to preserve shape.
+     * \param h0 end interval width
+     * \param h1 next interval width
+     * \param delta0 end interval secant
+     * \param delta1 next interval secant
+     * \return end point derivative
+     */
+    static double calculateEndDerivativePchip(double h0, double h1, double delta0, double delta1)
+    {
+        double d = ((2.0 * h0 + h1) * delta0 - h0 * delta1) / (h0 + h1);
+
+        if (d * delta0 <= 0.0)
+        {
+            d = 0.0;
+        }
+        else if (delta0 * delta1 < 0.0 && fabs(d) > fabs(3.0 * delta0))
+        {
+            d = 3.0 * delta0;
+        }
+
+        return d;
     }
 };
 
 /** \brief Multiplication operator (by number). */
-template <typename KEY_TYPE, typename VAL_TYPE>
-inline Table<KEY_TYPE,VAL_TYPE> operator*(double val, const Table<KEY_TYPE,VAL_TYPE>& table)
+template <typename KEY_TYPE, typename VAL_TYPE, typename ALLOCATOR>
+inline Table<KEY_TYPE,VAL_TYPE,ALLOCATOR> operator*(double val, const Table<KEY_TYPE,VAL_TYPE,ALLOCATOR>& table)
 {
     return table * val;
 }
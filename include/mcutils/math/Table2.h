@@ -22,8 +22,14 @@
 #ifndef MCUTILS_MATH_TABLE2_H_
 #define MCUTILS_MATH_TABLE2_H_
 
+#include <algorithm>
+#include <cassert>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <limits>
+#include <memory>
+#include <span>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -40,46 +46,95 @@ using namespace units::math;
 
 namespace mc {
 
+/**
+ * \brief 2D table lookup cursor.
+ *
+ * Cursor keeps indices of the row and column intervals found by the previous
+ * query. It is owned by the caller, so a single const table can be shared
+ * between threads, each using its own cursor.
+ *
+ * \sa TableCursor
+ */
+struct Table2Cursor
+{
+    TableCursor row;    ///< rows lookup cursor
+    TableCursor col;    ///< columns lookup cursor
+};
+
+/**
+ * \brief 2D table cell.
+ *
+ * Cell holds table value together with the gradient towards the next column,
+ * so interpolation within a row touches only two adjacent cells.
+ *
+ * \tparam VAL_TYPE value type
+ */
+template <typename VAL_TYPE>
+struct Table2Cell
+{
+    VAL_TYPE value = VAL_TYPE{0};   ///< table value
+    double   slope = 0.0;           ///< interpolation data (gradient along row)
+};
+
 /**
  * \brief 2D table and bilinear interpolation class template.
+ *
+ * Rows keys, columns keys and table cells are stored in a single memory
+ * block allocated with the given allocator. Tables loaded from TableFile
+ * reference memory block of the mapped file instead, and copy it only when
+ * modified.
+ *
+ * \tparam ROW_TYPE rows key type
+ * \tparam COL_TYPE columns key type
+ * \tparam VAL_TYPE value type
+ * \tparam ALLOCATOR allocator type, rebound to std::max_align_t
  */
-template <typename ROW_TYPE, typename COL_TYPE, typename VAL_TYPE>
+template <typename ROW_TYPE, typename COL_TYPE, typename VAL_TYPE,
+          typename ALLOCATOR = std::allocator<std::byte>>
 class Table2
 {
+    friend class TableFile;
+    friend class TableFileWriter;
+
 public:
 
+    using Cell = Table2Cell<VAL_TYPE>;
+    using Block = std::max_align_t;
+    using Allocator = typename std::allocator_traits<ALLOCATOR>::template rebind_alloc<Block>;
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+
+    static_assert(alignof(ROW_TYPE) <= alignof(Block)
+               && alignof(COL_TYPE) <= alignof(Block)
+               && alignof(Cell)     <= alignof(Block), "Unsupported table types alignment.");
+
     /** \brief Copy constructor. */
-    Table2(const Table2<ROW_TYPE,COL_TYPE,VAL_TYPE>& table)
-        : _rows(table._rows)
+    Table2(const Table2<ROW_TYPE,COL_TYPE,VAL_TYPE,ALLOCATOR>& table)
+        : _allocator(AllocatorTraits::select_on_container_copy_construction(table._allocator))
+        , _rows(table._rows)
         , _cols(table._cols)
         , _size(table._size)
     {
         if (_size > 0)
         {
             createArrays();
-
-            for (unsigned int i = 0; i < _rows; ++i) _row_values[i] = table._row_values[i];
-            for (unsigned int i = 0; i < _cols; ++i) _col_values[i] = table._col_values[i];
-
-            for (unsigned int i = 0; i < _size; ++i)
-            {
-                _table_data[i] = table._table_data[i];
-                _inter_data[i] = table._inter_data[i];
-            }
+            copyArrays(table);
         }
     }
 
     /** \brief Move constructor. */
-    Table2(Table2<ROW_TYPE,COL_TYPE,VAL_TYPE>&& table) noexcept
-        : _rows(std::exchange(table._rows, 0))
+    Table2(Table2<ROW_TYPE,COL_TYPE,VAL_TYPE,ALLOCATOR>&& table) noexcept
+        : _allocator(std::move(table._allocator))
+        , _rows(std::exchange(table._rows, 0))
         , _cols(std::exchange(table._cols, 0))
         , _size(std::exchange(table._size, 0))
 
+        , _block(std::exchange(table._block, nullptr))
+        , _block_size(std::exchange(table._block_size, 0))
+        , _view(std::exchange(table._view, false))
+
         , _row_values(std::exchange(table._row_values, nullptr))
         , _col_values(std::exchange(table._col_values, nullptr))
-        , _table_data(std::exchange(table._table_data, nullptr))
-
-        , _inter_data(std::exchange(table._inter_data, nullptr))
+        , _cells(std::exchange(table._cells, nullptr))
     {}
 
     /**
@@ -88,10 +143,13 @@ public:
      * \param val record value
      * \param row_val row key value
      * \param col_val col key value
+     * \param allocator allocator
      */
     Table2(VAL_TYPE val = VAL_TYPE{0},
            ROW_TYPE row_val = ROW_TYPE{0},
-           COL_TYPE col_val = COL_TYPE{0})
+           COL_TYPE col_val = COL_TYPE{0},
+           const ALLOCATOR& allocator = ALLOCATOR())
+        : _allocator(allocator)
     {
         _rows = 1;
         _cols = 1;
@@ -101,8 +159,8 @@ public:
 
         _row_values[0] = row_val;
         _col_values[0] = col_val;
-        _table_data[0] = val;
-        _inter_data[0] = 0.0;
+        _cells[0].value = val;
+        _cells[0].slope = 0.0;
 
         updateInterpolationData();
     }
@@ -116,10 +174,13 @@ public:
      * \param row_values rows key values ordered vector
      * \param col_values columns key values ordered vector
      * \param table_data table values ordered vector
+     * \param allocator allocator
      */
     Table2(const std::vector<ROW_TYPE>& row_values,
            const std::vector<COL_TYPE>& col_values,
-           const std::vector<VAL_TYPE>& table_data)
+           const std::vector<VAL_TYPE>& table_data,
+           const ALLOCATOR& allocator = ALLOCATOR())
+        : _allocator(allocator)
     {
         setData(row_values, col_values, table_data);
     }
@@ -153,7 +214,8 @@ public:
      * \brief Returns table value for the given keys.
      *
      * Returns table value for the given keys values using bilinear
-     * interpolation algorithm.
+     * interpolation algorithm. This function doesn't modify table state,
+     * so it is safe to call it concurrently on a shared table.
      *
      * \param rowValue row key value
      * \param colValue column key value
@@ -163,59 +225,97 @@ public:
     {
         if (_size > 0)
         {
-            if (row_value < _row_values[0])
-                return getValue(_row_values[0], col_value);
+            clampKeys(&row_value, &col_value);
 
-            if (col_value < _col_values[0])
-                return getValue(row_value, _col_values[0]);
-
-            if (row_value > _row_values[_rows - 1])
-                return getValue(_row_values[_rows - 1], col_value);
+            return calculateInterpolatedValue(findRowIndex(row_value), findColIndex(col_value),
+                                              row_value, col_value);
+        }
 
-            if (col_value > _col_values[_cols - 1])
-                return getValue(row_value, _col_values[_cols - 1]);
+        return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
+    }
 
-            unsigned int row_1 = 0;
-            unsigned int row_2 = 0;
+    /**
+     * \brief Returns table value for the given keys.
+     *
+     * Returns table value for the given keys values using bilinear
+     * interpolation algorithm. Intervals stored in the given cursor are
+     * checked first and the search is done only if the keys are outside
+     * of them.
+     *
+     * \param rowValue row key value
+     * \param colValue column key value
+     * \param cursor lookup cursor
+     * \return interpolated value on success or NaN on failure
+     */
+    VAL_TYPE getValue(ROW_TYPE row_value, COL_TYPE col_value, Table2Cursor& cursor) const
+    {
+        if (_size > 0)
+        {
+            clampKeys(&row_value, &col_value);
 
-            for (unsigned int r = 1; r < _rows; ++r)
+            // cursor might have been used with another table, so it has to be bound checked
+            if (!(cursor.row.index + 1 < _rows
+               && row_value >= _row_values[cursor.row.index]
+               && row_value <  _row_values[cursor.row.index + 1]))
             {
-                row_1 = r - 1;
-                row_2 = r;
+                cursor.row.index = findRowIndex(row_value);
+            }
 
-                if (row_value >= _row_values[row_1] && row_value < _row_values[row_2]) break;
+            if (!(cursor.col.index + 1 < _cols
+               && col_value >= _col_values[cursor.col.index]
+               && col_value <  _col_values[cursor.col.index + 1]))
+            {
+                cursor.col.index = findColIndex(col_value);
             }
 
-            unsigned int col_1 = 0;
-            unsigned int col_2 = 0;
+            return calculateInterpolatedValue(cursor.row.index, cursor.col.index,
+                                              row_value, col_value);
+        }
 
-            for (unsigned int c = 1; c < _cols; ++c)
-            {
-                col_1 = c - 1;
-                col_2 = c;
+        return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
+    }
 
-                if (col_value >= _col_values[col_1] && col_value < _col_values[col_2]) break;
-            }
+    /**
+     * \brief Returns table values for the given keys.
+     *
+     * Batch version of getValue(). Keys are clamped to the table range and
+     * intervals search is branchless, so it has the same cost for every pair
+     * of keys and doesn't suffer from branch mispredictions.
+     *
+     * \param row_values row key values
+     * \param col_values column key values, size should match row key values size
+     * \param values output values, size should match row key values size
+     */
+    void getValues(std::span<const ROW_TYPE> row_values,
+                   std::span<const COL_TYPE> col_values,
+                   std::span<VAL_TYPE> values) const
+    {
+        assert(row_values.size() == col_values.size());
+        assert(row_values.size() == values.size());
+
+        const size_t count = std::min({ row_values.size(), col_values.size(), values.size() });
 
-            VAL_TYPE result_1 = static_cast<double>(col_value - _col_values[col_1])
-                            * _inter_data[row_1 * _cols + col_1]
-                            + _table_data[row_1 * _cols + col_1];
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (_size > 0)
+            {
+                ROW_TYPE row_value = row_values[i];
+                COL_TYPE col_value = col_values[i];
 
-            VAL_TYPE result_2 = static_cast<double>(col_value - _col_values[col_1])
-                            * _inter_data[row_2 * _cols + col_1]
-                            + _table_data[row_2 * _cols + col_1];
+                row_value = (row_value < _row_values[0]) ? _row_values[0] : row_value;
+                col_value = (col_value < _col_values[0]) ? _col_values[0] : col_value;
+                row_value = (row_value > _row_values[_rows - 1]) ? _row_values[_rows - 1] : row_value;
+                col_value = (col_value > _col_values[_cols - 1]) ? _col_values[_cols - 1] : col_value;
 
-            double rowFactor = 0.0;
-            double rowDelta  = static_cast<double>(_row_values[row_2] - _row_values[row_1]);
-            if (fabs(rowDelta) > 1.0e-16)
+                values[i] = calculateInterpolatedValue(findIndexBranchless(_row_values, _rows, row_value),
+                                                       findIndexBranchless(_col_values, _cols, col_value),
+                                                       row_value, col_value);
+            }
+            else
             {
-                rowFactor = (row_value - _row_values[row_1]) / rowDelta;
+                values[i] = VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
             }
-
-            return rowFactor * (result_2 - result_1) + result_1;
         }
-
-        return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
     }
 
     /**
@@ -229,7 +329,7 @@ public:
         if (_rows > 0 && row_index < _rows
          && _cols > 0 && col_index < _cols)
         {
-            return _table_data[row_index * _cols + col_index];
+            return _cells[row_index * _cols + col_index].value;
         }
 
         return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
@@ -267,8 +367,8 @@ public:
 
             for (unsigned int i = 0; i < _size && result; ++i)
             {
-                result &= check::isValid(_table_data[i]);
-                result &= check::isValid(_inter_data[i]);
+                result &= check::isValid(_cells[i].value);
+                result &= check::isValid(_cells[i].slope);
             }
         }
 
@@ -281,6 +381,8 @@ public:
      */
     void multiplyRows(double factor)
     {
+        detach();
+
         for (unsigned int i = 0; i < _rows; ++i)
         {
             _row_values[i] *= factor;
@@ -295,6 +397,8 @@ public:
      */
     void multiplyCols(double factor)
     {
+        detach();
+
         for (unsigned int i = 0; i < _cols; ++i)
         {
             _col_values[i] *= factor;
@@ -309,9 +413,11 @@ public:
      */
     void multiplyValues(double factor)
     {
+        detach();
+
         for (unsigned int i = 0; i < _size; ++i)
         {
-            _table_data[i] *= factor;
+            _cells[i].value *= factor;
         }
 
         updateInterpolationData();
@@ -333,6 +439,10 @@ public:
     {
         deleteArrays();
 
+        _rows = 0;
+        _cols = 0;
+        _size = 0;
+
         if (row_values.size() * col_values.size() == table_data.size())
         {
             _size = static_cast< unsigned int >( table_data.size() );
@@ -349,8 +459,8 @@ public:
 
                 for (unsigned int i = 0; i < _size; ++i)
                 {
-                    _table_data[i] = table_data[i];
-                    _inter_data[i] = 0.0;
+                    _cells[i].value = table_data[i];
+                    _cells[i].slope = 0.0;
                 }
 
                 updateInterpolationData();
@@ -361,61 +471,84 @@ public:
     /**
      * \brief Sets table data from string.
      *
-     * Values in the given string should be separated with whitespaces.
+     * Values in the given string should be separated with whitespaces. The
+     * first line contains columns keys, every next row starts with row key
+     * followed by the row values. Keys and values are parsed directly into
+     * the table storage, which is sized up front. On failure table is set to
+     * a single NaN cell.
      *
      * \param str given string
+     * \return parsing result, with position of the first invalid token on failure
      */
-    void setFromString(const char* str)
+    str::ParseResult setFromString(const char* str)
     {
-        std::vector<ROW_TYPE> row_values_tmp;
-        std::vector<COL_TYPE> col_values_tmp;
-        std::vector<VAL_TYPE> table_data_tmp;
+        str::NumberReader reader(str);
+
+        const size_t cols  = reader.countNumbersInLine();
+        const size_t count = reader.countNumbers();
+
+        deleteArrays();
+
+        // number of rows is rounded up, so incomplete rows are reported by the reader as missing data
+        const size_t data = count - cols;   // every row is a key and "cols" values
+        const size_t rows = (data + cols) / (cols + 1);
 
-        std::stringstream ss(str::stripSpaces(str));
-        std::stringstream sl(str::getFirstLine(ss.str()));
+        // number of cells has to fit the size type
+        if (!isSizeValid(std::max<size_t>(1, rows), std::max<size_t>(1, cols)))
+        {
+            setData({ ROW_TYPE{std::numeric_limits<double>::quiet_NaN()} },
+                    { COL_TYPE{std::numeric_limits<double>::quiet_NaN()} },
+                    { VAL_TYPE{std::numeric_limits<double>::quiet_NaN()} });
+
+            str::ParseResult result;
+            result.valid  = false;
+            result.line   = 1;
+            result.column = 1;
+            result.error  = "too many values";
+            return result;
+        }
+
+        _cols = static_cast<unsigned int>(std::max<size_t>(1, cols));
+        _rows = static_cast<unsigned int>(std::max<size_t>(1, rows));
+        _size = _rows * _cols;
 
-        bool valid = true;
+        createArrays();
 
-        // cols keys
-        while (!sl.eof() && valid)
+        for (unsigned int c = 0; c < _cols; ++c)
         {
-            double key = std::numeric_limits<double>::quiet_NaN();
-            sl >> key; // sic!
-            ss >> key; // sic!
-            valid &= check::isValid(key);
-            col_values_tmp.push_back(COL_TYPE{key});
+            double key = 0.0;
+            if (!reader.read(&key)) break;
+            _col_values[c] = COL_TYPE{key};
         }
 
-        // table rows
-        while (!ss.eof() && valid)
+        for (unsigned int r = 0; r < _rows; ++r)
         {
-            double key = std::numeric_limits<double>::quiet_NaN();
-            ss >> key;
-            valid &= check::isValid(key);
-            row_values_tmp.push_back(ROW_TYPE{key});
+            double key = 0.0;
+            if (!reader.read(&key)) break;
+            _row_values[r] = ROW_TYPE{key};
 
-            // table data
-            for (unsigned int i = 0; i < col_values_tmp.size(); i++)
+            for (unsigned int c = 0; c < _cols; ++c)
             {
-                double val = std::numeric_limits<double>::quiet_NaN();
-                ss >> val;
-                valid &= check::isValid(val);
-                table_data_tmp.push_back(VAL_TYPE{val});
+                double val = 0.0;
+                if (!reader.read(&val)) break;
+                _cells[r * _cols + c].value = VAL_TYPE{val};
             }
         }
 
-        std::vector<ROW_TYPE> row_values { ROW_TYPE{std::numeric_limits<double>::quiet_NaN()} };
-        std::vector<COL_TYPE> col_values { COL_TYPE{std::numeric_limits<double>::quiet_NaN()} };
-        std::vector<VAL_TYPE> table_data { VAL_TYPE{std::numeric_limits<double>::quiet_NaN()} };
+        str::ParseResult result = reader.getResult();
 
-        if (valid)
+        if (result.valid)
+        {
+            updateInterpolationData();
+        }
+        else
         {
-            row_values = row_values_tmp;
-            col_values = col_values_tmp;
-            table_data = table_data_tmp;
+            setData({ ROW_TYPE{std::numeric_limits<double>::quiet_NaN()} },
+                    { COL_TYPE{std::numeric_limits<double>::quiet_NaN()} },
+                    { VAL_TYPE{std::numeric_limits<double>::quiet_NaN()} });
         }
 
-        setData(row_values, col_values, table_data);
+        return result;
     }
 
     /**
@@ -440,7 +573,7 @@ public:
             ss << static_cast<double>(_row_values[r]);
             for (unsigned int c = 0; c < _cols; ++c)
             {
-                ss << "\t" << static_cast<double>(_table_data[r * _cols + c]);
+                ss << "\t" << static_cast<double>(_cells[r * _cols + c].value);
             }
             ss << std::endl;
         }
@@ -452,7 +585,7 @@ public:
     inline unsigned int cols() const { return _cols; }
 
     /** \brief Assignment operator. */
-    Table2<ROW_TYPE,COL_TYPE,VAL_TYPE>& operator=(const Table2<ROW_TYPE,COL_TYPE,VAL_TYPE>& table)
+    Table2<ROW_TYPE,COL_TYPE,VAL_TYPE,ALLOCATOR>& operator=(const Table2<ROW_TYPE,COL_TYPE,VAL_TYPE,ALLOCATOR>& table)
     {
         if (this != &table)
         {
@@ -465,15 +598,7 @@ public:
             if (_size > 0)
             {
                 createArrays();
-
-                for (unsigned int i = 0; i < _rows; ++i) _row_values[i] = table._row_values[i];
-                for (unsigned int i = 0; i < _cols; ++i) _col_values[i] = table._col_values[i];
-
-                for (unsigned int i = 0; i < _size; ++i)
-                {
-                    _table_data[i] = table._table_data[i];
-                    _inter_data[i] = table._inter_data[i];
-                }
+                copyArrays(table);
             }
         }
 
@@ -481,50 +606,322 @@ public:
     }
 
     /** \brief Move assignment operator. */
-    Table2<ROW_TYPE,COL_TYPE,VAL_TYPE>& operator=(Table2<ROW_TYPE,COL_TYPE,VAL_TYPE>&& table)
+    Table2<ROW_TYPE,COL_TYPE,VAL_TYPE,ALLOCATOR>& operator=(Table2<ROW_TYPE,COL_TYPE,VAL_TYPE,ALLOCATOR>&& table)
     {
+        if constexpr (!AllocatorTraits::propagate_on_container_move_assignment::value
+                   && !AllocatorTraits::is_always_equal::value)
+        {
+            // memory allocated by the other allocator cannot be taken over
+            if (_allocator != table._allocator)
+            {
+                return *this = table;
+            }
+        }
+
         deleteArrays();
 
+        if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value)
+        {
+            _allocator = std::move(table._allocator);
+        }
+
         _rows = std::exchange(table._rows, 0);
         _cols = std::exchange(table._cols, 0);
         _size = std::exchange(table._size, 0);
 
+        _block = std::exchange(table._block, nullptr);
+        _block_size = std::exchange(table._block_size, 0);
+        _view = std::exchange(table._view, false);
+
         _row_values = std::exchange(table._row_values, nullptr);
         _col_values = std::exchange(table._col_values, nullptr);
-        _table_data = std::exchange(table._table_data, nullptr);
-
-        _inter_data = std::exchange(table._inter_data, nullptr);
+        _cells = std::exchange(table._cells, nullptr);
 
         return *this;
     }
 
 private:
 
+    Allocator _allocator;                 ///< memory block allocator
+
     unsigned int _rows = 0;               ///< number of rows
     unsigned int _cols = 0;               ///< number of columns
     unsigned int _size = 0;               ///< number of table elements
 
+    Block* _block = nullptr;              ///< memory block holding all the arrays
+    size_t _block_size = 0;               ///< memory block size (number of Block units)
+    bool _view = false;                   ///< specifies if memory block is not owned (referenced external memory)
+
     ROW_TYPE* _row_values = nullptr;      ///< rows keys values
     COL_TYPE* _col_values = nullptr;      ///< columns keys values
-    VAL_TYPE* _table_data = nullptr;      ///< table data
-    double* _inter_data = nullptr;        ///< interpolation data matrix
+    Cell* _cells = nullptr;               ///< table cells (values and interpolation data)
+
+    /**
+     * \brief Clamps keys to the table range.
+     * \param row_value row key value
+     * \param col_value column key value
+     */
+    void clampKeys(ROW_TYPE* row_value, COL_TYPE* col_value) const
+    {
+        if (*row_value < _row_values[0])
+            *row_value = _row_values[0];
+        else if (*row_value > _row_values[_rows - 1])
+            *row_value = _row_values[_rows - 1];
+
+        if (*col_value < _col_values[0])
+            *col_value = _col_values[0];
+        else if (*col_value > _col_values[_cols - 1])
+            *col_value = _col_values[_cols - 1];
+    }
+
+    /**
+     * \brief Finds index of the row interval containing the given key.
+     * \param row_value row key value
+     * \return index of the interval first row
+     */
+    unsigned int findRowIndex(ROW_TYPE row_value) const
+    {
+        return findIndexBinary(_row_values, _rows, row_value);
+    }
+
+    /**
+     * \brief Finds index of the column interval containing the given key.
+     * \param col_value column key value
+     * \return index of the interval first column
+     */
+    unsigned int findColIndex(COL_TYPE col_value) const
+    {
+        return findIndexBinary(_col_values, _cols, col_value);
+    }
+
+    /**
+     * \brief Finds index of the interval containing the given key.
+     *
+     * Key value is expected to be within the keys range. Key equal to the last
+     * key belongs to the last interval.
+     *
+     * \param keys key values
+     * \param size number of keys
+     * \param key_value key value
+     * \return index of the interval first key
+     */
+    template <typename KEY_TYPE>
+    static unsigned int findIndexBinary(const KEY_TYPE* keys, unsigned int size, KEY_TYPE key_value)
+    {
+        // invariant: keys[lo] <= key_value < keys[hi]
+        unsigned int lo = 0;
+        unsigned int hi = (size > 1) ? size - 1 : 0;
+
+        while (hi - lo > 1)
+        {
+            unsigned int mid = (lo + hi) / 2;
+
+            if (key_value < keys[mid])
+                hi = mid;
+            else
+                lo = mid;
+        }
+
+        return lo;
+    }
+
+    /**
+     * \brief Finds index of the interval containing the given key.
+     *
+     * Finds the last key not greater than the given one among all but the last
+     * keys. Number of iterations depends only on the number of keys.
+     *
+     * \param keys key values
+     * \param size number of keys
+     * \param key_value key value
+     * \return index of the interval first key
+     */
+    template <typename KEY_TYPE>
+    static unsigned int findIndexBranchless(const KEY_TYPE* keys, unsigned int size, KEY_TYPE key_value)
+    {
+        unsigned int base = 0;
+        unsigned int n = (size > 1) ? size - 1 : 1;
+
+        while (n > 1)
+        {
+            unsigned int half = n / 2;
+            base = (keys[base + half] <= key_value) ? base + half : base;
+            n -= half;
+        }
+
+        return base;
+    }
+
+    /**
+     * \brief Calculates bilinear interpolated value.
+     * \param row_1 index of the interval first row
+     * \param col_1 index of the interval first column
+     * \param row_value row key value
+     * \param col_value column key value
+     * \return interpolated value
+     */
+    VAL_TYPE calculateInterpolatedValue(unsigned int row_1, unsigned int col_1,
+                                        ROW_TYPE row_value, COL_TYPE col_value) const
+    {
+        unsigned int row_2 = (row_1 + 1 < _rows) ? row_1 + 1 : row_1;
+
+        VAL_TYPE result_1 = static_cast<double>(col_value - _col_values[col_1])
+                        * _cells[row_1 * _cols + col_1].slope
+                        + _cells[row_1 * _cols + col_1].value;
+
+        VAL_TYPE result_2 = static_cast<double>(col_value - _col_values[col_1])
+                        * _cells[row_2 * _cols + col_1].slope
+                        + _cells[row_2 * _cols + col_1].value;
+
+        double rowFactor = 0.0;
+        double rowDelta  = static_cast<double>(_row_values[row_2] - _row_values[row_1]);
+        if (fabs(rowDelta) > 1.0e-16)
+        {
+            rowFactor = (row_value - _row_values[row_1]) / rowDelta;
+        }
+
+        return rowFactor * (result_2 - result_1) + result_1;
+    }
+
+    /**
+     * \brief Memory block layout: rows keys, columns keys, cells.
+     */
+    struct Layout
+    {
+        size_t col_offset  = 0;     ///< columns keys offset (bytes)
+        size_t cell_offset = 0;     ///< cells offset (bytes)
+        size_t bytes       = 0;     ///< memory block size (bytes)
+    };
+
+    /**
+     * \brief Returns memory block layout.
+     * \param rows number of rows
+     * \param cols number of columns
+     * \return memory block layout
+     */
+    static Layout getLayout(unsigned int rows, unsigned int cols)
+    {
+        Layout layout;
+        layout.col_offset  = alignOffset(rows * sizeof(ROW_TYPE), alignof(COL_TYPE));
+        layout.cell_offset = alignOffset(layout.col_offset + cols * sizeof(COL_TYPE), alignof(Cell));
+        layout.bytes       = layout.cell_offset + static_cast<size_t>(rows) * cols * sizeof(Cell);
+        return layout;
+    }
 
     /** Creates data tables. */
     void createArrays()
     {
-        _row_values = new ROW_TYPE [_rows];
-        _col_values = new COL_TYPE [_cols];
-        _table_data = new VAL_TYPE [_size];
-        _inter_data = new double [_size];
+        const Layout layout = getLayout(_rows, _cols);
+
+        _block_size = (layout.bytes + sizeof(Block) - 1) / sizeof(Block);
+        _block = AllocatorTraits::allocate(_allocator, _block_size);
+
+        setArrays(layout);
+
+        std::uninitialized_value_construct_n(_row_values, _rows);
+        std::uninitialized_value_construct_n(_col_values, _cols);
+        std::uninitialized_value_construct_n(_cells, _size);
     }
 
     /** Deletes data tables. */
     void deleteArrays()
     {
-        if ( _row_values ) { delete[] _row_values; } _row_values = nullptr;
-        if ( _col_values ) { delete[] _col_values; } _col_values = nullptr;
-        if ( _table_data ) { delete[] _table_data; } _table_data = nullptr;
-        if ( _inter_data ) { delete[] _inter_data; } _inter_data = nullptr;
+        if (_block && !_view)
+        {
+            std::destroy_n(_row_values, _rows);
+            std::destroy_n(_col_values, _cols);
+            std::destroy_n(_cells, _size);
+
+            AllocatorTraits::deallocate(_allocator, _block, _block_size);
+        }
+
+        _block = nullptr;
+        _block_size = 0;
+        _view = false;
+
+        _row_values = nullptr;
+        _col_values = nullptr;
+        _cells      = nullptr;
+    }
+
+    /** Sets arrays pointers due to the memory block and its layout. */
+    void setArrays(const Layout& layout)
+    {
+        std::byte* data = reinterpret_cast<std::byte*>(_block);
+
+        _row_values = reinterpret_cast<ROW_TYPE*>(data);
+        _col_values = reinterpret_cast<COL_TYPE*>(data + layout.col_offset);
+        _cells      = reinterpret_cast<Cell*>(data + layout.cell_offset);
+    }
+
+    /** Copies data tables from the given table of the same size. */
+    void copyArrays(const Table2<ROW_TYPE,COL_TYPE,VAL_TYPE,ALLOCATOR>& table)
+    {
+        std::copy(table._row_values, table._row_values + _rows, _row_values);
+        std::copy(table._col_values, table._col_values + _cols, _col_values);
+        std::copy(table._cells, table._cells + _size, _cells);
+    }
+
+    /**
+     * \brief Checks if number of cells fits the size type.
+     * \param rows number of rows
+     * \param cols number of columns
+     * \return true if table of the given dimensions can be created
+     */
+    static bool isSizeValid(uint64_t rows, uint64_t cols)
+    {
+        return rows <= std::numeric_limits<unsigned int>::max()
+            && cols <= std::numeric_limits<unsigned int>::max()
+            && rows * cols <= std::numeric_limits<unsigned int>::max();
+    }
+
+    /**
+     * \brief Makes table reference the given external memory block.
+     * Memory block is not copied, so it has to outlive the table.
+     * \param block memory block of the layout given by getLayout()
+     * \param rows number of rows
+     * \param cols number of columns, number of cells has to fit the size type, see isSizeValid()
+     */
+    void setView(const std::byte* block, unsigned int rows, unsigned int cols)
+    {
+        assert(isSizeValid(rows, cols));
+
+        deleteArrays();
+
+        _rows = rows;
+        _cols = cols;
+        _size = rows * cols;
+
+        // memory block is never modified in place, see detach()
+        _block = reinterpret_cast<Block*>(const_cast<std::byte*>(block));
+        _view = true;
+
+        setArrays(getLayout(_rows, _cols));
+    }
+
+    /** \brief Makes table own its memory block, copies it if it is referenced. */
+    void detach()
+    {
+        if (_view)
+        {
+            const ROW_TYPE* row_values = _row_values;
+            const COL_TYPE* col_values = _col_values;
+            const Cell* cells = _cells;
+
+            _block = nullptr;
+            _view = false;
+
+            createArrays();
+
+            std::copy(row_values, row_values + _rows, _row_values);
+            std::copy(col_values, col_values + _cols, _col_values);
+            std::copy(cells, cells + _size, _cells);
+        }
+    }
+
+    static size_t alignOffset(size_t offset, size_t alignment)
+    {
+        return (offset + alignment - 1) / alignment * alignment;
     }
 
     /** \brief Updates interpolation data due to table data. */
@@ -534,8 +931,8 @@ private:
         {
             for (unsigned int c = 0; c < _cols - 1; ++c)
             {
-                _inter_data[r * _cols + c] =
-                    static_cast<double>(_table_data[r * _cols + c + 1] - _table_data[r * _cols + c])
+                _cells[r * _cols + c].slope =
+                    static_cast<double>(_cells[r * _cols + c + 1].value - _cells[r * _cols + c].value)
                   / static_cast<double>(_col_values[c + 1] - _col_values[c]);
             }
         }
@@ -0,0 +1,394 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_TABLEFILE_H_
+#define MCUTILS_MATH_TABLEFILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <mcutils/mcutils_api.h>
+#include <mcutils/Result.h>
+
+#include <mcutils/math/Table.h>
+#include <mcutils/math/Table2.h>
+
+#include <mcutils/misc/MappedFile.h>
+
+namespace mc {
+
+/**
+ * \brief Table file entry type enum.
+ */
+enum class TableFileType : uint8_t
+{
+    Table  = 0x1,       ///< Table
+    Table2 = 0x2        ///< Table2
+};
+
+/**
+ * \brief Table file directory entry.
+ */
+struct TableFileEntry
+{
+    uint64_t data_offset = 0;   ///< table data offset (bytes from the beginning of the file)
+    uint64_t data_size   = 0;   ///< table data size (bytes)
+    uint64_t name_offset = 0;   ///< table name offset (bytes from the beginning of the file)
+    uint32_t name_size   = 0;   ///< table name length
+    uint8_t  type          = 0; ///< table type, see TableFileType
+    uint8_t  search        = 0; ///< key index search method, see TableSearch
+    uint8_t  interpolation = 0; ///< interpolation method, see TableInterpolation
+    uint8_t  reserved      = 0; ///< reserved
+    uint32_t rows = 0;          ///< number of rows (Table size)
+    uint32_t cols = 0;          ///< number of columns (1 for Table)
+};
+
+/**
+ * \brief Table file header.
+ */
+struct TableFileHeader
+{
+    static constexpr uint32_t kVersion   = 1;           ///< current format version
+    static constexpr uint32_t kByteOrder = 0x01020304;  ///< byte order mark
+
+    char magic[8] = { 'M', 'C', 'T', 'A', 'B', 'L', 'E', '\0' };   ///< file signature
+
+    uint32_t version    = kVersion;                 ///< format version
+    uint32_t byte_order = kByteOrder;               ///< byte order mark, as written by the writer
+    uint32_t count      = 0;                        ///< number of tables
+    uint32_t entry_size = sizeof(TableFileEntry);   ///< directory entry size (bytes)
+    uint64_t file_size  = 0;                        ///< file size (bytes)
+};
+
+static_assert(sizeof(TableFileEntry)  == 40, "Unexpected table file entry size.");
+static_assert(sizeof(TableFileHeader) == 32, "Unexpected table file header size.");
+
+/**
+ * \brief Binary table file writer.
+ *
+ * File layout (version 1, native byte order):
+ * - header (TableFileHeader),
+ * - directory (TableFileEntry for every table),
+ * - tables names,
+ * - tables data, every table aligned to kDataAlignment bytes.
+ *
+ * Table data is stored exactly as kept in memory: Table as an array of
+ * records (key, value and interpolation coefficients), Table2 as a single
+ * memory block (rows keys, columns keys and cells with slopes). Keys and
+ * values have to be stored as doubles, which also holds for units types.
+ */
+class MCUTILS_API TableFileWriter
+{
+public:
+
+    static constexpr size_t kDataAlignment = 64;    ///< table data alignment (bytes)
+
+    /**
+     * \brief Adds table.
+     * \param name table name
+     * \param table table
+     */
+    template <typename KEY_TYPE, typename VAL_TYPE, typename ALLOCATOR>
+    void addTable(const std::string& name, const Table<KEY_TYPE,VAL_TYPE,ALLOCATOR>& table)
+    {
+        using Record = typename Table<KEY_TYPE,VAL_TYPE,ALLOCATOR>::Record;
+
+        static_assert(std::is_trivially_copyable<Record>::value
+                   && sizeof(Record) == 5 * sizeof(double), "Unsupported table record type.");
+
+        Item item;
+        item.name = name;
+        item.entry.type          = static_cast<uint8_t>(TableFileType::Table);
+        item.entry.search        = static_cast<uint8_t>(table._search);
+        item.entry.interpolation = static_cast<uint8_t>(table._interpolation);
+        item.entry.rows = table._size;
+        item.entry.cols = 1;
+
+        const std::byte* data = reinterpret_cast<const std::byte*>(table._records);
+        item.data.assign(data, data + table._size * sizeof(Record));
+
+        _items.push_back(std::move(item));
+    }
+
+    /**
+     * \brief Adds table.
+     * \param name table name
+     * \param table table
+     */
+    template <typename ROW_TYPE, typename COL_TYPE, typename VAL_TYPE, typename ALLOCATOR>
+    void addTable(const std::string& name, const Table2<ROW_TYPE,COL_TYPE,VAL_TYPE,ALLOCATOR>& table)
+    {
+        using Cell = typename Table2<ROW_TYPE,COL_TYPE,VAL_TYPE,ALLOCATOR>::Cell;
+
+        static_assert(std::is_trivially_copyable<ROW_TYPE>::value && sizeof(ROW_TYPE) == sizeof(double)
+                   && std::is_trivially_copyable<COL_TYPE>::value && sizeof(COL_TYPE) == sizeof(double)
+                   && std::is_trivially_copyable<Cell>::value && sizeof(Cell) == 2 * sizeof(double),
+                      "Unsupported table types.");
+
+        Item item;
+        item.name = name;
+        item.entry.type = static_cast<uint8_t>(TableFileType::Table2);
+        item.entry.rows = table._rows;
+        item.entry.cols = table._cols;
+
+        const std::byte* data = reinterpret_cast<const std::byte*>(table._block);
+        item.data.assign(data, data + table.getLayout(table._rows, table._cols).bytes);
+
+        _items.push_back(std::move(item));
+    }
+
+    /**
+     * \brief Returns file content.
+     * \return file content
+     */
+    std::vector<std::byte> toBytes() const;
+
+    /**
+     * \brief Writes file.
+     * \param path file path
+     * \return Success on success, Failure on failure
+     */
+    Result writeFile(const char* path) const;
+
+    inline Result writeFile(const std::string& path) const
+    {
+        return writeFile(path.c_str());
+    }
+    inline Result writeFile(const std::filesystem::path& path) const
+    {
+        return writeFile(path.string());
+    }
+
+private:
+
+    /**
+     * \brief Table to be written.
+     */
+    struct Item
+    {
+        std::string name;               ///< table name
+        TableFileEntry entry;           ///< table directory entry (offsets not set)
+        std::vector<std::byte> data;    ///< table data
+    };
+
+    std::vector<Item> _items;           ///< tables to be written
+
+    static size_t alignOffset(size_t offset)
+    {
+        return (offset + kDataAlignment - 1) / kDataAlignment * kDataAlignment;
+    }
+};
+
+/**
+ * \brief Binary table file.
+ *
+ * File written with TableFileWriter is memory mapped and tables reference
+ * its data in place, without parsing or copying. Table data is copied only
+ * if the table is modified. Tables returned by this class must not outlive
+ * the file object.
+ */
+class MCUTILS_API TableFile
+{
+public:
+
+    /**
+     * \brief Creates closed table file.
+     */
+    TableFile() = default;
+
+    /**
+     * \brief Opens table file.
+     * \param path file path
+     */
+    explicit TableFile(const char* path);
+
+    /**
+     * \brief Opens table file.
+     * \param path file path
+     */
+    explicit TableFile(const std::string& path)
+        : TableFile(path.c_str())
+    {}
+
+    /**
+     * \brief Opens table file.
+     * \param path file path
+     */
+    explicit TableFile(const std::filesystem::path& path)
+        : TableFile(path.string())
+    {}
+
+    /**
+     * Checks if file is open.
+     * \return returns true if file is open and valid
+     */
+    inline bool isOpen() const { return _file.isOpen(); }
+
+    /**
+     * Opens table file. File is checked for consistency, but tables data is
+     * not read until used.
+     * \param path file path
+     * \return Success on success, Failure on failure
+     */
+    Result openFile(const char* path);
+
+    inline Result openFile(const std::string& path)
+    {
+        return openFile(path.c_str());
+    }
+    inline Result openFile(const std::filesystem::path& path)
+    {
+        return openFile(path.string());
+    }
+
+    /**
+     * Closes file. Tables referencing file data become invalid.
+     */
+    void closeFile();
+
+    /**
+     * \return number of tables
+     */
+    inline unsigned int count() const { return _file.isOpen() ? getHeader()->count : 0; }
+
+    /**
+     * \brief Finds table of the given name.
+     * \param name table name
+     * \return table index, or -1 if not found
+     */
+    int findTable(std::string_view name) const;
+
+    /**
+     * \brief Returns table name.
+     * \param index table index
+     * \return table name, empty if index is out of range
+     */
+    std::string_view getName(unsigned int index) const;
+
+    /**
+     * \brief Returns table type.
+     * \param index table index
+     * \return table type
+     */
+    TableFileType getType(unsigned int index) const;
+
+    /**
+     * \brief Returns table referencing file data.
+     * \param index table index
+     * \return table on success, single NaN record table on failure (index out
+     * of range or entry is not a Table)
+     */
+    template <typename KEY_TYPE, typename VAL_TYPE, typename ALLOCATOR = std::allocator<std::byte>>
+    Table<KEY_TYPE,VAL_TYPE,ALLOCATOR> getTable(unsigned int index) const
+    {
+        using Record = typename Table<KEY_TYPE,VAL_TYPE,ALLOCATOR>::Record;
+
+        static_assert(std::is_trivially_copyable<Record>::value
+                   && sizeof(Record) == 5 * sizeof(double), "Unsupported table record type.");
+
+        Table<KEY_TYPE,VAL_TYPE,ALLOCATOR> table(VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() },
+                                                 KEY_TYPE{ std::numeric_limits<double>::quiet_NaN() });
+
+        if (getType(index) == TableFileType::Table)
+        {
+            const TableFileEntry& entry = getEntries()[index];
+
+            if (entry.rows > 0 && entry.cols == 1 && entry.data_size == entry.rows * sizeof(Record))
+            {
+                table.setView(reinterpret_cast<const Record*>(_file.data() + entry.data_offset),
+                              entry.rows,
+                              static_cast<TableSearch>(entry.search),
+                              static_cast<TableInterpolation>(entry.interpolation));
+            }
+        }
+
+        return table;
+    }
+
+    /**
+     * \brief Returns table referencing file data.
+     * \param index table index
+     * \return table on success, single NaN cell table on failure (index out
+     * of range or entry is not a Table2)
+     */
+    template <typename ROW_TYPE, typename COL_TYPE, typename VAL_TYPE,
+              typename ALLOCATOR = std::allocator<std::byte>>
+    Table2<ROW_TYPE,COL_TYPE,VAL_TYPE,ALLOCATOR> getTable2(unsigned int index) const
+    {
+        using Table2Type = Table2<ROW_TYPE,COL_TYPE,VAL_TYPE,ALLOCATOR>;
+        using Cell = typename Table2Type::Cell;
+
+        static_assert(std::is_trivially_copyable<ROW_TYPE>::value && sizeof(ROW_TYPE) == sizeof(double)
+                   && std::is_trivially_copyable<COL_TYPE>::value && sizeof(COL_TYPE) == sizeof(double)
+                   && std::is_trivially_copyable<Cell>::value && sizeof(Cell) == 2 * sizeof(double),
+                      "Unsupported table types.");
+
+        Table2Type table(VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() },
+                         ROW_TYPE{ std::numeric_limits<double>::quiet_NaN() },
+                         COL_TYPE{ std::numeric_limits<double>::quiet_NaN() });
+
+        if (getType(index) == TableFileType::Table2)
+        {
+            const TableFileEntry& entry = getEntries()[index];
+
+            // number of cells is checked first, as it would overflow the table size type
+            if (entry.rows > 0 && entry.cols > 0
+             && Table2Type::isSizeValid(entry.rows, entry.cols)
+             && entry.data_size == Table2Type::getLayout(entry.rows, entry.cols).bytes)
+            {
+                table.setView(_file.data() + entry.data_offset, entry.rows, entry.cols);
+            }
+        }
+
+        return table;
+    }
+
+private:
+
+    MappedFile _file;       ///< mapped file
+
+    inline const TableFileHeader* getHeader() const
+    {
+        return reinterpret_cast<const TableFileHeader*>(_file.data());
+    }
+
+    inline const TableFileEntry* getEntries() const
+    {
+        return reinterpret_cast<const TableFileEntry*>(_file.data() + sizeof(TableFileHeader));
+    }
+
+    /**
+     * \brief Checks if mapped file header and directory are consistent.
+     * \return true if file is valid
+     */
+    bool isValid() const;
+};
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_TABLEFILE_H_
@@ -0,0 +1,442 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_TABLEN_H_
+#define MCUTILS_MATH_TABLEN_H_
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <units.h>
+
+#include <mcutils/math/Table.h>
+
+#include <mcutils/misc/Check.h>
+
+using namespace units::math;
+
+namespace mc {
+
+/**
+ * \brief N-dimensional table lookup cursor.
+ *
+ * Cursor keeps indices of the intervals found by the previous query,
+ * one per table axis. It is owned by the caller, so a single const table
+ * can be shared between threads, each using its own cursor.
+ *
+ * \tparam RANK number of table axes
+ * \sa TableCursor
+ */
+template <unsigned int RANK>
+struct TableNCursor
+{
+    std::array<TableCursor, RANK> axes;     ///< axes lookup cursors
+};
+
+/**
+ * \brief N-dimensional table and multilinear interpolation class template.
+ *
+ * Table data is stored in a single contiguous array. Data index should match
+ * following scheme (row-major, the last axis changes the fastest):
+ * i = ((i_0 * n_1 + i_1) * n_2 + i_2) * ... + i_N-1
+ * where:
+ * i_d - index on axis d,
+ * n_d - number of keys on axis d
+ *
+ * Lookups search every axis with binary search and interpolate between 2^N
+ * surrounding records, no heap allocation is done. Keys outside the table
+ * range are clamped.
+ *
+ * \tparam VAL_TYPE value type
+ * \tparam KEY_TYPES keys types, one per table axis
+ */
+template <typename VAL_TYPE, typename... KEY_TYPES>
+class TableN
+{
+public:
+
+    static constexpr unsigned int kRank = sizeof...(KEY_TYPES);   ///< number of table axes
+    static constexpr unsigned int kCorners = 1u << kRank;           ///< number of records used by the interpolation
+
+    static_assert(kRank > 0, "Table has to have at least one axis.");
+
+    using Cursor = TableNCursor<kRank>;
+
+    /**
+     * \brief Constructor.
+     * Creates table with only one record.
+     * \param val record value
+     */
+    explicit TableN(VAL_TYPE val = VAL_TYPE{0})
+    {
+        setData(std::vector<KEY_TYPES>{ KEY_TYPES{0} }..., std::vector<VAL_TYPE>{ val });
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * This constructor is used to initialize table with data.
+     *
+     * \param key_values keys values ordered vectors, one per table axis
+     * \param table_data table values ordered vector
+     */
+    TableN(const std::vector<KEY_TYPES>&... key_values, const std::vector<VAL_TYPE>& table_data)
+    {
+        setData(key_values..., table_data);
+    }
+
+    /**
+     * \brief Returns key for the given axis and index.
+     * \tparam AXIS axis index
+     * \param index key index
+     * \return key value on success or NaN on failure
+     */
+    template <unsigned int AXIS>
+    auto getKeyByIndex(unsigned int index) const
+    {
+        using KEY_TYPE = std::tuple_element_t<AXIS, std::tuple<KEY_TYPES...>>;
+
+        if (index < _sizes[AXIS])
+        {
+            return std::get<AXIS>(_key_values)[index];
+        }
+
+        return KEY_TYPE{ std::numeric_limits<double>::quiet_NaN() };
+    }
+
+    /**
+     * \brief Returns table value for the given keys.
+     *
+     * Returns table value for the given keys values using multilinear
+     * interpolation algorithm. This function doesn't modify table state,
+     * so it is safe to call it concurrently on a shared table.
+     *
+     * \param key_values keys values, one per table axis
+     * \return interpolated value on success or NaN on failure
+     */
+    VAL_TYPE getValue(KEY_TYPES... key_values) const
+    {
+        if (_table_data.size() > 0)
+        {
+            std::array<unsigned int, kRank> index;
+            std::array<double, kRank> factor;
+
+            findIntervals(std::index_sequence_for<KEY_TYPES...>{}, nullptr, &index, &factor, key_values...);
+
+            return calculateInterpolatedValue(index, factor);
+        }
+
+        return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
+    }
+
+    /**
+     * \brief Returns table value for the given keys.
+     *
+     * Returns table value for the given keys values using multilinear
+     * interpolation algorithm. Intervals stored in the given cursor are
+     * checked first and the search is done only if the keys are outside
+     * of them.
+     *
+     * \param key_values keys values, one per table axis
+     * \param cursor lookup cursor
+     * \return interpolated value on success or NaN on failure
+     */
+    VAL_TYPE getValue(KEY_TYPES... key_values, Cursor& cursor) const
+    {
+        if (_table_data.size() > 0)
+        {
+            std::array<unsigned int, kRank> index;
+            std::array<double, kRank> factor;
+
+            findIntervals(std::index_sequence_for<KEY_TYPES...>{}, &cursor, &index, &factor, key_values...);
+
+            return calculateInterpolatedValue(index, factor);
+        }
+
+        return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
+    }
+
+    /**
+     * \brief Returns table value for the given keys indices.
+     * \param indices keys indices, one per table axis
+     * \return value on success or NaN on failure
+     */
+    VAL_TYPE getValueByIndex(const std::array<unsigned int, kRank>& indices) const
+    {
+        unsigned int offset = 0;
+
+        for (unsigned int d = 0; d < kRank; ++d)
+        {
+            if (indices[d] >= _sizes[d])
+            {
+                return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
+            }
+
+            offset += indices[d] * _strides[d];
+        }
+
+        return _table_data[offset];
+    }
+
+    /**
+     * \brief Checks if table is valid.
+     * \return returns true if size is greater than 0, all data is valid and keys are ordered
+     */
+    bool isValid() const
+    {
+        bool result = _table_data.size() > 0;
+
+        if (result)
+        {
+            result = areKeysValid(std::index_sequence_for<KEY_TYPES...>{});
+
+            for (unsigned int i = 0; i < _table_data.size() && result; ++i)
+            {
+                result &= check::isValid(_table_data[i]);
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief Multiplies keys of the given axis by the given factor.
+     * \tparam AXIS axis index
+     * \param factor given factor
+     */
+    template <unsigned int AXIS>
+    void multiplyKeys(double factor)
+    {
+        for (auto& key : std::get<AXIS>(_key_values))
+        {
+            key *= factor;
+        }
+    }
+
+    /**
+     * \brief Multiplies values by the given factor.
+     * \param factor given factor
+     */
+    void multiplyValues(double factor)
+    {
+        for (auto& val : _table_data)
+        {
+            val *= factor;
+        }
+    }
+
+    /**
+     * \brief Sets table data.
+     *
+     * Table data size has to be equal to the product of keys vectors sizes,
+     * otherwise table is left empty.
+     *
+     * \param key_values keys values ordered vectors, one per table axis
+     * \param table_data table values ordered vector
+     */
+    void setData(const std::vector<KEY_TYPES>&... key_values, const std::vector<VAL_TYPE>& table_data)
+    {
+        const size_t size = (key_values.size() * ...);
+
+        if (size > 0 && size == table_data.size())
+        {
+            _key_values = std::make_tuple(key_values...);
+            _sizes = { static_cast<unsigned int>(key_values.size())... };
+            _table_data = table_data;
+
+            _strides[kRank - 1] = 1;
+            for (unsigned int d = kRank - 1; d > 0; --d)
+            {
+                _strides[d - 1] = _strides[d] * _sizes[d];
+            }
+        }
+        else
+        {
+            _key_values = std::tuple<std::vector<KEY_TYPES>...>();
+            _sizes.fill(0);
+            _strides.fill(0);
+            _table_data.clear();
+        }
+    }
+
+    /**
+     * \brief Returns number of keys on the given axis.
+     * \param axis axis index
+     * \return number of keys
+     */
+    inline unsigned int size(unsigned int axis) const { return axis < kRank ? _sizes[axis] : 0; }
+
+    /**
+     * \brief Returns number of table records.
+     * \return number of table records
+     */
+    inline unsigned int size() const { return static_cast<unsigned int>(_table_data.size()); }
+
+private:
+
+    std::tuple<std::vector<KEY_TYPES>...> _key_values;  ///< keys values, one vector per axis
+    std::array<unsigned int, kRank> _sizes   = {};      ///< number of keys on each axis
+    std::array<unsigned int, kRank> _strides = {};      ///< data index strides of each axis
+    std::vector<VAL_TYPE> _table_data;                  ///< table data
+
+    template <std::size_t... I>
+    void findIntervals(std::index_sequence<I...>, Cursor* cursor,
+                       std::array<unsigned int, kRank>* index,
+                       std::array<double, kRank>* factor,
+                       KEY_TYPES... key_values) const
+    {
+        (findInterval<I>(key_values,
+                         cursor ? &cursor->axes[I] : nullptr,
+                         &(*index)[I], &(*factor)[I]), ...);
+    }
+
+    /**
+     * \brief Finds interval containing the given key on the given axis.
+     * \tparam AXIS axis index
+     * \param key_value key value
+     * \param cursor axis lookup cursor, might be null
+     * \param index output index of the interval first key
+     * \param factor output relative position of the key within the interval
+     */
+    template <std::size_t AXIS, typename KEY_TYPE>
+    void findInterval(KEY_TYPE key_value, TableCursor* cursor, unsigned int* index, double* factor) const
+    {
+        const KEY_TYPE* keys = std::get<AXIS>(_key_values).data();
+        const unsigned int last = _sizes[AXIS] - 1;
+
+        *index  = 0;
+        *factor = 0.0;
+
+        if (last > 0)
+        {
+            if (key_value < keys[0])
+                key_value = keys[0];
+            else if (key_value > keys[last])
+                key_value = keys[last];
+
+            if (cursor && cursor->index < last
+              && key_value >= keys[cursor->index] && key_value < keys[cursor->index + 1])
+            {
+                *index = cursor->index;
+            }
+            else
+            {
+                // invariant: keys[lo] <= key_value < keys[hi]
+                unsigned int lo = 0;
+                unsigned int hi = last;
+
+                while (hi - lo > 1)
+                {
+                    unsigned int mid = (lo + hi) / 2;
+
+                    if (key_value < keys[mid])
+                        hi = mid;
+                    else
+                        lo = mid;
+                }
+
+                *index = lo;
+
+                if (cursor)
+                {
+                    cursor->index = lo;
+                }
+            }
+
+            *factor = static_cast<double>(key_value - keys[*index])
+                    / static_cast<double>(keys[*index + 1] - keys[*index]);
+        }
+    }
+
+    /**
+     * \brief Calculates multilinear interpolated value.
+     * \param index indices of the intervals first keys
+     * \param factor relative positions of the keys within the intervals
+     * \return interpolated value
+     */
+    VAL_TYPE calculateInterpolatedValue(const std::array<unsigned int, kRank>& index,
+                                        const std::array<double, kRank>& factor) const
+    {
+        // corner bit (kRank - 1 - d) selects upper key on the axis d
+        std::array<VAL_TYPE, kCorners> values;
+
+        for (unsigned int c = 0; c < kCorners; ++c)
+        {
+            unsigned int offset = 0;
+
+            for (unsigned int d = 0; d < kRank; ++d)
+            {
+                unsigned int upper = (c >> (kRank - 1 - d)) & 1u;
+                unsigned int i = (upper && _sizes[d] > 1) ? index[d] + 1 : index[d];
+                offset += i * _strides[d];
+            }
+
+            values[c] = _table_data[offset];
+        }
+
+        // reducing one axis at a time, starting from the last one
+        for (unsigned int d = kRank; d-- > 0;)
+        {
+            const unsigned int n = 1u << d;
+
+            for (unsigned int j = 0; j < n; ++j)
+            {
+                values[j] = factor[d] * (values[2*j + 1] - values[2*j]) + values[2*j];
+            }
+        }
+
+        return values[0];
+    }
+
+    template <std::size_t... I>
+    bool areKeysValid(std::index_sequence<I...>) const
+    {
+        return (areAxisKeysValid(std::get<I>(_key_values)) && ...);
+    }
+
+    template <typename KEY_TYPE>
+    static bool areAxisKeysValid(const std::vector<KEY_TYPE>& keys)
+    {
+        for (unsigned int i = 0; i < keys.size(); ++i)
+        {
+            if (!check::isValid(keys[i])) return false;
+            if (i > 0 && !(keys[i - 1] < keys[i])) return false;
+        }
+
+        return true;
+    }
+};
+
+/**
+ * \brief 3D table and trilinear interpolation class template.
+ * Table data index should match following scheme i = (i_row * n_col + i_col) * n_page + i_page
+ */
+template <typename ROW_TYPE, typename COL_TYPE, typename PAGE_TYPE, typename VAL_TYPE>
+using Table3 = TableN<VAL_TYPE, ROW_TYPE, COL_TYPE, PAGE_TYPE>;
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_TABLEN_H_
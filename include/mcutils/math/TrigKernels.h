@@ -0,0 +1,376 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_TRIGKERNELS_H_
+#define MCUTILS_MATH_TRIGKERNELS_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <span>
+
+#include <mcutils/math/Simd.h>
+
+namespace mc {
+namespace math {
+
+/**
+ * Largest argument magnitude handled by the sine and cosine kernels.
+ * Larger arguments are passed to the standard library functions, as the
+ * kernels range reduction loses accuracy above it.
+ */
+constexpr double kTrigKernelsMaxArg = 1.0e6;
+
+#if defined(MCUTILS_SIMD_DOUBLE2)
+
+namespace detail {
+
+/**
+ * \brief Sine and cosine of 2 arguments at once.
+ *
+ * Argument is reduced to r in [-pi/4, pi/4] by subtracting the nearest
+ * multiple j of pi/2 in 3 parts (Cody-Waite), then the fdlibm kernel
+ * polynomials are evaluated for r. The quadrant (j mod 4) swaps and negates
+ * results. It is derived from the fractional part of j/4 with floating point
+ * compares only, so there are no branches and no 64-bit integer operations,
+ * which SSE2 lacks.
+ *
+ * ### References:
+ * - Cody W., Waite W.: Software Manual for the Elementary Functions, 1980
+ * - [fdlibm k_sin.c, k_cos.c](https://www.netlib.org/fdlibm/)
+ */
+inline void sincos2(simd::Double2 x, simd::Double2* s, simd::Double2* c)
+{
+    using namespace simd;
+
+    // pi/2 split into 3 parts, first two have enough trailing zero bits
+    // for j * part to be exact
+    constexpr double kPio2_1 = 1.57079625129699707031e+00;
+    constexpr double kPio2_2 = 7.54978941586159635335e-08;
+    constexpr double kPio2_3 = 5.39030285815811905290e-15;
+
+    const Double2 j = round2(mul2(x, set2(M_2_PI)));
+
+    Double2 r = fma2(j, set2(-kPio2_1), x);
+    r = fma2(j, set2(-kPio2_2), r);
+    r = fma2(j, set2(-kPio2_3), r);
+
+    const Double2 z = mul2(r, r);
+
+    // sin(r) = r + r^3 * P(r^2), sign is copied from r to keep -0
+    Double2 ps = fma2(z, set2( 1.58969099521155010221e-10), set2(-2.50507602534068634195e-08));
+    ps = fma2(ps, z, set2( 2.75573137070700676789e-06));
+    ps = fma2(ps, z, set2(-1.98412698298579493134e-04));
+    ps = fma2(ps, z, set2( 8.33333333332248946124e-03));
+    ps = fma2(ps, z, set2(-1.66666666666666324348e-01));
+    const Double2 sr = or2(fma2(mul2(ps, z), r, r), signBit2(r));
+
+    // cos(r) = 1 - r^2/2 + r^4 * Q(r^2)
+    Double2 pc = fma2(z, set2(-1.13596475577881948265e-11), set2( 2.08757232129817482790e-09));
+    pc = fma2(pc, z, set2(-2.75573143513906633035e-07));
+    pc = fma2(pc, z, set2( 2.48015872894767294178e-05));
+    pc = fma2(pc, z, set2(-1.38888888888741095749e-03));
+    pc = fma2(pc, z, set2( 4.16666666666666019037e-02));
+    const Double2 cr = fma2(mul2(z, z), pc, sub2(set2(1.0), mul2(set2(0.5), z)));
+
+    // j/4 - round(j/4) is 0, 0.25, +/-0.5, -0.25 for quadrants 0, 1, 2, 3
+    const Double2 j4 = mul2(j, set2(0.25));
+    const Double2 f = sub2(j4, round2(j4));
+    const Double2 f_abs = abs2(f);
+    const Double2 q2 = cmpEq2(f_abs, set2(0.5));
+
+    const Double2 swap    = cmpEq2(f_abs, set2(0.25));
+    const Double2 sin_neg = or2(q2, cmpLt2(f, set2(0.0)));
+    const Double2 cos_neg = or2(q2, cmpEq2(f, set2(0.25)));
+
+    *s = xor2(select2(swap, cr, sr), and2(sin_neg, set2(-0.0)));
+    *c = xor2(select2(swap, sr, cr), and2(cos_neg, set2(-0.0)));
+}
+
+/**
+ * \brief Arc tangent of y/x of 2 arguments at once.
+ *
+ * The smaller of |x| and |y| is divided by the larger one, the ratio is
+ * reduced to [-tan(pi/8), tan(pi/8)] and the Cephes rational approximation
+ * is evaluated. The octant is restored with selects.
+ *
+ * ### References:
+ * - [Cephes Mathematical Library, atan.c](https://www.netlib.org/cephes/)
+ */
+inline simd::Double2 atan22(simd::Double2 y, simd::Double2 x)
+{
+    using namespace simd;
+
+    constexpr double kTanPio8  = 0.41421356237309504880;
+    constexpr double kMoreBits = 6.123233995736765886130e-17;   // pi/2 - double(pi/2)
+
+    const Double2 x_abs = abs2(x);
+    const Double2 y_abs = abs2(y);
+
+    const Double2 swap = cmpGt2(y_abs, x_abs);
+    const Double2 num = min2(x_abs, y_abs);
+    const Double2 den = max2(x_abs, y_abs);
+
+    // 0 <= t <= 1, both arguments being infinite gives t = 1, both being zero gives t = 0
+    Double2 t = div2(num, den);
+    t = select2(cmpEq2(num, den), set2(1.0), t);
+    t = select2(cmpEq2(den, set2(0.0)), set2(0.0), t);
+
+    const Double2 big = cmpGt2(t, set2(kTanPio8));
+    t = select2(big, div2(sub2(t, set2(1.0)), add2(t, set2(1.0))), t);
+
+    const Double2 z = mul2(t, t);
+
+    Double2 p = fma2(z, set2(-8.750608600031904122785e-01), set2(-1.615753718733365076637e+01));
+    p = fma2(p, z, set2(-7.500855792314704667340e+01));
+    p = fma2(p, z, set2(-1.228866684490136173410e+02));
+    p = fma2(p, z, set2(-6.485021904942025371773e+01));
+
+    Double2 q = add2(z, set2(2.485846490142306297962e+01));
+    q = fma2(q, z, set2(1.650270098316988542046e+02));
+    q = fma2(q, z, set2(4.328810604912902668951e+02));
+    q = fma2(q, z, set2(4.853903996359136964868e+02));
+    q = fma2(q, z, set2(1.945506571482613964425e+02));
+
+    Double2 a = fma2(mul2(t, z), div2(p, q), t);
+
+    // atan(t) = pi/4 + atan((t - 1)/(t + 1))
+    a = select2(big, add2(set2(M_PI_4), add2(a, set2(0.5 * kMoreBits))), a);
+
+    // atan(1/t) = pi/2 - atan(t)
+    a = select2(swap, add2(sub2(set2(M_PI_2), a), set2(kMoreBits)), a);
+
+    // x < 0 (including -0), sign bit is moved to 1.0 to be compared
+    const Double2 x_neg = cmpLt2(or2(signBit2(x), set2(1.0)), set2(0.0));
+    a = select2(x_neg, add2(sub2(set2(M_PI), a), set2(2.0 * kMoreBits)), a);
+
+    a = or2(a, signBit2(y));
+
+    return select2(cmpOrd2(x, y), a, add2(x, y));
+}
+
+inline bool hasLargeArgs(simd::Double2 x)
+{
+    return simd::any2(simd::cmpGt2(simd::abs2(x), simd::set2(kTrigKernelsMaxArg)));
+}
+
+} // namespace detail
+
+#endif // MCUTILS_SIMD_DOUBLE2
+
+/**
+ * \brief Sine and cosine of the same argument.
+ *
+ * Max error is 1.6 ULP for |x| <= kTrigKernelsMaxArg, larger arguments are
+ * passed to the standard library.
+ *
+ * \param x [rad] argument
+ * \param s output sine
+ * \param c output cosine
+ */
+inline void sincos(double x, double* s, double* c)
+{
+#   if defined(MCUTILS_SIMD_DOUBLE2)
+    if (std::fabs(x) <= kTrigKernelsMaxArg)
+    {
+        simd::Double2 s2;
+        simd::Double2 c2;
+        detail::sincos2(simd::set2(x), &s2, &c2);
+        *s = simd::getLo2(s2);
+        *c = simd::getLo2(c2);
+        return;
+    }
+#   endif
+
+    *s = std::sin(x);
+    *c = std::cos(x);
+}
+
+/**
+ * \brief Sines and cosines of many arguments.
+ *
+ * Two arguments are processed at once. Max error is 1.6 ULP for
+ * |x| <= kTrigKernelsMaxArg, pairs with larger arguments are passed to
+ * the standard library.
+ *
+ * \param x [rad] arguments
+ * \param s output sines, size should match arguments size
+ * \param c output cosines, size should match arguments size
+ */
+inline void sincos(std::span<const double> x, std::span<double> s, std::span<double> c)
+{
+    assert(x.size() == s.size() && x.size() == c.size());
+
+    const size_t count = std::min({ x.size(), s.size(), c.size() });
+    size_t i = 0;
+
+#   if defined(MCUTILS_SIMD_DOUBLE2)
+    for (; i + 2 <= count; i += 2)
+    {
+        const simd::Double2 x2 = simd::load2(&x[i]);
+        if (detail::hasLargeArgs(x2))
+        {
+            sincos(x[i    ], &s[i    ], &c[i    ]);
+            sincos(x[i + 1], &s[i + 1], &c[i + 1]);
+            continue;
+        }
+
+        simd::Double2 s2;
+        simd::Double2 c2;
+        detail::sincos2(x2, &s2, &c2);
+        simd::store2(&s[i], s2);
+        simd::store2(&c[i], c2);
+    }
+#   endif
+
+    for (; i < count; ++i)
+    {
+        sincos(x[i], &s[i], &c[i]);
+    }
+}
+
+/**
+ * \brief Sines of many arguments.
+ * \see sincos(std::span<const double>, std::span<double>, std::span<double>)
+ * \param x [rad] arguments
+ * \param s output sines, size should match arguments size
+ */
+inline void sin(std::span<const double> x, std::span<double> s)
+{
+    assert(x.size() == s.size());
+
+    const size_t count = std::min(x.size(), s.size());
+    size_t i = 0;
+
+#   if defined(MCUTILS_SIMD_DOUBLE2)
+    for (; i + 2 <= count; i += 2)
+    {
+        const simd::Double2 x2 = simd::load2(&x[i]);
+        if (detail::hasLargeArgs(x2))
+        {
+            s[i    ] = std::sin(x[i    ]);
+            s[i + 1] = std::sin(x[i + 1]);
+            continue;
+        }
+
+        simd::Double2 s2;
+        simd::Double2 c2;
+        detail::sincos2(x2, &s2, &c2);
+        simd::store2(&s[i], s2);
+    }
+#   endif
+
+    for (; i < count; ++i)
+    {
+        double c = 0.0;
+        sincos(x[i], &s[i], &c);
+    }
+}
+
+/**
+ * \brief Cosines of many arguments.
+ * \see sincos(std::span<const double>, std::span<double>, std::span<double>)
+ * \param x [rad] arguments
+ * \param c output cosines, size should match arguments size
+ */
+inline void cos(std::span<const double> x, std::span<double> c)
+{
+    assert(x.size() == c.size());
+
+    const size_t count = std::min(x.size(), c.size());
+    size_t i = 0;
+
+#   if defined(MCUTILS_SIMD_DOUBLE2)
+    for (; i + 2 <= count; i += 2)
+    {
+        const simd::Double2 x2 = simd::load2(&x[i]);
+        if (detail::hasLargeArgs(x2))
+        {
+            c[i    ] = std::cos(x[i    ]);
+            c[i + 1] = std::cos(x[i + 1]);
+            continue;
+        }
+
+        simd::Double2 s2;
+        simd::Double2 c2;
+        detail::sincos2(x2, &s2, &c2);
+        simd::store2(&c[i], c2);
+    }
+#   endif
+
+    for (; i < count; ++i)
+    {
+        double s = 0.0;
+        sincos(x[i], &s, &c[i]);
+    }
+}
+
+/**
+ * \brief Arc tangent of y/x using signs of arguments to determine the quadrant.
+ *
+ * Max error is 2.6 ULP. Results for signed zeros, infinities and NaNs
+ * match std::atan2.
+ *
+ * \param y first argument
+ * \param x second argument
+ * \return [rad] arc tangent of y/x in [-pi, pi]
+ */
+inline double atan2(double y, double x)
+{
+#   if defined(MCUTILS_SIMD_DOUBLE2)
+    return simd::getLo2(detail::atan22(simd::set2(y), simd::set2(x)));
+#   else
+    return std::atan2(y, x);
+#   endif
+}
+
+/**
+ * \brief Arc tangents of many y/x pairs.
+ * \see atan2(double, double)
+ * \param y first arguments
+ * \param x second arguments, size should match first arguments size
+ * \param result [rad] output arc tangents, size should match arguments size
+ */
+inline void atan2(std::span<const double> y, std::span<const double> x, std::span<double> result)
+{
+    assert(y.size() == x.size() && y.size() == result.size());
+
+    const size_t count = std::min({ y.size(), x.size(), result.size() });
+    size_t i = 0;
+
+#   if defined(MCUTILS_SIMD_DOUBLE2)
+    for (; i + 2 <= count; i += 2)
+    {
+        simd::store2(&result[i], detail::atan22(simd::load2(&y[i]), simd::load2(&x[i])));
+    }
+#   endif
+
+    for (; i < count; ++i)
+    {
+        result[i] = atan2(y[i], x[i]);
+    }
+}
+
+} // namespace math
+} // namespace mc
+
+#endif // MCUTILS_MATH_TRIGKERNELS_H_
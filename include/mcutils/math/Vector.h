@@ -22,6 +22,8 @@
 #ifndef MCUTILS_MATH_VECTOR_H_
 #define MCUTILS_MATH_VECTOR_H_
 
+#include <type_traits>
+
 #include <mcutils/mcutils_api.h>
 
 #include <mcutils/units.h>
@@ -40,6 +42,12 @@ using Vector3d = Vector3<double>;
 extern template class MCUTILS_API VectorN<double, 3>;
 extern template class MCUTILS_API Vector3<double>;
 
+// vectors are plain arrays of elements, without vtable or padding, so arrays
+// of them can be copied with memcpy and passed to vectorized code
+static_assert(sizeof(Vector3d) == 3 * sizeof(double));
+static_assert(std::is_standard_layout_v<Vector3d>);
+static_assert(std::is_trivially_copyable_v<Vector3d>);
+
 using Vector4f = VectorN<float, 4>;
 extern template class MCUTILS_API VectorN<float, 4>;
 
@@ -91,6 +91,19 @@ public:
         this->_elements[2] = z;
     }
 
+    /**
+     * \brief Constructor.
+     * Evaluates lazy expression in a single loop.
+     * \tparam EXPR expression type
+     * \param expr lazy expression, see LazyExprBase
+     */
+    template <typename EXPR>
+    requires (LazyExprType<EXPR> && EXPR::kSize == 3)
+    Vector3(const EXPR& expr)
+    {
+        evaluateLazyExpr(expr, this);
+    }
+
     /** \return length of projection of vector on XY-plane */
     inline TYPE getLengthXY() const { return sqrt(x()*x() + y()*y()); }
 
@@ -0,0 +1,650 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_VECTOR3BATCH_H_
+#define MCUTILS_MATH_VECTOR3BATCH_H_
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <mcutils/units.h>
+#include <mcutils/math/Matrix.h>
+#include <mcutils/math/Vector.h>
+
+namespace mc {
+
+/**
+ * \brief A template class representing a batch of 3D vectors.
+ *
+ * Vectors are stored as structure of arrays: x, y and z elements of all the
+ * vectors are kept in three separate contiguous streams. Operations on the
+ * whole batch are plain loops over these streams, which compilers turn into
+ * SIMD code, unlike loops over arrays of Vector3 objects.
+ *
+ * Result element types of the batch operators are the same as of the
+ * corresponding Vector3 operators, including unit types.
+ *
+ * \tparam TYPE vector item type
+ */
+template <typename TYPE>
+class Vector3Batch
+{
+public:
+
+    // LCOV_EXCL_START
+    Vector3Batch() = default;
+    Vector3Batch(const Vector3Batch&) = default;
+    Vector3Batch(Vector3Batch&&) = default;
+    ~Vector3Batch() = default;
+    Vector3Batch& operator=(const Vector3Batch&) = default;
+    Vector3Batch& operator=(Vector3Batch&&) = default;
+    // LCOV_EXCL_STOP
+
+    /**
+     * \brief Constructor.
+     * \param size number of vectors, all set to zero
+     */
+    explicit Vector3Batch(size_t size)
+        : _x(size, TYPE{0})
+        , _y(size, TYPE{0})
+        , _z(size, TYPE{0})
+    {}
+
+    /**
+     * \brief Constructor.
+     * \param vectors vectors to be copied into the batch
+     */
+    explicit Vector3Batch(const std::vector<Vector3<TYPE>>& vectors)
+    {
+        setFromStdVector(vectors);
+    }
+
+    /** \return number of vectors */
+    inline size_t size() const { return _x.size(); }
+
+    /** \return true if the batch is empty */
+    inline bool empty() const { return _x.empty(); }
+
+    /**
+     * \brief Resizes the batch, new vectors are set to zero.
+     * \param size new number of vectors
+     */
+    void resize(size_t size)
+    {
+        _x.resize(size, TYPE{0});
+        _y.resize(size, TYPE{0});
+        _z.resize(size, TYPE{0});
+    }
+
+    /** \brief Removes all vectors. */
+    void clear()
+    {
+        _x.clear();
+        _y.clear();
+        _z.clear();
+    }
+
+    /**
+     * \brief Appends vector at the end of the batch.
+     * \param vect vector to be appended
+     */
+    void pushBack(const Vector3<TYPE>& vect)
+    {
+        _x.push_back(vect.x());
+        _y.push_back(vect.y());
+        _z.push_back(vect.z());
+    }
+
+    /**
+     * \brief Gets vector.
+     *
+     * Please notice that this function is NOT bound-checked.
+     *
+     * \param index vector index
+     * \return vector at given index
+     */
+    inline Vector3<TYPE> get(size_t index) const
+    {
+        return Vector3<TYPE>(_x[index], _y[index], _z[index]);
+    }
+
+    /**
+     * \brief Sets vector.
+     *
+     * Please notice that this function is NOT bound-checked.
+     *
+     * \param index vector index
+     * \param vect vector value
+     */
+    inline void set(size_t index, const Vector3<TYPE>& vect)
+    {
+        _x[index] = vect.x();
+        _y[index] = vect.y();
+        _z[index] = vect.z();
+    }
+
+    /** \brief Gets a std::vector of vectors. */
+    std::vector<Vector3<TYPE>> getStdVector() const
+    {
+        std::vector<Vector3<TYPE>> vectors(size());
+        for (size_t i = 0; i < vectors.size(); ++i)
+        {
+            vectors[i] = get(i);
+        }
+        return vectors;
+    }
+
+    /**
+     * \brief Sets batch from a std::vector of vectors.
+     * \param vectors input std::vector of vectors
+     */
+    void setFromStdVector(const std::vector<Vector3<TYPE>>& vectors)
+    {
+        resize(vectors.size());
+        for (size_t i = 0; i < vectors.size(); ++i)
+        {
+            set(i, vectors[i]);
+        }
+    }
+
+    inline const TYPE* x() const { return _x.data(); }
+    inline const TYPE* y() const { return _y.data(); }
+    inline const TYPE* z() const { return _z.data(); }
+    inline TYPE* x() { return _x.data(); }
+    inline TYPE* y() { return _y.data(); }
+    inline TYPE* z() { return _z.data(); }
+
+    /**
+     * \brief Casting operator.
+     * Converts the batch to another type.
+     */
+    template <typename NEW_TYPE>
+    requires (
+        std::is_same<TYPE, NEW_TYPE>::value == false &&
+        (std::is_arithmetic<NEW_TYPE>::value || units::traits::is_convertible_unit_t<NEW_TYPE, TYPE>::value)
+    )
+    operator Vector3Batch<NEW_TYPE>() const
+    {
+        Vector3Batch<NEW_TYPE> result(size());
+        for (size_t i = 0; i < size(); ++i)
+        {
+            result.x()[i] = static_cast<NEW_TYPE>(_x[i]);
+            result.y()[i] = static_cast<NEW_TYPE>(_y[i]);
+            result.z()[i] = static_cast<NEW_TYPE>(_z[i]);
+        }
+        return result;
+    }
+
+    /** \brief Returns batch of normalized vectors. */
+    Vector3Batch<double> getNormalized() const
+    {
+        Vector3Batch<double> result;
+        calculateNormalized(*this, &result);
+        return result;
+    }
+
+    /**
+     * \brief Addition operator.
+     * \tparam RHS_TYPE type of the right-hand side batch elements
+     * \param batch batch to be added
+     * \return batch of sums of the vectors
+     */
+    template <typename RHS_TYPE>
+    requires requires (Vector3<TYPE> lhs, Vector3<RHS_TYPE> rhs) { lhs + rhs; }
+    auto operator+(const Vector3Batch<RHS_TYPE>& batch) const
+    {
+        Vector3Batch<ElementType<decltype(Vector3<TYPE>() + Vector3<RHS_TYPE>())>> result;
+        addBatches(*this, batch, &result);
+        return result;
+    }
+
+    /** \brief Negation operator. */
+    Vector3Batch<TYPE> operator-() const
+    {
+        Vector3Batch<TYPE> result(*this);
+        result.negate();
+        return result;
+    }
+
+    /**
+     * \brief Subtraction operator.
+     * \tparam RHS_TYPE type of the right-hand side batch elements
+     * \param batch batch to be subtracted
+     * \return batch of differences of the vectors
+     */
+    template <typename RHS_TYPE>
+    requires requires (Vector3<TYPE> lhs, Vector3<RHS_TYPE> rhs) { lhs - rhs; }
+    auto operator-(const Vector3Batch<RHS_TYPE>& batch) const
+    {
+        Vector3Batch<ElementType<decltype(Vector3<TYPE>() - Vector3<RHS_TYPE>())>> result;
+        subtractBatches(*this, batch, &result);
+        return result;
+    }
+
+    /**
+     * \brief Multiplication by a scalar operator.
+     * \tparam RHS_TYPE right-hand side operand type
+     * \param val value to be multiplied by
+     * \return batch of the vectors multiplied by the value
+     */
+    template <typename RHS_TYPE>
+    requires (
+        (std::is_arithmetic<RHS_TYPE>::value || units::traits::is_unit_t<RHS_TYPE>::value) &&
+        requires (Vector3<TYPE> vect, RHS_TYPE val) { vect * val; }
+    )
+    auto operator*(const RHS_TYPE& val) const
+    {
+        Vector3Batch<ElementType<decltype(Vector3<TYPE>() * val)>> result;
+        multiplyBatchByScalar(*this, val, &result);
+        return result;
+    }
+
+    /**
+     * \brief Dot products operator.
+     * \tparam RHS_TYPE type of the right-hand side batch elements
+     * \param batch right-hand side batch
+     * \return std::vector of dot products of the vectors
+     */
+    template <typename RHS_TYPE>
+    requires requires (Vector3<TYPE> lhs, Vector3<RHS_TYPE> rhs) { lhs * rhs; }
+    auto operator*(const Vector3Batch<RHS_TYPE>& batch) const
+    {
+        std::vector<decltype(Vector3<TYPE>() * Vector3<RHS_TYPE>())> result(size());
+        calculateDotProducts(*this, batch, result.data());
+        return result;
+    }
+
+    /**
+     * \brief Division by a scalar operator.
+     * \tparam RHS_TYPE type of the right-hand side value
+     * \param val value to be divided by
+     * \return batch of the vectors divided by the value
+     */
+    template <typename RHS_TYPE>
+    requires (
+        (std::is_arithmetic<RHS_TYPE>::value || units::traits::is_unit_t<RHS_TYPE>::value) &&
+        requires (Vector3<TYPE> vect, RHS_TYPE val) { vect / val; }
+    )
+    auto operator/(const RHS_TYPE& val) const
+    {
+        Vector3Batch<ElementType<decltype(Vector3<TYPE>() / val)>> result;
+        multiplyBatchByScalar(*this, 1.0 / val, &result);
+        return result;
+    }
+
+    /**
+     * \brief Cross products operator.
+     * \tparam RHS_TYPE type of the right-hand side batch elements
+     * \param batch right-hand side batch
+     * \return batch of cross products of the vectors
+     */
+    template <typename RHS_TYPE>
+    requires requires (Vector3<TYPE> lhs, Vector3<RHS_TYPE> rhs) { lhs % rhs; }
+    auto operator%(const Vector3Batch<RHS_TYPE>& batch) const
+    {
+        Vector3Batch<ElementType<decltype(Vector3<TYPE>() % Vector3<RHS_TYPE>())>> result;
+        calculateCrossProducts(*this, batch, &result);
+        return result;
+    }
+
+    /**
+     * \brief Unary addition operator.
+     * \tparam RHS_TYPE type of the right-hand side batch elements
+     * \param batch batch to be added
+     * \return reference to the updated batch
+     */
+    template <typename RHS_TYPE>
+    requires (
+        (std::is_arithmetic<TYPE>::value && std::is_arithmetic<RHS_TYPE>::value) ||
+        units::traits::is_convertible_unit_t<TYPE, RHS_TYPE>::value
+    )
+    Vector3Batch<TYPE>& operator+=(const Vector3Batch<RHS_TYPE>& batch)
+    {
+        addBatches(*this, batch, this);
+        return *this;
+    }
+
+    /**
+     * \brief Unary subtraction operator.
+     * \tparam RHS_TYPE type of the right-hand side batch elements
+     * \param batch batch to be subtracted
+     * \return reference to the updated batch
+     */
+    template <typename RHS_TYPE>
+    requires (
+        (std::is_arithmetic<TYPE>::value && std::is_arithmetic<RHS_TYPE>::value) ||
+        units::traits::is_convertible_unit_t<TYPE, RHS_TYPE>::value
+    )
+    Vector3Batch<TYPE>& operator-=(const Vector3Batch<RHS_TYPE>& batch)
+    {
+        subtractBatches(*this, batch, this);
+        return *this;
+    }
+
+    /**
+     * \brief Unary multiplication operator.
+     * \tparam RHS_TYPE type of the right-hand side value
+     * \param val value to be multiplied by
+     * \return reference to the updated batch
+     */
+    template <typename RHS_TYPE>
+    requires std::is_arithmetic<RHS_TYPE>::value
+    Vector3Batch<TYPE>& operator*=(RHS_TYPE val)
+    {
+        multiplyBatchByScalar(*this, val, this);
+        return *this;
+    }
+
+    /**
+     * \brief Unary division operator.
+     * \tparam RHS_TYPE type of the right-hand side value
+     * \param val value to be divided by
+     * \return reference to the updated batch
+     */
+    template <typename RHS_TYPE>
+    requires std::is_arithmetic<RHS_TYPE>::value
+    Vector3Batch<TYPE>& operator/=(RHS_TYPE val)
+    {
+        multiplyBatchByScalar(*this, 1.0 / val, this);
+        return *this;
+    }
+
+    /** \brief Negates all vectors. */
+    void negate()
+    {
+        for (size_t i = 0; i < size(); ++i)
+        {
+            _x[i] = -_x[i];
+            _y[i] = -_y[i];
+            _z[i] = -_z[i];
+        }
+    }
+
+private:
+
+    template <typename VECTOR>
+    using ElementType = std::remove_cvref_t<decltype(std::declval<VECTOR>().x())>;
+
+    std::vector<TYPE> _x;   ///< x elements of the vectors
+    std::vector<TYPE> _y;   ///< y elements of the vectors
+    std::vector<TYPE> _z;   ///< z elements of the vectors
+};
+
+/**
+ * \brief Adds two batches of vectors.
+ * \tparam LHS_TYPE type of the left-hand side batch elements
+ * \tparam RHS_TYPE type of the right-hand side batch elements
+ * \tparam RESULT_TYPE type of the result batch elements
+ * \param lhs left-hand side batch
+ * \param rhs right-hand side batch
+ * \param result output result batch, may be one of the operands
+ */
+template <typename LHS_TYPE, typename RHS_TYPE, typename RESULT_TYPE>
+void addBatches(
+    const Vector3Batch<LHS_TYPE>& lhs,
+    const Vector3Batch<RHS_TYPE>& rhs,
+    Vector3Batch<RESULT_TYPE>* result
+)
+{
+    assert(lhs.size() == rhs.size());
+    result->resize(lhs.size());
+
+    const size_t size = lhs.size();
+    for (size_t i = 0; i < size; ++i)
+    {
+        result->x()[i] = lhs.x()[i] + rhs.x()[i];
+        result->y()[i] = lhs.y()[i] + rhs.y()[i];
+        result->z()[i] = lhs.z()[i] + rhs.z()[i];
+    }
+}
+
+/**
+ * \brief Subtracts two batches of vectors.
+ * \tparam LHS_TYPE type of the left-hand side batch elements
+ * \tparam RHS_TYPE type of the right-hand side batch elements
+ * \tparam RESULT_TYPE type of the result batch elements
+ * \param lhs left-hand side batch
+ * \param rhs right-hand side batch
+ * \param result output result batch, may be one of the operands
+ */
+template <typename LHS_TYPE, typename RHS_TYPE, typename RESULT_TYPE>
+void subtractBatches(
+    const Vector3Batch<LHS_TYPE>& lhs,
+    const Vector3Batch<RHS_TYPE>& rhs,
+    Vector3Batch<RESULT_TYPE>* result
+)
+{
+    assert(lhs.size() == rhs.size());
+    result->resize(lhs.size());
+
+    const size_t size = lhs.size();
+    for (size_t i = 0; i < size; ++i)
+    {
+        result->x()[i] = lhs.x()[i] - rhs.x()[i];
+        result->y()[i] = lhs.y()[i] - rhs.y()[i];
+        result->z()[i] = lhs.z()[i] - rhs.z()[i];
+    }
+}
+
+/**
+ * \brief Multiplies batch of vectors by a value.
+ * \tparam LHS_TYPE type of the left-hand side batch elements
+ * \tparam RHS_TYPE type of the right-hand side value
+ * \tparam RESULT_TYPE type of the result batch elements
+ * \param batch batch of vectors
+ * \param val value to multiply the vectors by
+ * \param result output result batch, may be the input batch
+ */
+template <typename LHS_TYPE, typename RHS_TYPE, typename RESULT_TYPE>
+void multiplyBatchByScalar(
+    const Vector3Batch<LHS_TYPE>& batch,
+    const RHS_TYPE& val,
+    Vector3Batch<RESULT_TYPE>* result
+)
+{
+    result->resize(batch.size());
+
+    const size_t size = batch.size();
+    for (size_t i = 0; i < size; ++i)
+    {
+        result->x()[i] = batch.x()[i] * val;
+        result->y()[i] = batch.y()[i] * val;
+        result->z()[i] = batch.z()[i] * val;
+    }
+}
+
+/**
+ * \brief Dot products calculation algorithm.
+ * \tparam LHS_TYPE type of the left-hand side batch elements
+ * \tparam RHS_TYPE type of the right-hand side batch elements
+ * \tparam RESULT_TYPE type of the dot products
+ * \param lhs left-hand side batch
+ * \param rhs right-hand side batch
+ * \param result output array of lhs.size() dot products
+ */
+template <typename LHS_TYPE, typename RHS_TYPE, typename RESULT_TYPE>
+void calculateDotProducts(
+    const Vector3Batch<LHS_TYPE>& lhs,
+    const Vector3Batch<RHS_TYPE>& rhs,
+    RESULT_TYPE* result
+)
+{
+    assert(lhs.size() == rhs.size());
+
+    const size_t size = lhs.size();
+    for (size_t i = 0; i < size; ++i)
+    {
+        result[i] = lhs.x()[i] * rhs.x()[i]
+                  + lhs.y()[i] * rhs.y()[i]
+                  + lhs.z()[i] * rhs.z()[i];
+    }
+}
+
+/**
+ * \brief Cross products calculation algorithm.
+ * \tparam LHS_TYPE type of the left-hand side batch elements
+ * \tparam RHS_TYPE type of the right-hand side batch elements
+ * \tparam RESULT_TYPE type of the result batch elements
+ * \param lhs left-hand side batch
+ * \param rhs right-hand side batch
+ * \param result output result batch, may be one of the operands
+ */
+template <typename LHS_TYPE, typename RHS_TYPE, typename RESULT_TYPE>
+void calculateCrossProducts(
+    const Vector3Batch<LHS_TYPE>& lhs,
+    const Vector3Batch<RHS_TYPE>& rhs,
+    Vector3Batch<RESULT_TYPE>* result
+)
+{
+    assert(lhs.size() == rhs.size());
+    result->resize(lhs.size());
+
+    const size_t size = lhs.size();
+    for (size_t i = 0; i < size; ++i)
+    {
+        const LHS_TYPE lx = lhs.x()[i];
+        const LHS_TYPE ly = lhs.y()[i];
+        const LHS_TYPE lz = lhs.z()[i];
+        const RHS_TYPE rx = rhs.x()[i];
+        const RHS_TYPE ry = rhs.y()[i];
+        const RHS_TYPE rz = rhs.z()[i];
+
+        result->x()[i] = ly * rz - lz * ry;
+        result->y()[i] = lz * rx - lx * rz;
+        result->z()[i] = lx * ry - ly * rx;
+    }
+}
+
+/**
+ * \brief Normalized vectors calculation algorithm.
+ *
+ * Zero length vectors are normalized to zero vectors.
+ *
+ * \tparam TYPE type of the batch elements
+ * \param batch input batch
+ * \param result output batch
+ */
+template <typename TYPE>
+void calculateNormalized(const Vector3Batch<TYPE>& batch, Vector3Batch<double>* result)
+{
+    result->resize(batch.size());
+
+    const size_t size = batch.size();
+    for (size_t i = 0; i < size; ++i)
+    {
+        const double x = static_cast<double>(batch.x()[i]);
+        const double y = static_cast<double>(batch.y()[i]);
+        const double z = static_cast<double>(batch.z()[i]);
+
+        const double length = std::sqrt(x*x + y*y + z*z);
+        const double length_inv = length > 0.0 ? 1.0 / length : 0.0;
+
+        result->x()[i] = x * length_inv;
+        result->y()[i] = y * length_inv;
+        result->z()[i] = z * length_inv;
+    }
+}
+
+/**
+ * \brief Multiplication a 3x3 matrix by a batch of vectors algorithm.
+ *
+ * Unit combinations which require angle dimension stripping are not supported.
+ *
+ * \tparam MAT_TYPE type of the matrix elements
+ * \tparam VEC_TYPE type of the batch elements
+ * \tparam RESULT_TYPE type of the result batch elements
+ * \param mat matrix
+ * \param batch batch of vectors
+ * \param result output result batch, may be the input batch
+ */
+template <typename MAT_TYPE, typename VEC_TYPE, typename RESULT_TYPE>
+requires (units::traits::need_angle_stripping_t<MAT_TYPE, VEC_TYPE>::value == false)
+void multiplyMatrixByBatch(
+    const Matrix3x3<MAT_TYPE>& mat,
+    const Vector3Batch<VEC_TYPE>& batch,
+    Vector3Batch<RESULT_TYPE>* result
+)
+{
+    result->resize(batch.size());
+
+    const MAT_TYPE m00 = mat(0,0), m01 = mat(0,1), m02 = mat(0,2);
+    const MAT_TYPE m10 = mat(1,0), m11 = mat(1,1), m12 = mat(1,2);
+    const MAT_TYPE m20 = mat(2,0), m21 = mat(2,1), m22 = mat(2,2);
+
+    const size_t size = batch.size();
+    for (size_t i = 0; i < size; ++i)
+    {
+        const VEC_TYPE x = batch.x()[i];
+        const VEC_TYPE y = batch.y()[i];
+        const VEC_TYPE z = batch.z()[i];
+
+        result->x()[i] = m00 * x + m01 * y + m02 * z;
+        result->y()[i] = m10 * x + m11 * y + m12 * z;
+        result->z()[i] = m20 * x + m21 * y + m22 * z;
+    }
+}
+
+/**
+ * \brief Multiplication a 3x3 matrix by a batch of vectors operator.
+ * \tparam MAT_TYPE type of the matrix elements
+ * \tparam VEC_TYPE type of the batch elements
+ * \param mat matrix
+ * \param batch batch of vectors
+ * \return batch of products of the matrix and the vectors
+ */
+template <typename MAT_TYPE, typename VEC_TYPE>
+requires (units::traits::need_angle_stripping_t<MAT_TYPE, VEC_TYPE>::value == false)
+auto operator*(const Matrix3x3<MAT_TYPE>& mat, const Vector3Batch<VEC_TYPE>& batch)
+{
+    using ResultVector = decltype(Matrix3x3<MAT_TYPE>() * Vector3<VEC_TYPE>());
+    Vector3Batch<std::remove_cvref_t<decltype(std::declval<ResultVector>().x())>> result;
+    multiplyMatrixByBatch(mat, batch, &result);
+    return result;
+}
+
+/**
+ * \brief Multiplication operator.
+ *
+ * This is an operator for multiplying a scalar by a batch, which is commutative.
+ *
+ * \tparam LHS_TYPE type of the left-hand side scalar
+ * \tparam RHS_TYPE type of the right-hand side batch elements
+ * \param val scalar value
+ * \param batch batch to be multiplied
+ * \return batch of the vectors multiplied by the value
+ */
+template <typename LHS_TYPE, typename RHS_TYPE>
+requires (
+    std::is_arithmetic<LHS_TYPE>::value ||
+    units::traits::is_unit_t<LHS_TYPE>::value
+)
+auto operator*(LHS_TYPE val, const Vector3Batch<RHS_TYPE>& batch)
+{
+    return batch * val;
+}
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_VECTOR3BATCH_H_
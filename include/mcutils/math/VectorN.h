@@ -36,6 +36,7 @@
 #include <vector>
 
 #include <mcutils/units.h>
+#include <mcutils/math/LazyExpr.h>
 #include <mcutils/misc/Check.h>
 #include <mcutils/misc/StringUtils.h>
 
@@ -65,11 +66,24 @@ public:
     VectorN() = default;
     VectorN(const VectorN<TYPE,SIZE>&) = default;
     VectorN(VectorN<TYPE,SIZE>&&) = default;
-    virtual ~VectorN() = default;
+    ~VectorN() = default;
     VectorN<TYPE,SIZE>& operator=(const VectorN<TYPE,SIZE>&) = default;
     VectorN<TYPE,SIZE>& operator=(VectorN<TYPE,SIZE>&&) = default;
     // LCOV_EXCL_STOP
 
+    /**
+     * \brief Constructor.
+     * Evaluates lazy expression in a single loop.
+     * \tparam EXPR expression type
+     * \param expr lazy expression, see LazyExprBase
+     */
+    template <typename EXPR>
+    requires (LazyExprType<EXPR> && EXPR::kSize == SIZE)
+    VectorN(const EXPR& expr)
+    {
+        evaluateLazyExpr(expr, this);
+    }
+
     /**
      * \brief Checks if all elements in the vector are valid.
      *
@@ -307,6 +321,12 @@ public:
         return _elements[index];
     }
 
+    /** \return pointer to the vector elements */
+    inline const TYPE* data() const { return _elements; }
+
+    /** \return pointer to the vector elements */
+    inline TYPE* data() { return _elements; }
+
     /**
      * \brief Addition operator.
      * \param vect vector to be added
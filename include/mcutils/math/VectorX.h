@@ -0,0 +1,502 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_VECTORX_H_
+#define MCUTILS_MATH_VECTORX_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <mcutils/math/DynamicStorage.h>
+#include <mcutils/math/Vector.h>
+#include <mcutils/misc/Check.h>
+
+namespace mc {
+
+/**
+ * \brief A template class representing a column vector with size known
+ * at run-time.
+ *
+ * It is meant for problems which dimensions are known only after loading
+ * a model. Vectors of up to kInlineSize elements do not allocate. Vectors
+ * can be constructed from VectorN and converted back with getVectorN().
+ *
+ * Please notice that sizes of the operands are checked with assertions only.
+ *
+ * \tparam TYPE vector elements type
+ */
+template <typename TYPE>
+requires std::is_arithmetic<TYPE>::value
+class VectorX
+{
+public:
+
+    static constexpr unsigned int kInlineSize = 16; ///< number of elements stored without allocation
+
+    // LCOV_EXCL_START
+    VectorX() = default;
+    VectorX(const VectorX<TYPE>&) = default;
+    VectorX(VectorX<TYPE>&&) = default;
+    ~VectorX() = default;
+    VectorX<TYPE>& operator=(const VectorX<TYPE>&) = default;
+    VectorX<TYPE>& operator=(VectorX<TYPE>&&) = default;
+    // LCOV_EXCL_STOP
+
+    /**
+     * \brief Constructor.
+     * \param size vector size, elements are set to zero
+     */
+    explicit VectorX(unsigned int size)
+        : _elements(size)
+    {
+        zeroize();
+    }
+
+    /**
+     * \brief Constructor.
+     * \param elements std::vector of vector elements
+     */
+    explicit VectorX(const std::vector<TYPE>& elements)
+    {
+        setFromStdVector(elements);
+    }
+
+    /**
+     * \brief Converting constructor.
+     * \tparam SIZE fixed vector size
+     * \param vect fixed size vector
+     */
+    template <unsigned int SIZE>
+    VectorX(const VectorN<TYPE, SIZE>& vect)
+        : _elements(SIZE)
+    {
+        std::copy(vect.data(), vect.data() + SIZE, data());
+    }
+
+    /**
+     * \brief Returns fixed size vector.
+     * \tparam SIZE fixed vector size, has to be equal to the vector size
+     * \return fixed size vector
+     */
+    template <unsigned int SIZE>
+    VectorN<TYPE, SIZE> getVectorN() const
+    {
+        assert(size() == SIZE);
+        VectorN<TYPE, SIZE> result;
+        std::copy(data(), data() + SIZE, result.data());
+        return result;
+    }
+
+    /** \return vector size */
+    inline unsigned int size() const { return _elements.size(); }
+
+    /**
+     * \brief Resizes vector.
+     * \param size new vector size, elements are set to zero
+     */
+    void resize(unsigned int size)
+    {
+        _elements.resize(size);
+        zeroize();
+    }
+
+    /**
+     * \brief Checks if all elements in the vector are valid.
+     * \return true if all elements are valid, false otherwise
+     */
+    bool isValid() const
+    {
+        return check::isValid(data(), size());
+    }
+
+    /**
+     * \brief Calculates and returns the squared length of the vector.
+     * \return vector length squared
+     */
+    TYPE getLengthSquared() const
+    {
+        TYPE length2 = TYPE{0};
+        for (unsigned int i = 0; i < size(); ++i)
+        {
+            length2 += data()[i] * data()[i];
+        }
+        return length2;
+    }
+
+    /**
+     * \brief Calculates and returns the length of the vector.
+     * \return vector length
+     */
+    TYPE getLength() const
+    {
+        return sqrt(getLengthSquared());
+    }
+
+    /**
+     * \brief Returns normalized vector.
+     * \return normalized vector
+     */
+    VectorX<double> getNormalized() const
+    {
+        VectorX<double> result(size());
+        double length = static_cast<double>(getLength());
+        if (length > 0.0)
+        {
+            double length_inv = 1.0 / length;
+            for (unsigned int i = 0; i < size(); ++i)
+            {
+                result(i) = static_cast<double>(data()[i]) * length_inv;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * \brief Gets std::vector of vector elements.
+     * \return std::vector<TYPE> of vector elements
+     */
+    std::vector<TYPE> getStdVector() const
+    {
+        return std::vector<TYPE>(data(), data() + size());
+    }
+
+    /**
+     * \brief Sets vector elements from std::vector, vector is resized if needed.
+     * \param elements input std::vector of vector elements
+     */
+    void setFromStdVector(const std::vector<TYPE>& elements)
+    {
+        _elements.resize(static_cast<unsigned int>(elements.size()));
+        std::copy(elements.begin(), elements.end(), data());
+    }
+
+    /**
+     * \brief Swaps the values of two specified rows in the vector.
+     * \param row1 Index of the first row
+     * \param row2 Index of the second row
+     */
+    void swapRows(unsigned int row1, unsigned int row2)
+    {
+        if (row1 < size() && row2 < size())
+        {
+            std::swap(data()[row1], data()[row2]);
+        }
+    }
+
+    /**
+     * \brief Returns a string representation of the vector.
+     * \return String representation of the vector
+     */
+    std::string toString() const
+    {
+        std::stringstream ss;
+        for (unsigned int i = 0; i < size(); ++i)
+        {
+            if (i != 0) ss << "\t";
+            ss << data()[i];
+        }
+        return ss.str();
+    }
+
+    /**
+     * \brief Negates (inverts) the vector.
+     */
+    void negate()
+    {
+        for (unsigned int i = 0; i < size(); ++i)
+        {
+            data()[i] = -data()[i];
+        }
+    }
+
+    /**
+     * \brief Sets all vector elements to zero.
+     */
+    void zeroize()
+    {
+        std::fill(data(), data() + size(), TYPE{0});
+    }
+
+    /**
+     * \brief Items accessor.
+     *
+     * Please notice that this operator is NOT bounds-checked.
+     *
+     * \param index index of the element
+     * \return vector element at given index
+     */
+    inline TYPE operator()(unsigned int index) const
+    {
+        return data()[index];
+    }
+
+    /**
+     * \brief Items accessor.
+     *
+     * Please notice that this operator is NOT bounds-checked.
+     *
+     * \param index index of the element
+     * \return vector element at given index
+     */
+    inline TYPE& operator()(unsigned int index)
+    {
+        return data()[index];
+    }
+
+    /** \return pointer to the vector elements */
+    inline const TYPE* data() const { return _elements.data(); }
+
+    /** \return pointer to the vector elements */
+    inline TYPE* data() { return _elements.data(); }
+
+    /**
+     * \brief Addition operator.
+     * \param vect vector to be added
+     * \return sum of the vectors
+     */
+    VectorX<TYPE> operator+(const VectorX<TYPE>& vect) const
+    {
+        VectorX<TYPE> result(size());
+        addVectors(*this, vect, &result);
+        return result;
+    }
+
+    /**
+     * \brief Negation operator.
+     * \return negated vector
+     */
+    VectorX<TYPE> operator-() const
+    {
+        VectorX<TYPE> result(*this);
+        result.negate();
+        return result;
+    }
+
+    /**
+     * \brief Subtraction operator.
+     * \param vect vector to be subtracted
+     * \return difference of the vectors
+     */
+    VectorX<TYPE> operator-(const VectorX<TYPE>& vect) const
+    {
+        VectorX<TYPE> result(size());
+        substractVectors(*this, vect, &result);
+        return result;
+    }
+
+    /**
+     * \brief Multiplication by a scalar operator.
+     * \param val value to be multiplied by
+     * \return product of the vector multiplied by the value
+     */
+    VectorX<TYPE> operator*(TYPE val) const
+    {
+        VectorX<TYPE> result(size());
+        multiplyVectorByScalar(*this, val, &result);
+        return result;
+    }
+
+    /**
+     * \brief Dot product operator.
+     * \param vect right-hand side vector
+     * \return dot product of the vectors
+     */
+    TYPE operator*(const VectorX<TYPE>& vect) const
+    {
+        TYPE result = TYPE{0};
+        calculateDotProduct(*this, vect, &result);
+        return result;
+    }
+
+    /**
+     * \brief Division by a scalar operator.
+     * \param val value to be divided by
+     * \return quotient of the vector divided by the value
+     */
+    VectorX<TYPE> operator/(TYPE val) const
+    {
+        VectorX<TYPE> result(size());
+        multiplyVectorByScalar(*this, TYPE{1} / val, &result);
+        return result;
+    }
+
+    /**
+     * \brief Unary addition operator.
+     * \param vect vector to be added
+     * \return reference to this vector
+     */
+    VectorX<TYPE>& operator+=(const VectorX<TYPE>& vect)
+    {
+        addVectors(*this, vect, this);
+        return *this;
+    }
+
+    /**
+     * \brief Unary subtraction operator.
+     * \param vect vector to be subtracted
+     * \return reference to this vector
+     */
+    VectorX<TYPE>& operator-=(const VectorX<TYPE>& vect)
+    {
+        substractVectors(*this, vect, this);
+        return *this;
+    }
+
+    /**
+     * \brief Unary multiplication operator (by scalar).
+     * \param val value to be multiplied by
+     * \return reference to this vector
+     */
+    VectorX<TYPE>& operator*=(TYPE val)
+    {
+        multiplyVectorByScalar(*this, val, this);
+        return *this;
+    }
+
+    /**
+     * \brief Unary division operator (by scalar).
+     * \param val value to be divided by
+     * \return reference to this vector
+     */
+    VectorX<TYPE>& operator/=(TYPE val)
+    {
+        multiplyVectorByScalar(*this, TYPE{1} / val, this);
+        return *this;
+    }
+
+    /**
+     * \brief Equality operator.
+     * \param vect vector to be compared with
+     * \return true if the vectors are equal, false otherwise
+     */
+    bool operator==(const VectorX<TYPE>& vect) const
+    {
+        return size() == vect.size() && std::equal(data(), data() + size(), vect.data());
+    }
+
+    /**
+     * \brief Inequality operator.
+     * \param vect vector to be compared with
+     * \return true if the vectors are not equal, false otherwise
+     */
+    bool operator!=(const VectorX<TYPE>& vect) const
+    {
+        return !(*this == vect);
+    }
+
+private:
+
+    DynamicStorage<TYPE, kInlineSize> _elements;    ///< vector elements
+};
+
+/**
+ * \brief Adds two vectors.
+ * \tparam TYPE type of the vectors elements
+ * \param lhs left-hand-side vector
+ * \param rhs right-hand-side vector
+ * \param result output vector, may be one of the operands
+ */
+template <typename TYPE>
+void addVectors(const VectorX<TYPE>& lhs, const VectorX<TYPE>& rhs, VectorX<TYPE>* result)
+{
+    assert(lhs.size() == rhs.size() && lhs.size() == result->size());
+    for (unsigned int i = 0; i < lhs.size(); ++i)
+    {
+        (*result)(i) = lhs(i) + rhs(i);
+    }
+}
+
+/**
+ * \brief Subtracts two vectors.
+ * \tparam TYPE type of the vectors elements
+ * \param lhs left-hand-side vector
+ * \param rhs right-hand-side vector
+ * \param result output vector, may be one of the operands
+ */
+template <typename TYPE>
+void substractVectors(const VectorX<TYPE>& lhs, const VectorX<TYPE>& rhs, VectorX<TYPE>* result)
+{
+    assert(lhs.size() == rhs.size() && lhs.size() == result->size());
+    for (unsigned int i = 0; i < lhs.size(); ++i)
+    {
+        (*result)(i) = lhs(i) - rhs(i);
+    }
+}
+
+/**
+ * \brief Multiplies a vector by a scalar.
+ * \tparam TYPE type of the vector elements
+ * \param vect vector
+ * \param val scalar to multiply by
+ * \param result output vector, may be the same as vect
+ */
+template <typename TYPE>
+void multiplyVectorByScalar(const VectorX<TYPE>& vect, TYPE val, VectorX<TYPE>* result)
+{
+    assert(vect.size() == result->size());
+    for (unsigned int i = 0; i < vect.size(); ++i)
+    {
+        (*result)(i) = vect(i) * val;
+    }
+}
+
+/**
+ * \brief Dot product calculation algorithm.
+ * \tparam TYPE type of the vectors elements
+ * \param lhs left-hand-side vector
+ * \param rhs right-hand-side vector
+ * \param result output result
+ */
+template <typename TYPE>
+void calculateDotProduct(const VectorX<TYPE>& lhs, const VectorX<TYPE>& rhs, TYPE* result)
+{
+    assert(lhs.size() == rhs.size());
+    *result = TYPE{0};
+    for (unsigned int i = 0; i < lhs.size(); ++i)
+    {
+        *result += lhs(i) * rhs(i);
+    }
+}
+
+/**
+ * \brief Multiplication operator.
+ * \tparam LHS_TYPE type of the left-hand side scalar
+ * \tparam RHS_TYPE type of the right-hand side vector elements
+ * \param val value to be multiplied by
+ * \param vect vector to be multiplied
+ * \return product of the vector multiplied by the value
+ */
+template <typename LHS_TYPE, typename RHS_TYPE>
+requires std::is_arithmetic<LHS_TYPE>::value
+VectorX<RHS_TYPE> operator*(LHS_TYPE val, const VectorX<RHS_TYPE>& vect)
+{
+    return vect * static_cast<RHS_TYPE>(val);
+}
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_VECTORX_H_
@@ -0,0 +1,128 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MISC_MAPPEDFILE_H_
+#define MCUTILS_MISC_MAPPEDFILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+#include <mcutils/mcutils_api.h>
+#include <mcutils/Result.h>
+
+namespace mc {
+
+/**
+ * \brief Read-only memory mapped file.
+ *
+ * File content is mapped into the process address space, so it can be used
+ * in place without reading or copying it. Pages are loaded by the operating
+ * system on first access and shared between processes mapping the same file.
+ */
+class MCUTILS_API MappedFile
+{
+public:
+
+    /**
+     * \brief Creates closed mapped file.
+     */
+    MappedFile() = default;
+
+    /**
+     * \brief Opens and maps file.
+     * \param path file path
+     */
+    explicit MappedFile(const char* path);
+
+    /**
+     * \brief Opens and maps file.
+     * \param path file path
+     */
+    explicit MappedFile(const std::string& path);
+
+    /**
+     * \brief Opens and maps file.
+     * \param path file path
+     */
+    explicit MappedFile(const std::filesystem::path& path);
+
+    MappedFile(const MappedFile&) = delete;
+
+    /** \brief Move constructor. */
+    MappedFile(MappedFile&& file) noexcept;
+
+    /**
+     * \brief Destructor.
+     */
+    ~MappedFile();
+
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /** \brief Move assignment operator. */
+    MappedFile& operator=(MappedFile&& file) noexcept;
+
+    /**
+     * \return mapped file content, nullptr if file is not open
+     */
+    inline const std::byte* data() const { return _data; }
+
+    /**
+     * \return mapped file size in bytes
+     */
+    inline size_t size() const { return _size; }
+
+    /**
+     * Checks if file is open.
+     * \return returns true if file is open and mapped
+     */
+    inline bool isOpen() const { return _data != nullptr; }
+
+    /**
+     * Opens and maps file. Empty files cannot be mapped.
+     * \param path file path
+     * \return Success on success, Failure on failure
+     */
+    Result openFile(const char* path);
+    inline Result openFile(const std::string& path)
+    {
+        return openFile(path.c_str());
+    }
+    inline Result openFile(const std::filesystem::path& path)
+    {
+        return openFile(path.string());
+    }
+
+    /**
+     * Unmaps and closes file.
+     */
+    void closeFile();
+
+private:
+
+    const std::byte* _data = nullptr;   ///< mapped file content
+    size_t _size = 0;                   ///< mapped file size
+};
+
+} // namespace mc
+
+#endif // MCUTILS_MISC_MAPPEDFILE_H_
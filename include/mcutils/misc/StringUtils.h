@@ -22,9 +22,11 @@
 #ifndef MCUTILS_MISC_STRINGUTILS_H_
 #define MCUTILS_MISC_STRINGUTILS_H_
 
+#include <cstddef>
 #include <limits>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <mcutils/mcutils_api.h>
@@ -32,6 +34,78 @@
 namespace mc {
 namespace str {
 
+/**
+ * \brief String parsing result.
+ */
+struct ParseResult
+{
+    bool valid = true;          ///< specifies if parsing succeeded
+    size_t offset = 0;          ///< offset of the invalid token (or of the end of the string)
+    unsigned int line   = 0;    ///< line of the invalid token (1-based)
+    unsigned int column = 0;    ///< column of the invalid token (1-based)
+    const char* error = "";     ///< error description
+
+    explicit operator bool() const { return valid; }
+};
+
+/**
+ * \brief White space separated numbers reader.
+ *
+ * Reader parses numbers with std::from_chars directly from the given string,
+ * without copying it or allocating memory. Numbers can be counted before
+ * parsing, so output storage can be sized up front. Only finite numbers are
+ * accepted. The string has to outlive the reader.
+ */
+class MCUTILS_API NumberReader
+{
+public:
+
+    /**
+     * \brief Constructor.
+     * \param str string to be parsed
+     */
+    explicit NumberReader(std::string_view str);
+
+    /**
+     * \brief Returns number of tokens left to be read.
+     * \return number of white space separated tokens left
+     */
+    size_t countNumbers() const;
+
+    /**
+     * \brief Returns number of tokens left to be read in the first non-empty line.
+     * \return number of white space separated tokens in the first non-empty line
+     */
+    size_t countNumbersInLine() const;
+
+    /**
+     * \brief Reads next number.
+     *
+     * On failure reader stops, value is left unchanged and subsequent reads
+     * fail as well.
+     *
+     * \param value output value
+     * \return true on success, false on failure
+     */
+    bool read(double* value);
+
+    /**
+     * \brief Returns parsing result.
+     * \return parsing result, describing the first error if any
+     */
+    ParseResult getResult() const;
+
+private:
+
+    std::string_view _str;      ///< string to be parsed
+    size_t _pos = 0;            ///< current position
+
+    size_t _error_pos = 0;      ///< error position
+    const char* _error = nullptr;   ///< error description, nullptr if no errors
+
+    void setError(size_t pos, const char* error);
+};
+
 /**
  * \brief Compares strings.
  * \param str_1 1st string to compare
@@ -22,13 +22,67 @@
 
 #include <mcutils/geo/ECEF.h>
 
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include <mcutils/geo/Cart2Geo.h>
+
 #include <mcutils/math/MathUtils.h>
+#include <mcutils/math/TrigKernels.h>
 
 using namespace units::math;
 
 
 namespace mc {
 
+namespace {
+
+constexpr size_t kBlockSize = 64;   ///< number of points converted at once by batch functions
+
+/**
+ * \brief Calls conversion function for contiguous parts of a batch.
+ * If threads is greater than 1 parts are converted by separate threads,
+ * each part is made of whole blocks.
+ * \param count number of points
+ * \param threads number of threads
+ * \param convert conversion function taking first and last (exclusive) point index
+ */
+template <typename FUN>
+void convertInParts(size_t count, unsigned int threads, FUN convert)
+{
+    const size_t blocks = (count + kBlockSize - 1) / kBlockSize;
+    threads = static_cast<unsigned int>(std::max<size_t>(1, std::min<size_t>(threads, blocks)));
+
+    if (threads == 1)
+    {
+        convert(0, count);
+        return;
+    }
+
+    const size_t part = ((blocks + threads - 1) / threads) * kBlockSize;
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (unsigned int t = 1; t < threads; ++t)
+    {
+        const size_t first = t * part;
+        if (first >= count) break;
+        workers.emplace_back(convert, first, std::min(count, first + part));
+    }
+
+    convert(0, std::min(count, part));
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+} // namespace
+
 //0.0,  1.0,  0.0
 //1.0,  0.0,  0.0
 //0.0,  0.0, -1.0
@@ -84,31 +138,7 @@ void ECEF::convertCart2Geo(units::length::meter_t x,
                            units::angle::radian_t* lon,
                            units::length::meter_t* alt) const
 {
-    // units not used due to performance reasons
-    double z2 = math::npow<2>(z)();
-    double r  = sqrt(math::npow<2>(x)() + math::npow<2>(y)());
-    double r2 = r*r;
-    double e2 = _ellipsoid.a2()() - _ellipsoid.b2()();
-    double f  = 54.0 * _ellipsoid.b2()() * z2;
-    double g  = r2 + (1.0 - _ellipsoid.e2())*z2 - _ellipsoid.e2()*e2;
-    double c  = _ellipsoid.e2()*_ellipsoid.e2() * f * r2 / math::npow<3>(g);
-    double s  = pow(1.0 + c + sqrt(c*c + 2.0*c), 1.0/3.0);
-    double p0 = s + 1.0/s + 1.0;
-    double p  = f / (3.0 * p0*p0 * g*g);
-    double q  = sqrt(1.0 + 2.0*(_ellipsoid.e2()*_ellipsoid.e2())*p);
-    double r0 = -(p * _ellipsoid.e2() * r)/(1.0 + q)
-                + sqrt(
-                    0.5*_ellipsoid.a2()()*(1.0 + 1.0/q)
-                    - p*(1.0 - _ellipsoid.e2())*z2/(q + q*q) - 0.5*p*r2
-                );
-    double uv = r - _ellipsoid.e2()*r0;
-    double u  = sqrt(uv*uv + z2);
-    double v  = sqrt(uv*uv + (1.0 - _ellipsoid.e2())*z2);
-    double z0 = _ellipsoid.b2()() * z() / (_ellipsoid.a()() * v);
-
-    *alt = units::length::meter_t(u * (1.0 - _ellipsoid.b2()() / (_ellipsoid.a()() * v)));
-    *lat = units::angle::radian_t(atan((z() + _ellipsoid.ep2()*z0)/r));
-    *lon = units::angle::radian_t(atan2(y(), x()));
+    Cart2Geo<Cart2GeoZhu>(_ellipsoid).convert(x, y, z, lat, lon, alt);
 }
 
 void ECEF::convertCart2GeoFast(units::length::meter_t x,
@@ -118,24 +148,7 @@ void ECEF::convertCart2GeoFast(units::length::meter_t x,
                                units::angle::radian_t* lon,
                                units::length::meter_t* alt) const
 {
-    units::length::meter_t p   = sqrt(x*x + y*y);
-    units::angle::radian_t tht = atan2(z*_ellipsoid.a(), p*_ellipsoid.b());
-    double ed2 = (_ellipsoid.a2() - _ellipsoid.b2()) / _ellipsoid.b2();
-
-    double sinTht = sin(tht());
-    double cosTht = cos(tht());
-
-    *lat = atan(
-        (z + _ellipsoid.b()*ed2*math::npow<3>(sinTht))
-        /
-        (p - _ellipsoid.e2()*_ellipsoid.a()*math::npow<3>(cosTht))
-    );
-    *lon = atan2(y, x);
-
-    double sinLat = sin((*lat)());
-    units::length::meter_t n = _ellipsoid.a() / sqrt(1.0 - _ellipsoid.e2()*math::npow<2>(sinLat));
-
-    *alt = p / cos((*lat)()) - n;
+    Cart2Geo<Cart2GeoBowring<1>>(_ellipsoid).convert(x, y, z, lat, lon, alt);
 }
 
 Geo ECEF::convertCart2Geo(units::length::meter_t x,
@@ -156,6 +169,191 @@ Geo ECEF::convertCart2GeoFast(units::length::meter_t x,
     return pos_geo;
 }
 
+void ECEF::convertGeo2Cart(std::span<const units::angle::radian_t> lat,
+                           std::span<const units::angle::radian_t> lon,
+                           std::span<const units::length::meter_t> alt,
+                           std::span<units::length::meter_t> x,
+                           std::span<units::length::meter_t> y,
+                           std::span<units::length::meter_t> z,
+                           unsigned int threads) const
+{
+    assert(lat.size() == lon.size() && lat.size() == alt.size());
+    assert(lat.size() == x.size() && lat.size() == y.size() && lat.size() == z.size());
+
+    const size_t count = std::min({ lat.size(), lon.size(), alt.size(), x.size(), y.size(), z.size() });
+
+    const double a  = _ellipsoid.a()();
+    const double e2 = _ellipsoid.e2();
+    const double b2_a2 = _ellipsoid.b2() / _ellipsoid.a2();
+
+    convertInParts(count, threads, [&](size_t first, size_t last)
+    {
+        double latLon[2 * kBlockSize];
+        double sinLatLon[2 * kBlockSize];
+        double cosLatLon[2 * kBlockSize];
+
+        const double* sinLat = sinLatLon;
+        const double* cosLat = cosLatLon;
+        const double* sinLon = sinLatLon + kBlockSize;
+        const double* cosLon = cosLatLon + kBlockSize;
+
+        for (size_t block = first; block < last; block += kBlockSize)
+        {
+            const size_t size = std::min(kBlockSize, last - block);
+
+            // latitudes and longitudes of a full block are passed at once,
+            // values after a partial block end are not used
+            for (size_t i = 0; i < size; ++i)
+            {
+                latLon[i]              = lat[block + i]();
+                latLon[i + kBlockSize] = lon[block + i]();
+            }
+            std::fill(latLon + size, latLon + kBlockSize, 0.0);
+            std::fill(latLon + kBlockSize + size, latLon + 2 * kBlockSize, 0.0);
+
+            math::sincos(latLon, sinLatLon, cosLatLon);
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                const double n  = a / std::sqrt(1.0 - e2 * sinLat[i]*sinLat[i]);
+                const double h  = alt[block + i]();
+                const double nh = (n + h) * cosLat[i];
+
+                x[block + i] = units::length::meter_t(nh * cosLon[i]);
+                y[block + i] = units::length::meter_t(nh * sinLon[i]);
+                z[block + i] = units::length::meter_t((n * b2_a2 + h) * sinLat[i]);
+            }
+        }
+    });
+}
+
+void ECEF::convertCart2Geo(std::span<const units::length::meter_t> x,
+                           std::span<const units::length::meter_t> y,
+                           std::span<const units::length::meter_t> z,
+                           std::span<units::angle::radian_t> lat,
+                           std::span<units::angle::radian_t> lon,
+                           std::span<units::length::meter_t> alt,
+                           unsigned int threads) const
+{
+    assert(x.size() == y.size() && x.size() == z.size());
+    assert(x.size() == lat.size() && x.size() == lon.size() && x.size() == alt.size());
+
+    const size_t count = std::min({ x.size(), y.size(), z.size(), lat.size(), lon.size(), alt.size() });
+
+    convertInParts(count, threads, [&](size_t first, size_t last)
+    {
+        const Cart2GeoZhu zhu(_ellipsoid);
+
+        double xb[kBlockSize];
+        double yb[kBlockSize];
+        double lat_y[kBlockSize];
+        double lat_x[kBlockSize];
+        double latb[kBlockSize];
+        double lonb[kBlockSize];
+
+        for (size_t block = first; block < last; block += kBlockSize)
+        {
+            const size_t size = std::min(kBlockSize, last - block);
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                xb[i] = x[block + i]();
+                yb[i] = y[block + i]();
+
+                double h = 0.0;
+                zhu.calculate(xb[i], yb[i], z[block + i](), &lat_y[i], &lat_x[i], &h);
+                alt[block + i] = units::length::meter_t(h);
+            }
+
+            math::atan2({ lat_y, size }, { lat_x, size }, { latb, size });
+            math::atan2({ yb, size }, { xb, size }, { lonb, size });
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                lat[block + i] = units::angle::radian_t(latb[i]);
+                lon[block + i] = units::angle::radian_t(lonb[i]);
+            }
+        }
+    });
+}
+
+void ECEF::convertCart2GeoFast(std::span<const units::length::meter_t> x,
+                               std::span<const units::length::meter_t> y,
+                               std::span<const units::length::meter_t> z,
+                               std::span<units::angle::radian_t> lat,
+                               std::span<units::angle::radian_t> lon,
+                               std::span<units::length::meter_t> alt,
+                               unsigned int threads) const
+{
+    assert(x.size() == y.size() && x.size() == z.size());
+    assert(x.size() == lat.size() && x.size() == lon.size() && x.size() == alt.size());
+
+    const size_t count = std::min({ x.size(), y.size(), z.size(), lat.size(), lon.size(), alt.size() });
+
+    const double a  = _ellipsoid.a()();
+    const double b  = _ellipsoid.b()();
+    const double e2 = _ellipsoid.e2();
+    const double ed2 = (_ellipsoid.a2() - _ellipsoid.b2()) / _ellipsoid.b2();
+
+    convertInParts(count, threads, [&](size_t first, size_t last)
+    {
+        double xb[kBlockSize];
+        double yb[kBlockSize];
+        double zb[kBlockSize];
+        double pb[kBlockSize];
+        double num[kBlockSize];
+        double den[kBlockSize];
+        double ang[kBlockSize];
+        double sinAng[kBlockSize];
+        double cosAng[kBlockSize];
+
+        for (size_t block = first; block < last; block += kBlockSize)
+        {
+            const size_t size = std::min(kBlockSize, last - block);
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                xb[i] = x[block + i]();
+                yb[i] = y[block + i]();
+                zb[i] = z[block + i]();
+                pb[i] = std::sqrt(xb[i]*xb[i] + yb[i]*yb[i]);
+
+                num[i] = zb[i]*a;
+                den[i] = pb[i]*b;
+            }
+
+            // parametric latitude
+            math::atan2({ num, size }, { den, size }, { ang, size });
+            math::sincos({ ang, size }, { sinAng, size }, { cosAng, size });
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                num[i] = zb[i] + b*ed2*math::npow<3>(sinAng[i]);
+                den[i] = pb[i] - e2*a*math::npow<3>(cosAng[i]);
+            }
+
+            // geodetic latitude
+            math::atan2({ num, size }, { den, size }, { ang, size });
+            math::sincos({ ang, size }, { sinAng, size }, { cosAng, size });
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                const double a2_n = a * std::sqrt(1.0 - e2*math::npow<2>(sinAng[i]));
+
+                lat[block + i] = units::angle::radian_t(ang[i]);
+                alt[block + i] = units::length::meter_t(pb[i]*cosAng[i] + zb[i]*sinAng[i] - a2_n);
+            }
+
+            math::atan2({ yb, size }, { xb, size }, { ang, size });
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                lon[block + i] = units::angle::radian_t(ang[i]);
+            }
+        }
+    });
+}
+
 Geo ECEF::getGeoOffset(units::angle::radian_t heading,
                        units::length::meter_t offset_x,
                        units::length::meter_t offset_y) const
@@ -187,10 +385,15 @@ void ECEF::setPosition(const Vector3_m& pos_cart)
 
 void ECEF::updateMatrices()
 {
-    double cosLat = cos(_pos_geo.lat);
-    double cosLon = cos(_pos_geo.lon);
-    double sinLat = sin(_pos_geo.lat);
-    double sinLon = sin(_pos_geo.lon);
+    const double latLon[] = { _pos_geo.lat(), _pos_geo.lon() };
+    double sinLatLon[2];
+    double cosLatLon[2];
+    math::sincos(latLon, sinLatLon, cosLatLon);
+
+    double cosLat = cosLatLon[0];
+    double cosLon = cosLatLon[1];
+    double sinLat = sinLatLon[0];
+    double sinLon = sinLatLon[1];
 
     // NED to ECEF
     _ned2ecef(0,0) = -cosLon*sinLat;
@@ -0,0 +1,560 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+#include <mcutils/geo/Geodesic.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+#include <mcutils/math/MathUtils.h>
+#include <mcutils/math/TrigKernels.h>
+
+namespace mc {
+
+namespace {
+
+constexpr size_t kBlockSize = 64;   ///< number of points processed at once by batch functions
+
+/**
+ * \brief Calculates haversine of the central angle.
+ * \param sin_dlat_2 sine of the half latitude difference
+ * \param sin_dlon_2 sine of the half longitude difference
+ * \param cos_lat_1 cosine of the first point latitude
+ * \param cos_lat_2 cosine of the second point latitude
+ */
+inline double getHaversine(double sin_dlat_2, double sin_dlon_2,
+                           double cos_lat_1, double cos_lat_2)
+{
+    return sin_dlat_2*sin_dlat_2 + cos_lat_1*cos_lat_2*sin_dlon_2*sin_dlon_2;
+}
+
+/**
+ * \brief Returns haversine of the central angle corresponding to the given distance.
+ * Returns value greater than 1 if central angle exceeds pi and negative value
+ * if distance is negative, so that no haversine is within the latter.
+ * \param distance [m] distance on the sphere
+ * \param radius [m] sphere radius
+ */
+inline double getHaversineThreshold(double distance, double radius)
+{
+    const double angle = distance / radius;
+    if ( angle < 0.0 )
+    {
+        return -1.0;
+    }
+    return angle < M_PI ? math::npow<2>(std::sin(0.5*angle)) : 2.0;
+}
+
+/**
+ * \brief Calculates Vincenty's arc length correction.
+ * \param b Vincenty's series coefficient B
+ * \param sin_sigma sine of the angular distance on the auxiliary sphere
+ * \param cos_sigma cosine of the angular distance on the auxiliary sphere
+ * \param cos_2sigma_m cosine of the doubled angular distance from the equator to the midpoint
+ */
+inline double getDeltaSigma(double b, double sin_sigma, double cos_sigma, double cos_2sigma_m)
+{
+    return b * sin_sigma * (cos_2sigma_m + 0.25 * b
+            * (cos_sigma * (-1.0 + 2.0 * cos_2sigma_m*cos_2sigma_m)
+               - b / 6.0 * cos_2sigma_m * (-3.0 + 4.0 * sin_sigma*sin_sigma) * (-3.0 + 4.0 * cos_2sigma_m*cos_2sigma_m)));
+}
+
+} // namespace
+
+Geodesic::Geodesic(const Ellipsoid& ellipsoid,
+                   unsigned int max_iterations,
+                   double tolerance)
+    : _max_iterations(max_iterations)
+    , _tolerance(tolerance)
+{
+    _a   = ellipsoid.a()();
+    _b   = ellipsoid.b()();
+    _f   = ellipsoid.f();
+    _b_a = _b / _a;
+    _ep2 = ellipsoid.ep2();
+    _r1  = ellipsoid.r1()();
+
+    // meridian radius of curvature ranges from b^2/a (equator) to a^2/b (poles),
+    // prime vertical radius of curvature ranges from a (equator) to a^2/b (poles)
+    _k_min = (_b * _b / _a) / _r1;
+    _k_max = (_a * _a / _b) / _r1;
+}
+
+Result Geodesic::solveInverse(units::angle::radian_t lat_1,
+                              units::angle::radian_t lon_1,
+                              units::angle::radian_t lat_2,
+                              units::angle::radian_t lon_2,
+                              units::length::meter_t* distance,
+                              units::angle::radian_t* azimuth_1,
+                              units::angle::radian_t* azimuth_2) const
+{
+    // reduced latitudes
+    const double tanU1 = _b_a * std::tan(lat_1());
+    const double tanU2 = _b_a * std::tan(lat_2());
+    const double cosU1 = 1.0 / std::sqrt(1.0 + tanU1*tanU1);
+    const double cosU2 = 1.0 / std::sqrt(1.0 + tanU2*tanU2);
+    const double sinU1 = tanU1 * cosU1;
+    const double sinU2 = tanU2 * cosU2;
+
+    const double l = std::remainder(lon_2() - lon_1(), 2.0 * M_PI);
+
+    double lambda = l;
+    double sinLambda = 0.0;
+    double cosLambda = 0.0;
+    double sinSigma = 0.0;
+    double cosSigma = 0.0;
+    double sigma = 0.0;
+    double cos2Alpha = 0.0;
+    double cos2SigmaM = 0.0;
+
+    Result result = Result::Failure;
+    for ( unsigned int i = 0; i < _max_iterations; ++i )
+    {
+        math::sincos(lambda, &sinLambda, &cosLambda);
+
+        const double t1 = cosU2 * sinLambda;
+        const double t2 = cosU1 * sinU2 - sinU1 * cosU2 * cosLambda;
+        sinSigma = std::sqrt(t1*t1 + t2*t2);
+
+        // coincident points
+        if ( sinSigma == 0.0 )
+        {
+            *distance = 0.0_m;
+            if ( azimuth_1 ) *azimuth_1 = 0.0_rad;
+            if ( azimuth_2 ) *azimuth_2 = 0.0_rad;
+            return Result::Success;
+        }
+
+        cosSigma = sinU1 * sinU2 + cosU1 * cosU2 * cosLambda;
+        sigma = std::atan2(sinSigma, cosSigma);
+
+        const double sinAlpha = cosU1 * cosU2 * sinLambda / sinSigma;
+        cos2Alpha = 1.0 - sinAlpha*sinAlpha;
+
+        // both points on the equator
+        cos2SigmaM = cos2Alpha != 0.0 ? cosSigma - 2.0 * sinU1 * sinU2 / cos2Alpha : 0.0;
+
+        const double c = _f / 16.0 * cos2Alpha * (4.0 + _f * (4.0 - 3.0 * cos2Alpha));
+        const double lambda_prev = lambda;
+        lambda = l + (1.0 - c) * _f * sinAlpha
+                * (sigma + c * sinSigma * (cos2SigmaM + c * cosSigma * (-1.0 + 2.0 * cos2SigmaM*cos2SigmaM)));
+
+        // nearly antipodal points
+        if ( std::fabs(lambda) > M_PI )
+        {
+            break;
+        }
+
+        if ( std::fabs(lambda - lambda_prev) <= _tolerance )
+        {
+            math::sincos(lambda, &sinLambda, &cosLambda);
+            result = Result::Success;
+            break;
+        }
+    }
+
+    // not converged iterate is meaningless, solving by bisection on the azimuth instead
+    if ( result != Result::Success )
+    {
+        return solveInverseAntipodal(lat_1, lon_1, lat_2, lon_2, distance, azimuth_1, azimuth_2);
+    }
+
+    double a = 0.0;
+    double b = 0.0;
+    getSeriesCoefs(cos2Alpha, &a, &b);
+
+    const double deltaSigma = getDeltaSigma(b, sinSigma, cosSigma, cos2SigmaM);
+
+    *distance = units::length::meter_t(_b * a * (sigma - deltaSigma));
+
+    if ( azimuth_1 )
+    {
+        *azimuth_1 = units::angle::radian_t(
+            std::atan2(cosU2 * sinLambda, cosU1 * sinU2 - sinU1 * cosU2 * cosLambda));
+    }
+
+    if ( azimuth_2 )
+    {
+        *azimuth_2 = units::angle::radian_t(
+            std::atan2(cosU1 * sinLambda, -sinU1 * cosU2 + cosU1 * sinU2 * cosLambda));
+    }
+
+    return result;
+}
+
+void Geodesic::solveDirect(units::angle::radian_t lat_1,
+                           units::angle::radian_t lon_1,
+                           units::angle::radian_t azimuth_1,
+                           units::length::meter_t distance,
+                           units::angle::radian_t* lat_2,
+                           units::angle::radian_t* lon_2,
+                           units::angle::radian_t* azimuth_2) const
+{
+    double sinAlpha1 = 0.0;
+    double cosAlpha1 = 0.0;
+    math::sincos(azimuth_1(), &sinAlpha1, &cosAlpha1);
+
+    // reduced latitude
+    const double tanU1 = _b_a * std::tan(lat_1());
+    const double cosU1 = 1.0 / std::sqrt(1.0 + tanU1*tanU1);
+    const double sinU1 = tanU1 * cosU1;
+
+    const double sigma1 = std::atan2(tanU1, cosAlpha1);
+    const double sinAlpha = cosU1 * sinAlpha1;
+    const double cos2Alpha = 1.0 - sinAlpha*sinAlpha;
+
+    double a = 0.0;
+    double b = 0.0;
+    getSeriesCoefs(cos2Alpha, &a, &b);
+
+    const double sigma0 = distance() / (_b * a);
+
+    double sigma = sigma0;
+    double sinSigma = 0.0;
+    double cosSigma = 0.0;
+    double cos2SigmaM = 0.0;
+
+    for ( unsigned int i = 0; i < _max_iterations; ++i )
+    {
+        math::sincos(sigma, &sinSigma, &cosSigma);
+        cos2SigmaM = std::cos(2.0 * sigma1 + sigma);
+
+        const double deltaSigma = getDeltaSigma(b, sinSigma, cosSigma, cos2SigmaM);
+
+        const double sigma_prev = sigma;
+        sigma = sigma0 + deltaSigma;
+
+        if ( std::fabs(sigma - sigma_prev) <= _tolerance )
+        {
+            break;
+        }
+    }
+
+    math::sincos(sigma, &sinSigma, &cosSigma);
+    cos2SigmaM = std::cos(2.0 * sigma1 + sigma);
+
+    const double x = sinU1 * sinSigma - cosU1 * cosSigma * cosAlpha1;
+
+    *lat_2 = units::angle::radian_t(
+        std::atan2(sinU1 * cosSigma + cosU1 * sinSigma * cosAlpha1,
+                   _b_a * std::sqrt(sinAlpha*sinAlpha + x*x)));
+
+    const double lambda = std::atan2(sinSigma * sinAlpha1, cosU1 * cosSigma - sinU1 * sinSigma * cosAlpha1);
+    const double c = _f / 16.0 * cos2Alpha * (4.0 + _f * (4.0 - 3.0 * cos2Alpha));
+    const double l = lambda - (1.0 - c) * _f * sinAlpha
+            * (sigma + c * sinSigma * (cos2SigmaM + c * cosSigma * (-1.0 + 2.0 * cos2SigmaM*cos2SigmaM)));
+
+    *lon_2 = units::angle::radian_t(std::remainder(lon_1() + l, 2.0 * M_PI));
+
+    if ( azimuth_2 )
+    {
+        *azimuth_2 = units::angle::radian_t(std::atan2(sinAlpha, -x));
+    }
+}
+
+Geo Geodesic::solveDirect(const Geo& pos_1,
+                          units::angle::radian_t azimuth_1,
+                          units::length::meter_t distance) const
+{
+    Geo pos_2;
+    pos_2.alt = pos_1.alt;
+    solveDirect(pos_1.lat, pos_1.lon, azimuth_1, distance, &pos_2.lat, &pos_2.lon);
+    return pos_2;
+}
+
+units::length::meter_t Geodesic::getSphericalDistance(units::angle::radian_t lat_1,
+                                                      units::angle::radian_t lon_1,
+                                                      units::angle::radian_t lat_2,
+                                                      units::angle::radian_t lon_2) const
+{
+    const double hav = getHaversine(std::sin(0.5 * (lat_2() - lat_1())),
+                                    std::sin(0.5 * (lon_2() - lon_1())),
+                                    std::cos(lat_1()), std::cos(lat_2()));
+    return units::length::meter_t(2.0 * _r1 * std::asin(std::sqrt(std::min(1.0, hav))));
+}
+
+Result Geodesic::getDistances(std::span<const units::angle::radian_t> lat_1,
+                              std::span<const units::angle::radian_t> lon_1,
+                              std::span<const units::angle::radian_t> lat_2,
+                              std::span<const units::angle::radian_t> lon_2,
+                              std::span<units::length::meter_t> distance,
+                              GeodesicMode mode,
+                              std::span<Result> results) const
+{
+    assert(lat_1.size() == lon_1.size() && lat_1.size() == lat_2.size() && lat_1.size() == lon_2.size());
+    assert(lat_1.size() == distance.size());
+    assert(results.empty() || results.size() == distance.size());
+
+    const size_t count = std::min({ lat_1.size(), lon_1.size(), lat_2.size(), lon_2.size(), distance.size() });
+
+    Result result = Result::Success;
+
+    if ( mode == GeodesicMode::Ellipsoidal )
+    {
+        for ( size_t i = 0; i < count; ++i )
+        {
+            Result r = solveInverse(lat_1[i], lon_1[i], lat_2[i], lon_2[i], &distance[i]);
+            if ( r != Result::Success ) result = r;
+            if ( i < results.size() ) results[i] = r;
+        }
+        return result;
+    }
+
+    // half differences and latitudes of a block are passed at once
+    double halfDiffs[2 * kBlockSize];
+    double sinHalfDiffs[2 * kBlockSize];
+    double lats[2 * kBlockSize];
+    double cosLats[2 * kBlockSize];
+
+    for ( size_t block = 0; block < count; block += kBlockSize )
+    {
+        const size_t size = std::min(kBlockSize, count - block);
+
+        for ( size_t i = 0; i < size; ++i )
+        {
+            halfDiffs[i]        = 0.5 * (lat_2[block + i]() - lat_1[block + i]());
+            halfDiffs[size + i] = 0.5 * (lon_2[block + i]() - lon_1[block + i]());
+            lats[i]        = lat_1[block + i]();
+            lats[size + i] = lat_2[block + i]();
+        }
+
+        math::sin({ halfDiffs, 2 * size }, { sinHalfDiffs, 2 * size });
+        math::cos({ lats, 2 * size }, { cosLats, 2 * size });
+
+        for ( size_t i = 0; i < size; ++i )
+        {
+            const double hav = getHaversine(sinHalfDiffs[i], sinHalfDiffs[size + i],
+                                            cosLats[i], cosLats[size + i]);
+            distance[block + i] = units::length::meter_t(2.0 * _r1 * std::asin(std::sqrt(std::min(1.0, hav))));
+        }
+    }
+
+    for ( size_t i = 0; i < std::min(count, results.size()); ++i )
+    {
+        results[i] = Result::Success;
+    }
+
+    return result;
+}
+
+size_t Geodesic::findWithinDistance(units::angle::radian_t lat_0,
+                                    units::angle::radian_t lon_0,
+                                    units::length::meter_t distance,
+                                    std::span<const units::angle::radian_t> lat,
+                                    std::span<const units::angle::radian_t> lon,
+                                    std::vector<size_t>* indices) const
+{
+    assert(lat.size() == lon.size());
+
+    const size_t count = std::min(lat.size(), lon.size());
+
+    indices->clear();
+
+    // no point is within negative (or NaN) distance
+    if ( !(distance() >= 0.0) )
+    {
+        return 0;
+    }
+
+    // points of haversine not greater than hav_inside are certainly within distance,
+    // points of haversine greater than hav_outside are certainly not
+    const double hav_inside  = getHaversineThreshold(distance() / _k_max, _r1);
+    const double hav_outside = getHaversineThreshold(distance() / _k_min, _r1);
+
+    const double cosLat0 = std::cos(lat_0());
+
+    double halfDiffs[2 * kBlockSize];
+    double sinHalfDiffs[2 * kBlockSize];
+    double lats[kBlockSize];
+    double cosLats[kBlockSize];
+
+    for ( size_t block = 0; block < count; block += kBlockSize )
+    {
+        const size_t size = std::min(kBlockSize, count - block);
+
+        for ( size_t i = 0; i < size; ++i )
+        {
+            halfDiffs[i]        = 0.5 * (lat[block + i]() - lat_0());
+            halfDiffs[size + i] = 0.5 * (lon[block + i]() - lon_0());
+            lats[i] = lat[block + i]();
+        }
+
+        math::sin({ halfDiffs, 2 * size }, { sinHalfDiffs, 2 * size });
+        math::cos({ lats, size }, { cosLats, size });
+
+        for ( size_t i = 0; i < size; ++i )
+        {
+            const double hav = getHaversine(sinHalfDiffs[i], sinHalfDiffs[size + i], cosLat0, cosLats[i]);
+
+            bool within = hav <= hav_inside;
+            if ( !within && hav <= hav_outside )
+            {
+                // distance is NaN if not converged
+                units::length::meter_t d = 0.0_m;
+                solveInverse(lat_0, lon_0, lat[block + i], lon[block + i], &d);
+                within = d <= distance;
+            }
+
+            if ( within )
+            {
+                indices->push_back(block + i);
+            }
+        }
+    }
+
+    return indices->size();
+}
+
+Result Geodesic::solveInverseAntipodal(units::angle::radian_t lat_1,
+                                       units::angle::radian_t lon_1,
+                                       units::angle::radian_t lat_2,
+                                       units::angle::radian_t lon_2,
+                                       units::length::meter_t* distance,
+                                       units::angle::radian_t* azimuth_1,
+                                       units::angle::radian_t* azimuth_2) const
+{
+    // canonical configuration: |lat_1| >= |lat_2|, lat_1 <= 0 and 0 <= lon_2 - lon_1 <= pi,
+    // points on the equator are flipped as well to give the northern route
+    const bool swap = std::fabs(lat_1()) < std::fabs(lat_2());
+    const double lat_sign = (swap ? lat_2() : lat_1()) >= 0.0 ? -1.0 : 1.0;
+    const double l_signed = std::remainder(swap ? lon_1() - lon_2() : lon_2() - lon_1(), 2.0 * M_PI);
+    const double lon_sign = l_signed < 0.0 ? -1.0 : 1.0;
+    const double l = std::fabs(l_signed);
+
+    // reduced latitudes, negative zero on the equator makes the first point lie south of it
+    const double tanU1 = _b_a * std::tan(lat_sign * (swap ? lat_2() : lat_1()));
+    const double tanU2 = _b_a * std::tan(lat_sign * (swap ? lat_1() : lat_2()));
+    const double cosU1 = 1.0 / std::sqrt(1.0 + tanU1*tanU1);
+    const double cosU2 = 1.0 / std::sqrt(1.0 + tanU2*tanU2);
+    const double sinU1 = -std::fabs(tanU1 * cosU1);
+    const double sinU2 = tanU2 * cosU2;
+
+    double sinAlpha = 0.0;
+    double cos2Alpha = 0.0;
+    double cosAlpha2 = 0.0;     // cosine of the azimuth at the second point times cosU2
+    double sigma = 0.0;
+    double sinSigma = 0.0;
+    double cosSigma = 0.0;
+    double cos2SigmaM = 0.0;
+
+    // longitude difference error of the geodesic starting at the given azimuth
+    // and reaching latitude of the second point heading north
+    auto getLongitudeError = [&](double alpha_1)
+    {
+        double sinAlpha1 = 0.0;
+        double cosAlpha1 = 0.0;
+        math::sincos(alpha_1, &sinAlpha1, &cosAlpha1);
+
+        sinAlpha  = sinAlpha1 * cosU1;
+        cos2Alpha = 1.0 - sinAlpha*sinAlpha;
+
+        const double cosAlpha1U1 = cosAlpha1 * cosU1;
+        cosAlpha2 = std::sqrt(std::max(0.0, cosAlpha1U1*cosAlpha1U1 + (cosU2*cosU2 - cosU1*cosU1)));
+
+        // angular distances and longitudes on the auxiliary sphere measured from the equator crossing
+        const double sigma1 = std::atan2(sinU1, cosAlpha1U1);
+        const double sigma2 = std::atan2(sinU2, cosAlpha2);
+        const double omega1 = std::atan2(sinAlpha * sinU1, cosAlpha1U1);
+        const double omega2 = std::atan2(sinAlpha * sinU2, cosAlpha2);
+
+        sigma = sigma2 - sigma1;
+        math::sincos(sigma, &sinSigma, &cosSigma);
+        cos2SigmaM = std::cos(sigma1 + sigma2);
+
+        const double c = _f / 16.0 * cos2Alpha * (4.0 + _f * (4.0 - 3.0 * cos2Alpha));
+        return omega2 - omega1 - l - (1.0 - c) * _f * sinAlpha
+                * (sigma + c * sinSigma * (cos2SigmaM + c * cosSigma * (-1.0 + 2.0 * cos2SigmaM*cos2SigmaM)));
+    };
+
+    // longitude difference increases monotonically with the azimuth from 0 to pi,
+    // so the root is bracketed
+    double alpha_min = 0.0;
+    double alpha_max = M_PI;
+    double alpha1 = 0.0;
+    double error = 0.0;
+
+    Result result = Result::Failure;
+    for ( unsigned int i = 0; i < _max_iterations; ++i )
+    {
+        alpha1 = 0.5 * (alpha_min + alpha_max);
+        error = getLongitudeError(alpha1);
+
+        if ( std::fabs(error) <= _tolerance )
+        {
+            result = Result::Success;
+            break;
+        }
+
+        if ( error < 0.0 )
+        {
+            alpha_min = alpha1;
+        }
+        else
+        {
+            alpha_max = alpha1;
+        }
+    }
+
+    if ( result != Result::Success )
+    {
+        *distance = units::length::meter_t(std::numeric_limits<double>::quiet_NaN());
+        if ( azimuth_1 ) *azimuth_1 = units::angle::radian_t(std::numeric_limits<double>::quiet_NaN());
+        if ( azimuth_2 ) *azimuth_2 = units::angle::radian_t(std::numeric_limits<double>::quiet_NaN());
+        return result;
+    }
+
+    double a = 0.0;
+    double b = 0.0;
+    getSeriesCoefs(cos2Alpha, &a, &b);
+
+    *distance = units::length::meter_t(_b * a * (sigma - getDeltaSigma(b, sinSigma, cosSigma, cos2SigmaM)));
+
+    // azimuths back from the canonical configuration
+    double az_1 = M_PI_2 + lat_sign * (lon_sign * alpha1 - M_PI_2);
+    double az_2 = M_PI_2 + lat_sign * (lon_sign * std::atan2(sinAlpha, cosAlpha2) - M_PI_2);
+    if ( swap )
+    {
+        std::swap(az_1, az_2);
+        az_1 += M_PI;
+        az_2 += M_PI;
+    }
+
+    if ( azimuth_1 ) *azimuth_1 = units::angle::radian_t(std::remainder(az_1, 2.0 * M_PI));
+    if ( azimuth_2 ) *azimuth_2 = units::angle::radian_t(std::remainder(az_2, 2.0 * M_PI));
+
+    return result;
+}
+
+void Geodesic::getSeriesCoefs(double cos2_alpha, double* a, double* b) const
+{
+    // Helmert's expansion parameter
+    const double u2 = cos2_alpha * _ep2;
+    const double sqrt_1u2 = std::sqrt(1.0 + u2);
+    const double k1 = (sqrt_1u2 - 1.0) / (sqrt_1u2 + 1.0);
+
+    *a = (1.0 + 0.25 * k1*k1) / (1.0 - k1);
+    *b = k1 * (1.0 - 0.375 * k1*k1);
+}
+
+} // namespace mc
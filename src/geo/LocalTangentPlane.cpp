@@ -0,0 +1,196 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+#include <mcutils/geo/LocalTangentPlane.h>
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace mc {
+
+LocalTangentPlane::LocalTangentPlane(const Ellipsoid& ellipsoid, const Geo& origin)
+    : _ecef(ellipsoid)
+{
+    setOrigin(origin);
+}
+
+Vector3_m LocalTangentPlane::convertGeo2NED(const Geo& pos_geo) const
+{
+    return convertECEF2NED(_ecef.convertGeo2Cart(pos_geo));
+}
+
+Geo LocalTangentPlane::convertNED2Geo(const Vector3_m& pos_ned) const
+{
+    return _ecef.convertCart2Geo(convertNED2ECEF(pos_ned));
+}
+
+Vector3_m LocalTangentPlane::convertECEF2NED(const Vector3_m& pos_cart) const
+{
+    const double dx = pos_cart.x()() - _origin[0];
+    const double dy = pos_cart.y()() - _origin[1];
+    const double dz = pos_cart.z()() - _origin[2];
+
+    return Vector3_m(
+        units::length::meter_t(_ecef2ned[0][0]*dx + _ecef2ned[0][1]*dy + _ecef2ned[0][2]*dz),
+        units::length::meter_t(_ecef2ned[1][0]*dx + _ecef2ned[1][1]*dy + _ecef2ned[1][2]*dz),
+        units::length::meter_t(_ecef2ned[2][0]*dx + _ecef2ned[2][1]*dy + _ecef2ned[2][2]*dz)
+    );
+}
+
+Vector3_m LocalTangentPlane::convertECEF2ENU(const Vector3_m& pos_cart) const
+{
+    const Vector3_m pos_ned = convertECEF2NED(pos_cart);
+    return Vector3_m(pos_ned.y(), pos_ned.x(), -pos_ned.z());
+}
+
+Vector3_m LocalTangentPlane::convertNED2ECEF(const Vector3_m& pos_ned) const
+{
+    const double n = pos_ned.x()();
+    const double e = pos_ned.y()();
+    const double d = pos_ned.z()();
+
+    // transposed ECEF to NED matrix
+    return Vector3_m(
+        units::length::meter_t(_origin[0] + _ecef2ned[0][0]*n + _ecef2ned[1][0]*e + _ecef2ned[2][0]*d),
+        units::length::meter_t(_origin[1] + _ecef2ned[0][1]*n + _ecef2ned[1][1]*e + _ecef2ned[2][1]*d),
+        units::length::meter_t(_origin[2] + _ecef2ned[0][2]*n + _ecef2ned[1][2]*e + _ecef2ned[2][2]*d)
+    );
+}
+
+void LocalTangentPlane::convertGeo2NED(std::span<const units::angle::radian_t> lat,
+                                       std::span<const units::angle::radian_t> lon,
+                                       std::span<const units::length::meter_t> alt,
+                                       std::span<units::length::meter_t> n,
+                                       std::span<units::length::meter_t> e,
+                                       std::span<units::length::meter_t> d,
+                                       unsigned int threads) const
+{
+    assert(lat.size() == lon.size() && lat.size() == alt.size());
+    assert(lat.size() == n.size() && lat.size() == e.size() && lat.size() == d.size());
+
+    const size_t count = std::min({ lat.size(), lon.size(), alt.size(), n.size(), e.size(), d.size() });
+
+    // ECEF coordinates are stored in the result arrays
+    n = n.first(count);
+    e = e.first(count);
+    d = d.first(count);
+    _ecef.convertGeo2Cart(lat.first(count), lon.first(count), alt.first(count), n, e, d, threads);
+
+    // element (1,2) of the ECEF to NED matrix is always zero
+    for (size_t i = 0; i < count; ++i)
+    {
+        const double dx = n[i]() - _origin[0];
+        const double dy = e[i]() - _origin[1];
+        const double dz = d[i]() - _origin[2];
+
+        n[i] = units::length::meter_t(_ecef2ned[0][0]*dx + _ecef2ned[0][1]*dy + _ecef2ned[0][2]*dz);
+        e[i] = units::length::meter_t(_ecef2ned[1][0]*dx + _ecef2ned[1][1]*dy);
+        d[i] = units::length::meter_t(_ecef2ned[2][0]*dx + _ecef2ned[2][1]*dy + _ecef2ned[2][2]*dz);
+    }
+}
+
+void LocalTangentPlane::convertNED2Geo(std::span<const units::length::meter_t> n,
+                                       std::span<const units::length::meter_t> e,
+                                       std::span<const units::length::meter_t> d,
+                                       std::span<units::angle::radian_t> lat,
+                                       std::span<units::angle::radian_t> lon,
+                                       std::span<units::length::meter_t> alt,
+                                       unsigned int threads) const
+{
+    assert(n.size() == e.size() && n.size() == d.size());
+    assert(n.size() == lat.size() && n.size() == lon.size() && n.size() == alt.size());
+
+    const size_t count = std::min({ n.size(), e.size(), d.size(), lat.size(), lon.size(), alt.size() });
+
+    std::vector<units::length::meter_t> x(count);
+    std::vector<units::length::meter_t> y(count);
+    std::vector<units::length::meter_t> z(count);
+
+    // transposed ECEF to NED matrix, element (1,2) is always zero
+    for (size_t i = 0; i < count; ++i)
+    {
+        const double ni = n[i]();
+        const double ei = e[i]();
+        const double di = d[i]();
+
+        x[i] = units::length::meter_t(_origin[0] + _ecef2ned[0][0]*ni + _ecef2ned[1][0]*ei + _ecef2ned[2][0]*di);
+        y[i] = units::length::meter_t(_origin[1] + _ecef2ned[0][1]*ni + _ecef2ned[1][1]*ei + _ecef2ned[2][1]*di);
+        z[i] = units::length::meter_t(_origin[2] + _ecef2ned[0][2]*ni                      + _ecef2ned[2][2]*di);
+    }
+
+    _ecef.convertCart2Geo(x, y, z, lat.first(count), lon.first(count), alt.first(count), threads);
+}
+
+void LocalTangentPlane::convertECEF2ENU(std::span<const units::length::meter_t> x,
+                                        std::span<const units::length::meter_t> y,
+                                        std::span<const units::length::meter_t> z,
+                                        std::span<units::length::meter_t> e,
+                                        std::span<units::length::meter_t> n,
+                                        std::span<units::length::meter_t> u) const
+{
+    assert(x.size() == y.size() && x.size() == z.size());
+    assert(x.size() == e.size() && x.size() == n.size() && x.size() == u.size());
+
+    const size_t count = std::min({ x.size(), y.size(), z.size(), e.size(), n.size(), u.size() });
+
+    // element (1,2) of the ECEF to NED matrix is always zero
+    for (size_t i = 0; i < count; ++i)
+    {
+        const double dx = x[i]() - _origin[0];
+        const double dy = y[i]() - _origin[1];
+        const double dz = z[i]() - _origin[2];
+
+        e[i] = units::length::meter_t(_ecef2ned[1][0]*dx + _ecef2ned[1][1]*dy);
+        n[i] = units::length::meter_t(_ecef2ned[0][0]*dx + _ecef2ned[0][1]*dy + _ecef2ned[0][2]*dz);
+        u[i] = units::length::meter_t(-(_ecef2ned[2][0]*dx + _ecef2ned[2][1]*dy + _ecef2ned[2][2]*dz));
+    }
+}
+
+void LocalTangentPlane::setOrigin(const Geo& origin)
+{
+    _ecef.setPosition(origin);
+    updateCache();
+}
+
+void LocalTangentPlane::setOrigin(const Vector3_m& origin_cart)
+{
+    _ecef.setPosition(origin_cart);
+    updateCache();
+}
+
+void LocalTangentPlane::updateCache()
+{
+    _origin[0] = _ecef.pos_cart().x()();
+    _origin[1] = _ecef.pos_cart().y()();
+    _origin[2] = _ecef.pos_cart().z()();
+
+    for (unsigned int r = 0; r < 3; ++r)
+    {
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            _ecef2ned[r][c] = _ecef.ecef2ned()(r,c);
+        }
+    }
+}
+
+} // namespace mc
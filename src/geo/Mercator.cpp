@@ -22,6 +22,8 @@
 
 #include <mcutils/geo/Mercator.h>
 
+#include <mcutils/math/TrigKernels.h>
+
 using namespace units::literals;
 using namespace units::math;
 
@@ -61,8 +63,16 @@ units::length::meter_t Mercator::calculateY(units::angle::radian_t lat)
 
 double Mercator::calculateT(units::angle::radian_t lat)
 {
-    double e_sinLat = _e.e() * sin(lat);
-    return tan(M_PI_4 + 0.5 * lat()) * pow((1.0 - e_sinLat) / (1.0 + e_sinLat), 0.5 * _e.e());
+    double sinLat = 0.0;
+    double cosLat = 0.0;
+    math::sincos(lat(), &sinLat, &cosLat);
+
+    // tan(pi/4 + lat/2) expressed with sine and cosine of the latitude,
+    // the form used avoids cancellation
+    double tanLat = lat() < 0.0 ? cosLat / (1.0 - sinLat) : (1.0 + sinLat) / cosLat;
+
+    double e_sinLat = _e.e() * sinLat;
+    return tanLat * pow((1.0 - e_sinLat) / (1.0 + e_sinLat), 0.5 * _e.e());
 }
 
 units::angle::radian_t Mercator::calculateT_inv(double t, double max_error,
@@ -24,6 +24,7 @@
 
 #include <sstream>
 
+#include <mcutils/math/TrigKernels.h>
 #include <mcutils/misc/Check.h>
 
 using namespace units::math;
@@ -37,18 +38,19 @@ Quaternion::Quaternion(double e0, double ex, double ey, double ez)
 
 Quaternion::Quaternion(const Angles& angl)
 {
-    units::angle::radian_t phi_2 = angl.phi() / 2.0;
-    units::angle::radian_t tht_2 = angl.tht() / 2.0;
-    units::angle::radian_t psi_2 = angl.psi() / 2.0;
+    const double angl_2[] = { 0.5 * angl.phi()(), 0.5 * angl.tht()(), 0.5 * angl.psi()() };
+    double sin_angl_2[3];
+    double cos_angl_2[3];
+    math::sincos(angl_2, sin_angl_2, cos_angl_2);
 
-    double sin_phi_2 = sin(phi_2);
-    double cos_phi_2 = cos(phi_2);
+    double sin_phi_2 = sin_angl_2[0];
+    double cos_phi_2 = cos_angl_2[0];
 
-    double sin_tht_2 = sin(tht_2);
-    double cos_tht_2 = cos(tht_2);
+    double sin_tht_2 = sin_angl_2[1];
+    double cos_tht_2 = cos_angl_2[1];
 
-    double sin_psi_2 = sin(psi_2);
-    double cos_psi_2 = cos(psi_2);
+    double sin_psi_2 = sin_angl_2[2];
+    double cos_psi_2 = cos_angl_2[2];
 
     double cos_phi_2_cos_psi_2 = cos_phi_2 * cos_psi_2;
     double cos_phi_2_sin_psi_2 = cos_phi_2 * sin_psi_2;
@@ -67,8 +69,9 @@ Quaternion::Quaternion(units::angle::radian_t angl, const Vector3d& vect)
 {
     double len_inv = 1.0 / vect.getLength();
 
-    double cos_angl_2 = cos(0.5 * angl);
-    double sin_angl_2 = sin(0.5 * angl);
+    double cos_angl_2 = 0.0;
+    double sin_angl_2 = 0.0;
+    math::sincos(0.5 * angl(), &sin_angl_2, &cos_angl_2);
 
     _e0 = cos_angl_2;
     _ex = sin_angl_2 * vect.x() * len_inv;
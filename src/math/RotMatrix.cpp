@@ -22,6 +22,8 @@
 
 #include <mcutils/math/RotMatrix.h>
 
+#include <mcutils/math/TrigKernels.h>
+
 using namespace units::math;
 
 namespace mc {
@@ -41,14 +43,19 @@ RotMatrix::RotMatrix(double xx, double xy, double xz,
 
 RotMatrix::RotMatrix(const Angles& angl)
 {
-    double sin_phi = sin(angl.phi());
-    double cos_phi = cos(angl.phi());
+    const double angles[] = { angl.phi()(), angl.tht()(), angl.psi()() };
+    double sin_angles[3];
+    double cos_angles[3];
+    math::sincos(angles, sin_angles, cos_angles);
+
+    double sin_phi = sin_angles[0];
+    double cos_phi = cos_angles[0];
 
-    double sin_tht = sin(angl.tht());
-    double cos_tht = cos(angl.tht());
+    double sin_tht = sin_angles[1];
+    double cos_tht = cos_angles[1];
 
-    double sin_psi = sin(angl.psi());
-    double cos_psi = cos(angl.psi());
+    double sin_psi = sin_angles[2];
+    double cos_psi = cos_angles[2];
 
     double sin_phi_sin_tht = sin_phi * sin_tht;
     double cos_phi_sin_tht = cos_phi * sin_tht;
@@ -0,0 +1,193 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+#include <mcutils/math/TableFile.h>
+
+#include <cstring>
+#include <fstream>
+
+namespace mc {
+
+std::vector<std::byte> TableFileWriter::toBytes() const
+{
+    TableFileHeader header;
+    header.count = static_cast<uint32_t>(_items.size());
+
+    std::vector<TableFileEntry> entries;
+    entries.reserve(_items.size());
+
+    size_t offset = sizeof(TableFileHeader) + _items.size() * sizeof(TableFileEntry);
+
+    for (const Item& item : _items)
+    {
+        TableFileEntry entry = item.entry;
+        entry.name_offset = offset;
+        entry.name_size   = static_cast<uint32_t>(item.name.size());
+        offset += item.name.size();
+        entries.push_back(entry);
+    }
+
+    for (size_t i = 0; i < _items.size(); ++i)
+    {
+        offset = alignOffset(offset);
+        entries[i].data_offset = offset;
+        entries[i].data_size   = _items[i].data.size();
+        offset += _items[i].data.size();
+    }
+
+    header.file_size = offset;
+
+    std::vector<std::byte> bytes(offset, std::byte{0});
+
+    std::memcpy(bytes.data(), &header, sizeof(header));
+
+    if (!entries.empty())
+    {
+        std::memcpy(bytes.data() + sizeof(header), entries.data(), entries.size() * sizeof(TableFileEntry));
+    }
+
+    for (size_t i = 0; i < _items.size(); ++i)
+    {
+        std::memcpy(bytes.data() + entries[i].name_offset, _items[i].name.data(), _items[i].name.size());
+
+        if (!_items[i].data.empty())
+        {
+            std::memcpy(bytes.data() + entries[i].data_offset, _items[i].data.data(), _items[i].data.size());
+        }
+    }
+
+    return bytes;
+}
+
+Result TableFileWriter::writeFile(const char* path) const
+{
+    std::ofstream ofs(path, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (ofs.is_open())
+    {
+        std::vector<std::byte> bytes = toBytes();
+        ofs.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+
+        if (ofs.good())
+        {
+            return Result::Success;
+        }
+    }
+
+    return Result::Failure;
+}
+
+TableFile::TableFile(const char* path)
+{
+    openFile(path);
+}
+
+Result TableFile::openFile(const char* path)
+{
+    closeFile();
+
+    if (_file.openFile(path) == Result::Success && isValid())
+    {
+        return Result::Success;
+    }
+
+    closeFile();
+    return Result::Failure;
+}
+
+void TableFile::closeFile()
+{
+    _file.closeFile();
+}
+
+int TableFile::findTable(std::string_view name) const
+{
+    for (unsigned int i = 0; i < count(); ++i)
+    {
+        if (getName(i) == name)
+        {
+            return static_cast<int>(i);
+        }
+    }
+
+    return -1;
+}
+
+std::string_view TableFile::getName(unsigned int index) const
+{
+    if (index < count())
+    {
+        const TableFileEntry& entry = getEntries()[index];
+        return std::string_view(reinterpret_cast<const char*>(_file.data() + entry.name_offset),
+                                entry.name_size);
+    }
+
+    return std::string_view();
+}
+
+TableFileType TableFile::getType(unsigned int index) const
+{
+    return static_cast<TableFileType>(index < count() ? getEntries()[index].type : 0);
+}
+
+bool TableFile::isValid() const
+{
+    const size_t size = _file.size();
+
+    if (size < sizeof(TableFileHeader))
+    {
+        return false;
+    }
+
+    TableFileHeader header;
+    std::memcpy(&header, _file.data(), sizeof(header));
+
+    if (std::memcmp(header.magic, TableFileHeader().magic, sizeof(header.magic)) != 0
+     || header.version    != TableFileHeader::kVersion
+     || header.byte_order != TableFileHeader::kByteOrder
+     || header.entry_size != sizeof(TableFileEntry)
+     || header.file_size  != size
+     || header.count > (size - sizeof(TableFileHeader)) / sizeof(TableFileEntry))
+    {
+        return false;
+    }
+
+    const TableFileEntry* entries = getEntries();
+
+    for (uint32_t i = 0; i < header.count; ++i)
+    {
+        const TableFileEntry& entry = entries[i];
+
+        if (entry.name_offset > size || entry.name_size > size - entry.name_offset
+         || entry.data_offset > size || entry.data_size > size - entry.data_offset
+         || entry.data_offset % alignof(std::max_align_t) != 0
+         || entry.search > static_cast<uint8_t>(TableSearch::Uniform)
+         || entry.interpolation > static_cast<uint8_t>(TableInterpolation::Pchip))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace mc
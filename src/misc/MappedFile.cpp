@@ -0,0 +1,156 @@
+/****************************************************************************//*
+ * Copyright (C) 2025 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+#include <mcutils/misc/MappedFile.h>
+
+#include <utility>
+
+#ifdef WIN32
+#   include <Windows.h>
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+namespace mc {
+
+MappedFile::MappedFile(const char* path)
+{
+    openFile(path);
+}
+
+MappedFile::MappedFile(const std::string& path)
+    : MappedFile(path.c_str())
+{}
+
+MappedFile::MappedFile(const std::filesystem::path& path)
+    : MappedFile(path.string().c_str())
+{}
+
+MappedFile::MappedFile(MappedFile&& file) noexcept
+    : _data(std::exchange(file._data, nullptr))
+    , _size(std::exchange(file._size, 0))
+{}
+
+MappedFile::~MappedFile()
+{
+    closeFile();
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& file) noexcept
+{
+    if (this != &file)
+    {
+        closeFile();
+        _data = std::exchange(file._data, nullptr);
+        _size = std::exchange(file._size, 0);
+    }
+
+    return *this;
+}
+
+Result MappedFile::openFile(const char* path)
+{
+    closeFile();
+
+#   ifdef WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return Result::Failure;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0)
+    {
+        CloseHandle(file);
+        return Result::Failure;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+
+    if (mapping == nullptr)
+    {
+        return Result::Failure;
+    }
+
+    // view keeps the mapping object alive, so handles can be closed right away
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+
+    if (data == nullptr)
+    {
+        return Result::Failure;
+    }
+
+    _size = static_cast<size_t>(size.QuadPart);
+#   else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return Result::Failure;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0)
+    {
+        close(fd);
+        return Result::Failure;
+    }
+
+    // mapping stays valid after the file descriptor is closed
+    void* data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        return Result::Failure;
+    }
+
+    _size = static_cast<size_t>(st.st_size);
+#   endif
+
+    _data = static_cast<const std::byte*>(data);
+
+    return Result::Success;
+}
+
+void MappedFile::closeFile()
+{
+    if (_data)
+    {
+#       ifdef WIN32
+        UnmapViewOfFile(_data);
+#       else
+        munmap(const_cast<std::byte*>(_data), _size);
+#       endif
+    }
+
+    _data = nullptr;
+    _size = 0;
+}
+
+} // namespace mc
@@ -22,6 +22,7 @@
 
 #include <mcutils/misc/StringUtils.h>
 
+#include <charconv>
 #include <cstdio>
 #include <cstring>
 #include <limits>
@@ -33,6 +34,129 @@
 namespace mc {
 namespace str {
 
+namespace {
+
+inline bool isSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+} // namespace
+
+NumberReader::NumberReader(std::string_view str)
+    : _str(str)
+{}
+
+size_t NumberReader::countNumbers() const
+{
+    size_t count = 0;
+    bool in_token = false;
+
+    for (size_t i = _pos; i < _str.size(); ++i)
+    {
+        bool space = isSpace(_str[i]);
+        if (!space && !in_token) ++count;
+        in_token = !space;
+    }
+
+    return count;
+}
+
+size_t NumberReader::countNumbersInLine() const
+{
+    size_t count = 0;
+    bool in_token = false;
+
+    for (size_t i = _pos; i < _str.size(); ++i)
+    {
+        if (_str[i] == '\n' && count > 0)
+        {
+            break;
+        }
+
+        bool space = isSpace(_str[i]);
+        if (!space && !in_token) ++count;
+        in_token = !space;
+    }
+
+    return count;
+}
+
+bool NumberReader::read(double* value)
+{
+    if (_error)
+    {
+        return false;
+    }
+
+    while (_pos < _str.size() && isSpace(_str[_pos])) ++_pos;
+
+    if (_pos == _str.size())
+    {
+        setError(_pos, "unexpected end of data");
+        return false;
+    }
+
+    const char* first = _str.data() + _pos;
+    const char* last  = _str.data() + _str.size();
+
+    // std::from_chars doesn't accept leading plus sign
+    if (*first == '+' && first + 1 < last && *(first + 1) != '-')
+    {
+        ++first;
+    }
+
+    double result = std::numeric_limits<double>::quiet_NaN();
+    std::from_chars_result fcr = std::from_chars(first, last, result);
+
+    if (fcr.ec != std::errc() || (fcr.ptr != last && !isSpace(*fcr.ptr))
+     || !check::isValid(result))
+    {
+        setError(_pos, "invalid number");
+        return false;
+    }
+
+    *value = result;
+    _pos = static_cast<size_t>(fcr.ptr - _str.data());
+
+    return true;
+}
+
+ParseResult NumberReader::getResult() const
+{
+    ParseResult result;
+
+    if (_error)
+    {
+        result.valid  = false;
+        result.offset = _error_pos;
+        result.error  = _error;
+        result.line   = 1;
+        result.column = 1;
+
+        for (size_t i = 0; i < _error_pos; ++i)
+        {
+            if (_str[i] == '\n')
+            {
+                ++result.line;
+                result.column = 1;
+            }
+            else
+            {
+                ++result.column;
+            }
+        }
+    }
+
+    return result;
+}
+
+void NumberReader::setError(size_t pos, const char* error)
+{
+    _error_pos = pos;
+    _error = error;
+}
+
 int compareStrings(const std::string& str_1, const std::string& str_2,
                    bool case_sensitive)
 {
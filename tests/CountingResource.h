@@ -0,0 +1,35 @@
+#ifndef TESTS_SDK_COUNTINGRESOURCE_H_
+#define TESTS_SDK_COUNTINGRESOURCE_H_
+
+#include <cstddef>
+#include <memory_resource>
+
+/**
+ * \brief Memory resource counting allocations made through it.
+ */
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    int allocations   = 0;
+    int deallocations = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override
+    {
+        ++deallocations;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+#endif // TESTS_SDK_COUNTINGRESOURCE_H_
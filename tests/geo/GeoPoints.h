@@ -0,0 +1,70 @@
+#ifndef TESTS_SDK_GEO_GEOPOINTS_H_
+#define TESTS_SDK_GEO_GEOPOINTS_H_
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <units.h>
+
+/**
+ * \brief Makes points evenly spread over the given area.
+ *
+ * Latitudes, longitudes and altitudes are repeated with co-prime periods
+ * (97, 101 and 13), so consecutive points differ in all of them.
+ *
+ * \param count number of points
+ * \param lat_min [rad] minimum latitude
+ * \param lat_max [rad] maximum latitude
+ * \param lon_min [rad] minimum longitude
+ * \param lon_max [rad] maximum longitude
+ * \param alt_min [m] minimum altitude
+ * \param alt_max [m] maximum altitude
+ * \param lat [rad] resulting latitudes
+ * \param lon [rad] resulting longitudes
+ * \param alt [m] resulting altitudes
+ */
+inline void makeGeoPoints(size_t count,
+                          units::angle::radian_t lat_min, units::angle::radian_t lat_max,
+                          units::angle::radian_t lon_min, units::angle::radian_t lon_max,
+                          units::length::meter_t alt_min, units::length::meter_t alt_max,
+                          std::vector<units::angle::radian_t>* lat,
+                          std::vector<units::angle::radian_t>* lon,
+                          std::vector<units::length::meter_t>* alt)
+{
+    lat->resize(count);
+    lon->resize(count);
+    alt->resize(count);
+    for ( size_t i = 0; i < count; ++i )
+    {
+        (*lat)[i] = lat_min + (lat_max - lat_min) * ((i % 97) / 96.0);
+        (*lon)[i] = lon_min + (lon_max - lon_min) * ((i % 101) / 100.0);
+        (*alt)[i] = alt_min + (alt_max - alt_min) * ((i % 13) / 12.0);
+    }
+}
+
+/**
+ * \brief Makes points randomly spread over the whole globe.
+ * \param count number of points
+ * \param seed random generator seed, the same seed gives the same points
+ * \param lat [rad] resulting latitudes
+ * \param lon [rad] resulting longitudes
+ */
+inline void makeRandomGeoPoints(size_t count, unsigned int seed,
+                                std::vector<units::angle::radian_t>* lat,
+                                std::vector<units::angle::radian_t>* lon)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist_lat(-0.5 * M_PI, 0.5 * M_PI);
+    std::uniform_real_distribution<double> dist_lon(-M_PI, M_PI);
+
+    lat->resize(count);
+    lon->resize(count);
+    for ( size_t i = 0; i < count; ++i )
+    {
+        (*lat)[i] = units::angle::radian_t(dist_lat(gen));
+        (*lon)[i] = units::angle::radian_t(dist_lon(gen));
+    }
+}
+
+#endif // TESTS_SDK_GEO_GEOPOINTS_H_
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <mcutils/geo/Cart2Geo.h>
+#include <mcutils/geo/ECEF.h>
+
+#include <mcutils/geo/Mars2015.h>
+#include <mcutils/geo/WGS84.h>
+
+// linear position tolerance (0.1 mm)
+#define LINEAR_POSITION_TOLERANCE 1.0e-4
+// latitude and longitude tolerance (10^-9 rad ~ ca. 6 mm)
+#define LAT_LON_TOLERANCE 1.0e-9
+
+class TestCart2Geo : public ::testing::Test
+{
+protected:
+    TestCart2Geo() {}
+    virtual ~TestCart2Geo() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    // points spread over all latitudes including poles at the given altitude,
+    // compared with the ECEF geodetic to cartesian conversion
+    template <class METHOD>
+    static void checkConvert(const mc::Ellipsoid& ellipsoid, double alt, double lat_tolerance)
+    {
+        mc::ECEF ecef(ellipsoid);
+        mc::Cart2Geo<METHOD> cart2geo(ellipsoid);
+
+        for ( int i = 0; i <= 180; ++i )
+        {
+            mc::Geo pos_geo_ref;
+            pos_geo_ref.lat = units::angle::radian_t(-M_PI_2 + M_PI * i / 180.0);
+            pos_geo_ref.lon = units::angle::radian_t(-M_PI + 2.0 * M_PI * i / 181.0);
+            pos_geo_ref.alt = units::length::meter_t(alt);
+
+            mc::Geo pos_geo = cart2geo.convert(ecef.convertGeo2Cart(pos_geo_ref));
+
+            EXPECT_NEAR(pos_geo.lat(), pos_geo_ref.lat(), lat_tolerance) << "alt= " << alt;
+            EXPECT_NEAR(pos_geo.alt(), pos_geo_ref.alt(), LINEAR_POSITION_TOLERANCE) << "alt= " << alt;
+            if ( i > 0 && i < 180 )
+            {
+                EXPECT_NEAR(pos_geo.lon(), pos_geo_ref.lon(), LAT_LON_TOLERANCE) << "alt= " << alt;
+            }
+        }
+    }
+
+    template <class METHOD>
+    static void checkPoles()
+    {
+        mc::Cart2Geo<METHOD> cart2geo(mc::WGS84::ellipsoid);
+
+        mc::Geo pos_geo = cart2geo.convert(mc::Vector3_m(0.0_m, 0.0_m, mc::WGS84::ellipsoid.b() + 100.0_m));
+        EXPECT_NEAR(pos_geo.lat(), M_PI_2, LAT_LON_TOLERANCE);
+        EXPECT_NEAR(pos_geo.alt(), 100.0, LINEAR_POSITION_TOLERANCE);
+
+        pos_geo = cart2geo.convert(mc::Vector3_m(0.0_m, 0.0_m, -mc::WGS84::ellipsoid.b() - 100.0_m));
+        EXPECT_NEAR(pos_geo.lat(), -M_PI_2, LAT_LON_TOLERANCE);
+        EXPECT_NEAR(pos_geo.alt(), 100.0, LINEAR_POSITION_TOLERANCE);
+
+        // few millimeters from the pole
+        pos_geo = cart2geo.convert(mc::Vector3_m(0.001_m, 0.001_m, mc::WGS84::ellipsoid.b()));
+        EXPECT_NEAR(pos_geo.lat(), M_PI_2, LAT_LON_TOLERANCE);
+        EXPECT_NEAR(pos_geo.alt(), 0.0, LINEAR_POSITION_TOLERANCE);
+    }
+};
+
+TEST_F(TestCart2Geo, CanConvertZhu)
+{
+    for ( double alt : { -1.0e6, -1.0e4, 0.0, 1.0e4, 1.0e5, 1.0e6, 3.6e7, 4.0e8 } )
+    {
+        checkConvert<mc::Cart2GeoZhu>(mc::WGS84::ellipsoid, alt, 1.0e-15);
+    }
+    checkConvert<mc::Cart2GeoZhu>(mc::Mars2015::ellipsoid, 1.0e4, 1.0e-15);
+    checkPoles<mc::Cart2GeoZhu>();
+}
+
+TEST_F(TestCart2Geo, CanConvertBowring)
+{
+    // single iteration
+    checkConvert<mc::Cart2GeoBowring<1>>(mc::WGS84::ellipsoid, -1.0e6, 1.0e-8);
+    checkConvert<mc::Cart2GeoBowring<1>>(mc::WGS84::ellipsoid,  0.0,   1.0e-15);
+    checkConvert<mc::Cart2GeoBowring<1>>(mc::WGS84::ellipsoid,  1.0e4, 1.0e-12);
+    checkConvert<mc::Cart2GeoBowring<1>>(mc::WGS84::ellipsoid,  1.0e6, 1.0e-8);
+    checkConvert<mc::Cart2GeoBowring<1>>(mc::WGS84::ellipsoid,  3.6e7, 1.0e-7);
+    checkPoles<mc::Cart2GeoBowring<1>>();
+
+    // two iterations
+    for ( double alt : { -1.0e6, -1.0e4, 0.0, 1.0e4, 1.0e5, 1.0e6, 3.6e7, 4.0e8 } )
+    {
+        checkConvert<mc::Cart2GeoBowring<2>>(mc::WGS84::ellipsoid, alt, 1.0e-15);
+    }
+    checkConvert<mc::Cart2GeoBowring<2>>(mc::Mars2015::ellipsoid, 1.0e4, 1.0e-15);
+    checkPoles<mc::Cart2GeoBowring<2>>();
+}
+
+TEST_F(TestCart2Geo, CanConvertOlson)
+{
+    for ( double alt : { -1.0e6, -1.0e4, 0.0, 1.0e4, 1.0e5, 1.0e6, 3.6e7, 4.0e8 } )
+    {
+        checkConvert<mc::Cart2GeoOlson>(mc::WGS84::ellipsoid, alt, 1.0e-15);
+    }
+    checkConvert<mc::Cart2GeoOlson>(mc::Mars2015::ellipsoid, 1.0e4, 1.0e-15);
+    checkPoles<mc::Cart2GeoOlson>();
+}
+
+TEST_F(TestCart2Geo, CanConvertBatch)
+{
+    mc::ECEF ecef(mc::WGS84::ellipsoid);
+    mc::Cart2Geo<mc::Cart2GeoOlson> cart2geo(mc::WGS84::ellipsoid);
+
+    const size_t count = 101;
+    std::vector<units::length::meter_t> x(count);
+    std::vector<units::length::meter_t> y(count);
+    std::vector<units::length::meter_t> z(count);
+    for ( size_t i = 0; i < count; ++i )
+    {
+        mc::Vector3_m pos_cart = ecef.convertGeo2Cart(units::angle::radian_t(-1.5 + 0.03 * i),
+                                                      units::angle::radian_t(-3.0 + 0.06 * i),
+                                                      units::length::meter_t(100.0 * i));
+        x[i] = pos_cart.x();
+        y[i] = pos_cart.y();
+        z[i] = pos_cart.z();
+    }
+
+    std::vector<units::angle::radian_t> lat(count);
+    std::vector<units::angle::radian_t> lon(count);
+    std::vector<units::length::meter_t> alt(count);
+    cart2geo.convert(x, y, z, lat, lon, alt);
+
+    for ( size_t i = 0; i < count; ++i )
+    {
+        mc::Geo pos_geo = cart2geo.convert(mc::Vector3_m(x[i], y[i], z[i]));
+        EXPECT_DOUBLE_EQ(lat[i](), pos_geo.lat());
+        EXPECT_DOUBLE_EQ(lon[i](), pos_geo.lon());
+        EXPECT_DOUBLE_EQ(alt[i](), pos_geo.alt());
+    }
+}
+
+TEST_F(TestCart2Geo, CanConvertTheSameAsECEF)
+{
+    mc::ECEF ecef(mc::WGS84::ellipsoid);
+    mc::Cart2Geo<mc::Cart2GeoZhu> zhu(mc::WGS84::ellipsoid);
+    mc::Cart2Geo<mc::Cart2GeoBowring<1>> bowring(mc::WGS84::ellipsoid);
+
+    const mc::Vector3_m pos_cart(4.0e6_m, 3.0e6_m, 3.8e6_m);
+
+    mc::Geo pos_geo_ref = ecef.convertCart2Geo(pos_cart);
+    mc::Geo pos_geo = zhu.convert(pos_cart);
+    EXPECT_DOUBLE_EQ(pos_geo.lat(), pos_geo_ref.lat());
+    EXPECT_DOUBLE_EQ(pos_geo.lon(), pos_geo_ref.lon());
+    EXPECT_DOUBLE_EQ(pos_geo.alt(), pos_geo_ref.alt());
+
+    pos_geo_ref = ecef.convertCart2GeoFast(pos_cart);
+    pos_geo = bowring.convert(pos_cart);
+    EXPECT_DOUBLE_EQ(pos_geo.lat(), pos_geo_ref.lat());
+    EXPECT_DOUBLE_EQ(pos_geo.lon(), pos_geo_ref.lon());
+    EXPECT_DOUBLE_EQ(pos_geo.alt(), pos_geo_ref.alt());
+}
@@ -1,10 +1,14 @@
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include <mcutils/geo/ECEF.h>
 
 #include <mcutils/geo/Mars2015.h>
 #include <mcutils/geo/WGS84.h>
 
+#include <geo/GeoPoints.h>
+
 // linear position tolerance (0.1 mm)
 #define LINEAR_POSITION_TOLERANCE 1.0e-4
 // latitude and longitude tolerance (10^-9 rad ~ ca. 6 mm)
@@ -19,6 +23,60 @@ protected:
     virtual ~TestECEF() {}
     void SetUp() override {}
     void TearDown() override {}
+
+    // points spread over the whole globe and altitudes up to 1000 km
+    static void makeGeoPoints(size_t count,
+                              std::vector<units::angle::radian_t>* lat,
+                              std::vector<units::angle::radian_t>* lon,
+                              std::vector<units::length::meter_t>* alt)
+    {
+        ::makeGeoPoints(count,
+                        units::angle::radian_t(-0.49 * M_PI), units::angle::radian_t(0.49 * M_PI),
+                        units::angle::radian_t(-M_PI), units::angle::radian_t(M_PI),
+                        units::length::meter_t(-500.0), units::length::meter_t(1.0e6 - 500.0),
+                        lat, lon, alt);
+    }
+
+    static void checkCart2GeoBatch(size_t count, unsigned int threads, bool fast)
+    {
+        mc::ECEF ecef(mc::WGS84::ellipsoid);
+
+        std::vector<units::angle::radian_t> lat_ref;
+        std::vector<units::angle::radian_t> lon_ref;
+        std::vector<units::length::meter_t> alt_ref;
+        makeGeoPoints(count, &lat_ref, &lon_ref, &alt_ref);
+
+        std::vector<units::length::meter_t> x(count);
+        std::vector<units::length::meter_t> y(count);
+        std::vector<units::length::meter_t> z(count);
+        ecef.convertGeo2Cart(lat_ref, lon_ref, alt_ref, x, y, z);
+
+        std::vector<units::angle::radian_t> lat(count);
+        std::vector<units::angle::radian_t> lon(count);
+        std::vector<units::length::meter_t> alt(count);
+        if ( fast )
+        {
+            ecef.convertCart2GeoFast(x, y, z, lat, lon, alt, threads);
+        }
+        else
+        {
+            ecef.convertCart2Geo(x, y, z, lat, lon, alt, threads);
+        }
+
+        for ( size_t i = 0; i < count; ++i )
+        {
+            mc::Geo pos_geo = fast ? ecef.convertCart2GeoFast(x[i], y[i], z[i])
+                                   : ecef.convertCart2Geo(x[i], y[i], z[i]);
+            // batch conversions use vectorized trigonometric functions
+            EXPECT_NEAR(lat[i](), pos_geo.lat(), 1.0e-14);
+            EXPECT_NEAR(lon[i](), pos_geo.lon(), 1.0e-14);
+            EXPECT_NEAR(alt[i](), pos_geo.alt(), 1.0e-6);
+
+            EXPECT_NEAR(lat[i](), lat_ref[i](), LAT_LON_TOLERANCE);
+            EXPECT_NEAR(lon[i](), lon_ref[i](), LAT_LON_TOLERANCE);
+            EXPECT_NEAR(alt[i](), alt_ref[i](), fast ? 1.0e-2 : LINEAR_POSITION_TOLERANCE);
+        }
+    }
 };
 
 TEST_F(TestECEF, CanConstruct)
@@ -159,6 +217,70 @@ TEST_F(TestECEF, CanConvertFromGeoToCartAt45N45E100H)
     EXPECT_NEAR(pos_cart.z()(), 4487419.119544039  , LINEAR_POSITION_TOLERANCE);
 }
 
+TEST_F(TestECEF, CanConvertFromGeoToCartBatch)
+{
+    mc::ECEF ecef(mc::WGS84::ellipsoid);
+
+    // not a multiple of the block size
+    constexpr size_t count = 1001;
+
+    std::vector<units::angle::radian_t> lat;
+    std::vector<units::angle::radian_t> lon;
+    std::vector<units::length::meter_t> alt;
+    makeGeoPoints(count, &lat, &lon, &alt);
+
+    for ( unsigned int threads : { 1, 4 } )
+    {
+        std::vector<units::length::meter_t> x(count);
+        std::vector<units::length::meter_t> y(count);
+        std::vector<units::length::meter_t> z(count);
+        ecef.convertGeo2Cart(lat, lon, alt, x, y, z, threads);
+
+        for ( size_t i = 0; i < count; ++i )
+        {
+            mc::Vector3_m pos_cart = ecef.convertGeo2Cart(lat[i], lon[i], alt[i]);
+            EXPECT_NEAR(x[i](), pos_cart.x()(), LINEAR_POSITION_TOLERANCE);
+            EXPECT_NEAR(y[i](), pos_cart.y()(), LINEAR_POSITION_TOLERANCE);
+            EXPECT_NEAR(z[i](), pos_cart.z()(), LINEAR_POSITION_TOLERANCE);
+        }
+    }
+}
+
+TEST_F(TestECEF, CanConvertFromCartToGeoBatch)
+{
+    checkCart2GeoBatch(1001, 1, false);
+    checkCart2GeoBatch(64, 1, false);
+    checkCart2GeoBatch(5, 1, false);
+}
+
+TEST_F(TestECEF, CanConvertFromCartToGeoBatchMultithreaded)
+{
+    checkCart2GeoBatch(1001, 4, false);
+
+    // more threads than blocks
+    checkCart2GeoBatch(100, 8, false);
+}
+
+TEST_F(TestECEF, CanConvertFromCartToGeoFastBatch)
+{
+    checkCart2GeoBatch(1001, 1, true);
+    checkCart2GeoBatch(1001, 3, true);
+}
+
+TEST_F(TestECEF, CanConvertEmptyBatch)
+{
+    mc::ECEF ecef(mc::WGS84::ellipsoid);
+    std::vector<units::angle::radian_t> lat;
+    std::vector<units::angle::radian_t> lon;
+    std::vector<units::length::meter_t> alt;
+    std::vector<units::length::meter_t> x;
+    std::vector<units::length::meter_t> y;
+    std::vector<units::length::meter_t> z;
+    EXPECT_NO_THROW(ecef.convertGeo2Cart(lat, lon, alt, x, y, z, 4));
+    EXPECT_NO_THROW(ecef.convertCart2Geo(x, y, z, lat, lon, alt, 4));
+    EXPECT_NO_THROW(ecef.convertCart2GeoFast(x, y, z, lat, lon, alt, 4));
+}
+
 TEST_F(TestECEF, CanGetGeoOffsetHeading0)
 {
     mc::ECEF ecef(mc::WGS84::ellipsoid);
@@ -0,0 +1,347 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <mcutils/geo/Geodesic.h>
+
+#include <mcutils/geo/Mars2015.h>
+#include <mcutils/geo/WGS84.h>
+
+#include <geo/GeoPoints.h>
+
+// linear position tolerance (1 mm)
+#define LINEAR_POSITION_TOLERANCE 1.0e-3
+// latitude and longitude tolerance (10^-9 rad ~ ca. 6 mm)
+#define LAT_LON_TOLERANCE 1.0e-9
+// azimuth tolerance (10^-9 rad)
+#define AZIMUTH_TOLERANCE 1.0e-9
+
+class TestGeodesic : public ::testing::Test
+{
+protected:
+    TestGeodesic() {}
+    virtual ~TestGeodesic() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static units::angle::radian_t getAngle(double deg, double min, double sec)
+    {
+        const double sign = deg < 0.0 ? -1.0 : 1.0;
+        return units::angle::radian_t(sign * (std::fabs(deg) + min / 60.0 + sec / 3600.0) * M_PI / 180.0);
+    }
+};
+
+TEST_F(TestGeodesic, CanSolveInverse)
+{
+    // Vincenty's example, Flinders Peak to Buninyong, GRS80 ellipsoid
+    // the same as WGS84 within the tolerance
+    mc::Geodesic geodesic(mc::WGS84::ellipsoid);
+
+    units::length::meter_t distance = 0.0_m;
+    units::angle::radian_t azimuth_1 = 0.0_rad;
+    units::angle::radian_t azimuth_2 = 0.0_rad;
+
+    EXPECT_EQ(geodesic.solveInverse(getAngle(-37.0, 57.0,  3.72030), getAngle(144.0, 25.0, 29.52440),
+                                    getAngle(-37.0, 39.0, 10.15610), getAngle(143.0, 55.0, 35.38390),
+                                    &distance, &azimuth_1, &azimuth_2),
+              mc::Result::Success);
+
+    EXPECT_NEAR(distance(), 54972.271, LINEAR_POSITION_TOLERANCE);
+    EXPECT_NEAR(azimuth_1(), getAngle(306.0, 52.0, 5.37)() - 2.0 * M_PI, 1.0e-7);
+    EXPECT_NEAR(azimuth_2(), getAngle(127.0, 10.0, 25.07)() - M_PI, 1.0e-7);
+}
+
+TEST_F(TestGeodesic, CanSolveInverseMeridianAndEquator)
+{
+    mc::Geodesic geodesic(mc::WGS84::ellipsoid);
+
+    units::length::meter_t distance = 0.0_m;
+    units::angle::radian_t azimuth_1 = 0.0_rad;
+
+    // quarter meridian
+    EXPECT_EQ(geodesic.solveInverse(0.0_rad, 0.3_rad, units::angle::radian_t(M_PI_2), 0.3_rad,
+                                    &distance, &azimuth_1),
+              mc::Result::Success);
+    EXPECT_NEAR(distance(), 10001965.729, LINEAR_POSITION_TOLERANCE);
+    EXPECT_NEAR(azimuth_1(), 0.0, AZIMUTH_TOLERANCE);
+
+    // along the equator
+    EXPECT_EQ(geodesic.solveInverse(0.0_rad, 0.0_rad, 0.0_rad, 1.0_rad, &distance, &azimuth_1),
+              mc::Result::Success);
+    EXPECT_NEAR(distance(), mc::WGS84::ellipsoid.a()(), LINEAR_POSITION_TOLERANCE);
+    EXPECT_NEAR(azimuth_1(), M_PI_2, AZIMUTH_TOLERANCE);
+
+    // across the antimeridian
+    EXPECT_EQ(geodesic.solveInverse(0.0_rad, units::angle::radian_t(M_PI - 0.5), 0.0_rad, units::angle::radian_t(-M_PI + 0.5),
+                                    &distance, &azimuth_1),
+              mc::Result::Success);
+    EXPECT_NEAR(distance(), mc::WGS84::ellipsoid.a()(), LINEAR_POSITION_TOLERANCE);
+    EXPECT_NEAR(azimuth_1(), M_PI_2, AZIMUTH_TOLERANCE);
+
+    // coincident points
+    EXPECT_EQ(geodesic.solveInverse(0.5_rad, 0.5_rad, 0.5_rad, 0.5_rad, &distance), mc::Result::Success);
+    EXPECT_DOUBLE_EQ(distance(), 0.0);
+}
+
+TEST_F(TestGeodesic, CanSolveInverseNearlyAntipodal)
+{
+    mc::Geodesic geodesic(mc::WGS84::ellipsoid);
+
+    // reference values computed with GeographicLib (Karney's algorithm),
+    // the second one is Karney's example
+    struct Case
+    {
+        units::angle::radian_t lat_1;
+        units::angle::radian_t lon_1;
+        units::angle::radian_t lat_2;
+        units::angle::radian_t lon_2;
+        double distance;
+        double azimuth_1;
+        double azimuth_2;
+    };
+
+    const Case cases[] = {
+        {   0.0_deg, 0.0_deg,   0.5_deg,  179.7_deg,  19944127.420750,  15.556882793,  164.442513891 },
+        { -30.0_deg, 0.0_deg,  29.9_deg,  179.8_deg,  19989832.827610, 161.890524736,   18.090737246 },
+        {   0.0_deg, 0.0_deg,   0.0_deg, -179.5_deg,  19980861.908891, -55.966495140, -124.033504860 },
+        {  45.0_deg, 0.0_deg, -44.95_deg, 179.99_deg, 19998366.970185,   1.151690217,  178.849310271 }
+    };
+
+    for ( const Case& c : cases )
+    {
+        units::length::meter_t distance = 0.0_m;
+        units::angle::radian_t azimuth_1 = 0.0_rad;
+        units::angle::radian_t azimuth_2 = 0.0_rad;
+        EXPECT_EQ(geodesic.solveInverse(c.lat_1, c.lon_1, c.lat_2, c.lon_2, &distance, &azimuth_1, &azimuth_2),
+                  mc::Result::Success);
+
+        EXPECT_NEAR(distance(), c.distance, LINEAR_POSITION_TOLERANCE);
+        EXPECT_NEAR(azimuth_1(), c.azimuth_1 * M_PI / 180.0, 1.0e-8);
+        EXPECT_NEAR(azimuth_2(), c.azimuth_2 * M_PI / 180.0, 1.0e-8);
+
+        // the same geodesic in the opposite direction
+        EXPECT_EQ(geodesic.solveInverse(c.lat_2, c.lon_2, c.lat_1, c.lon_1, &distance, &azimuth_1, &azimuth_2),
+                  mc::Result::Success);
+
+        EXPECT_NEAR(distance(), c.distance, LINEAR_POSITION_TOLERANCE);
+        EXPECT_NEAR(std::remainder(azimuth_1() - c.azimuth_2 * M_PI / 180.0 - M_PI, 2.0 * M_PI), 0.0, 1.0e-8);
+        EXPECT_NEAR(std::remainder(azimuth_2() - c.azimuth_1 * M_PI / 180.0 - M_PI, 2.0 * M_PI), 0.0, 1.0e-8);
+    }
+}
+
+TEST_F(TestGeodesic, CanDetectNotConvergedInverse)
+{
+    // single iteration is not enough
+    mc::Geodesic geodesic(mc::WGS84::ellipsoid, 1);
+
+    units::length::meter_t distance = 0.0_m;
+    units::angle::radian_t azimuth_1 = 0.0_rad;
+    units::angle::radian_t azimuth_2 = 0.0_rad;
+    EXPECT_EQ(geodesic.solveInverse(0.0_deg, 0.0_deg, 0.5_deg, 179.7_deg, &distance, &azimuth_1, &azimuth_2),
+              mc::Result::Failure);
+
+    EXPECT_TRUE(std::isnan(distance()));
+    EXPECT_TRUE(std::isnan(azimuth_1()));
+    EXPECT_TRUE(std::isnan(azimuth_2()));
+}
+
+TEST_F(TestGeodesic, CanSolveDirect)
+{
+    // Vincenty's example, Flinders Peak to Buninyong
+    mc::Geodesic geodesic(mc::WGS84::ellipsoid);
+
+    units::angle::radian_t lat_2 = 0.0_rad;
+    units::angle::radian_t lon_2 = 0.0_rad;
+    units::angle::radian_t azimuth_2 = 0.0_rad;
+
+    geodesic.solveDirect(getAngle(-37.0, 57.0, 3.72030), getAngle(144.0, 25.0, 29.52440),
+                         getAngle(306.0, 52.0, 5.37), 54972.271_m,
+                         &lat_2, &lon_2, &azimuth_2);
+
+    EXPECT_NEAR(lat_2(), getAngle(-37.0, 39.0, 10.15610)(), 1.0e-8);
+    EXPECT_NEAR(lon_2(), getAngle(143.0, 55.0, 35.38390)(), 1.0e-8);
+    EXPECT_NEAR(azimuth_2(), getAngle(127.0, 10.0, 25.07)() - M_PI, 1.0e-7);
+
+    // across the antimeridian
+    mc::Geo pos_1;
+    pos_1.lon = units::angle::radian_t(M_PI - 0.5);
+    pos_1.alt = 100.0_m;
+    mc::Geo pos_2 = geodesic.solveDirect(pos_1, units::angle::radian_t(M_PI_2), mc::WGS84::ellipsoid.a());
+    EXPECT_NEAR(pos_2.lat(), 0.0, LAT_LON_TOLERANCE);
+    EXPECT_NEAR(pos_2.lon(), -M_PI + 0.5, LAT_LON_TOLERANCE);
+    EXPECT_DOUBLE_EQ(pos_2.alt(), 100.0);
+}
+
+TEST_F(TestGeodesic, CanSolveDirectAndInverseRoundTrip)
+{
+    for ( const mc::Ellipsoid& ellipsoid : { mc::WGS84::ellipsoid, mc::Mars2015::ellipsoid } )
+    {
+        mc::Geodesic geodesic(ellipsoid);
+
+        std::vector<units::angle::radian_t> lat_1;
+        std::vector<units::angle::radian_t> lon_1;
+        std::vector<units::angle::radian_t> lat_2;
+        std::vector<units::angle::radian_t> lon_2;
+        makeRandomGeoPoints(200, 1, &lat_1, &lon_1);
+        makeRandomGeoPoints(200, 2, &lat_2, &lon_2);
+
+        for ( size_t i = 0; i < lat_1.size(); ++i )
+        {
+            units::length::meter_t distance = 0.0_m;
+            units::angle::radian_t azimuth_1 = 0.0_rad;
+            units::angle::radian_t azimuth_2 = 0.0_rad;
+            if ( geodesic.solveInverse(lat_1[i], lon_1[i], lat_2[i], lon_2[i],
+                                       &distance, &azimuth_1, &azimuth_2) != mc::Result::Success )
+            {
+                continue;
+            }
+
+            units::angle::radian_t lat = 0.0_rad;
+            units::angle::radian_t lon = 0.0_rad;
+            units::angle::radian_t azimuth = 0.0_rad;
+            geodesic.solveDirect(lat_1[i], lon_1[i], azimuth_1, distance, &lat, &lon, &azimuth);
+
+            EXPECT_NEAR(lat(), lat_2[i](), LAT_LON_TOLERANCE);
+            EXPECT_NEAR(std::remainder(lon() - lon_2[i](), 2.0 * M_PI), 0.0, LAT_LON_TOLERANCE);
+            EXPECT_NEAR(std::remainder(azimuth() - azimuth_2(), 2.0 * M_PI), 0.0, 1.0e-8);
+        }
+    }
+}
+
+TEST_F(TestGeodesic, CanBoundEllipsoidalDistanceWithSphericalOne)
+{
+    for ( const mc::Ellipsoid& ellipsoid : { mc::WGS84::ellipsoid, mc::Mars2015::ellipsoid } )
+    {
+        mc::Geodesic geodesic(ellipsoid);
+
+        EXPECT_LT(geodesic.sphericalRatioMin(), 1.0);
+        EXPECT_GT(geodesic.sphericalRatioMax(), 1.0);
+
+        std::vector<units::angle::radian_t> lat_1;
+        std::vector<units::angle::radian_t> lon_1;
+        std::vector<units::angle::radian_t> lat_2;
+        std::vector<units::angle::radian_t> lon_2;
+        makeRandomGeoPoints(500, 3, &lat_1, &lon_1);
+        makeRandomGeoPoints(500, 4, &lat_2, &lon_2);
+
+        for ( size_t i = 0; i < lat_1.size(); ++i )
+        {
+            // short distances as well
+            if ( i % 2 ) lat_2[i] = lat_1[i] + units::angle::radian_t(1.0e-3 * (i % 7));
+            if ( i % 3 ) lon_2[i] = lon_1[i] + units::angle::radian_t(1.0e-3 * (i % 5));
+
+            units::length::meter_t distance = 0.0_m;
+            if ( geodesic.solveInverse(lat_1[i], lon_1[i], lat_2[i], lon_2[i], &distance) != mc::Result::Success )
+            {
+                continue;
+            }
+
+            double d_sph = geodesic.getSphericalDistance(lat_1[i], lon_1[i], lat_2[i], lon_2[i])();
+            EXPECT_GE(distance(), geodesic.sphericalRatioMin() * d_sph - LINEAR_POSITION_TOLERANCE);
+            EXPECT_LE(distance(), geodesic.sphericalRatioMax() * d_sph + LINEAR_POSITION_TOLERANCE);
+        }
+    }
+}
+
+TEST_F(TestGeodesic, CanGetDistances)
+{
+    mc::Geodesic geodesic(mc::WGS84::ellipsoid);
+
+    // count not being a multiple of the block size
+    const size_t count = 201;
+
+    std::vector<units::angle::radian_t> lat_1;
+    std::vector<units::angle::radian_t> lon_1;
+    std::vector<units::angle::radian_t> lat_2;
+    std::vector<units::angle::radian_t> lon_2;
+    makeRandomGeoPoints(count, 5, &lat_1, &lon_1);
+    makeRandomGeoPoints(count, 6, &lat_2, &lon_2);
+
+    // nearly antipodal points
+    lat_1[7] = 0.0_deg;
+    lon_1[7] = 0.0_deg;
+    lat_2[7] = 0.5_deg;
+    lon_2[7] = 179.7_deg;
+
+    std::vector<units::length::meter_t> distance(count);
+    std::vector<mc::Result> results(count);
+    EXPECT_EQ(geodesic.getDistances(lat_1, lon_1, lat_2, lon_2, distance, mc::GeodesicMode::Ellipsoidal, results),
+              mc::Result::Success);
+
+    std::vector<units::length::meter_t> distance_sph(count);
+    EXPECT_EQ(geodesic.getDistances(lat_1, lon_1, lat_2, lon_2, distance_sph, mc::GeodesicMode::Spherical),
+              mc::Result::Success);
+
+    for ( size_t i = 0; i < count; ++i )
+    {
+        units::length::meter_t distance_ref = 0.0_m;
+        mc::Result result = geodesic.solveInverse(lat_1[i], lon_1[i], lat_2[i], lon_2[i], &distance_ref);
+
+        EXPECT_EQ(results[i], result);
+        EXPECT_EQ(results[i], mc::Result::Success);
+        EXPECT_DOUBLE_EQ(distance[i](), distance_ref());
+
+        double d_sph = geodesic.getSphericalDistance(lat_1[i], lon_1[i], lat_2[i], lon_2[i])();
+        EXPECT_NEAR(distance_sph[i](), d_sph, 1.0e-6);
+    }
+
+    // reference value computed with GeographicLib
+    EXPECT_NEAR(distance[7](), 19944127.420750, LINEAR_POSITION_TOLERANCE);
+
+    // distances are NaN if not converged
+    mc::Geodesic geodesic_1(mc::WGS84::ellipsoid, 1);
+    EXPECT_EQ(geodesic_1.getDistances(lat_1, lon_1, lat_2, lon_2, distance, mc::GeodesicMode::Ellipsoidal, results),
+              mc::Result::Failure);
+    EXPECT_EQ(results[7], mc::Result::Failure);
+    EXPECT_TRUE(std::isnan(distance[7]()));
+}
+
+TEST_F(TestGeodesic, CanFindWithinDistance)
+{
+    mc::Geodesic geodesic(mc::WGS84::ellipsoid);
+
+    std::vector<units::angle::radian_t> lat;
+    std::vector<units::angle::radian_t> lon;
+    makeRandomGeoPoints(2000, 7, &lat, &lon);
+
+    const units::angle::radian_t lat_0 = 52.0_deg;
+    const units::angle::radian_t lon_0 = 21.0_deg;
+
+    for ( units::length::meter_t range : { 0.0_m, 1.0e6_m, 5.0e6_m, 1.5e7_m, 2.1e7_m } )
+    {
+        std::vector<size_t> indices;
+        const size_t found = geodesic.findWithinDistance(lat_0, lon_0, range, lat, lon, &indices);
+        EXPECT_EQ(found, indices.size());
+
+        std::vector<size_t> indices_ref;
+        for ( size_t i = 0; i < lat.size(); ++i )
+        {
+            units::length::meter_t distance = 0.0_m;
+            EXPECT_EQ(geodesic.solveInverse(lat_0, lon_0, lat[i], lon[i], &distance), mc::Result::Success);
+            if ( distance <= range ) indices_ref.push_back(i);
+        }
+
+        EXPECT_EQ(indices, indices_ref) << "range= " << range();
+    }
+}
+
+TEST_F(TestGeodesic, CanFindNothingWithinNegativeDistance)
+{
+    mc::Geodesic geodesic(mc::WGS84::ellipsoid);
+
+    std::vector<units::angle::radian_t> lat;
+    std::vector<units::angle::radian_t> lon;
+    makeRandomGeoPoints(200, 8, &lat, &lon);
+
+    // center point itself included
+    lat[0] = 52.0_deg;
+    lon[0] = 21.0_deg;
+
+    std::vector<size_t> indices = { 1, 2, 3 };
+    EXPECT_EQ(geodesic.findWithinDistance(lat[0], lon[0], -1.0_m, lat, lon, &indices), 0u);
+    EXPECT_TRUE(indices.empty());
+
+    EXPECT_EQ(geodesic.findWithinDistance(lat[0], lon[0], -1.5e7_m, lat, lon, &indices), 0u);
+    EXPECT_TRUE(indices.empty());
+}
@@ -0,0 +1,269 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <mcutils/geo/LocalTangentPlane.h>
+
+#include <mcutils/geo/WGS84.h>
+
+#include <geo/GeoPoints.h>
+
+// linear position tolerance (0.1 mm)
+#define LINEAR_POSITION_TOLERANCE 1.0e-4
+// latitude and longitude tolerance (10^-9 rad ~ ca. 6 mm)
+#define LAT_LON_TOLERANCE 1.0e-9
+
+class TestLocalTangentPlane : public ::testing::Test
+{
+protected:
+    TestLocalTangentPlane() {}
+    virtual ~TestLocalTangentPlane() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static mc::Geo getOrigin()
+    {
+        mc::Geo origin;
+        origin.lat = 52.0_deg;
+        origin.lon = 21.0_deg;
+        origin.alt = 100.0_m;
+        return origin;
+    }
+
+    // points within 100 km from the origin and altitudes up to 10 km
+    static void makeGeoPoints(size_t count,
+                              std::vector<units::angle::radian_t>* lat,
+                              std::vector<units::angle::radian_t>* lon,
+                              std::vector<units::length::meter_t>* alt)
+    {
+        const mc::Geo origin = getOrigin();
+        ::makeGeoPoints(count,
+                        origin.lat - 0.015_rad, origin.lat + 0.015_rad,
+                        origin.lon - 0.025_rad, origin.lon + 0.025_rad,
+                        0.0_m, 10000.0_m,
+                        lat, lon, alt);
+    }
+};
+
+TEST_F(TestLocalTangentPlane, CanInstantiate)
+{
+    mc::LocalTangentPlane ltp(mc::WGS84::ellipsoid);
+
+    EXPECT_DOUBLE_EQ(ltp.origin_geo().lat(), 0.0);
+    EXPECT_DOUBLE_EQ(ltp.origin_geo().lon(), 0.0);
+    EXPECT_DOUBLE_EQ(ltp.origin_geo().alt(), 0.0);
+
+    EXPECT_NEAR(ltp.origin_cart().x()(), mc::WGS84::ellipsoid.a()(), LINEAR_POSITION_TOLERANCE);
+    EXPECT_NEAR(ltp.origin_cart().y()(), 0.0, LINEAR_POSITION_TOLERANCE);
+    EXPECT_NEAR(ltp.origin_cart().z()(), 0.0, LINEAR_POSITION_TOLERANCE);
+}
+
+TEST_F(TestLocalTangentPlane, CanSetOrigin)
+{
+    mc::LocalTangentPlane ltp(mc::WGS84::ellipsoid);
+    ltp.setOrigin(getOrigin());
+
+    mc::ECEF ecef(mc::WGS84::ellipsoid);
+    ecef.setPosition(getOrigin());
+
+    EXPECT_NEAR(ltp.origin_cart().x()(), ecef.pos_cart().x()(), LINEAR_POSITION_TOLERANCE);
+    EXPECT_NEAR(ltp.origin_cart().y()(), ecef.pos_cart().y()(), LINEAR_POSITION_TOLERANCE);
+    EXPECT_NEAR(ltp.origin_cart().z()(), ecef.pos_cart().z()(), LINEAR_POSITION_TOLERANCE);
+
+    mc::LocalTangentPlane ltp_cart(mc::WGS84::ellipsoid);
+    ltp_cart.setOrigin(ecef.pos_cart());
+
+    EXPECT_NEAR(ltp_cart.origin_geo().lat(), getOrigin().lat(), LAT_LON_TOLERANCE);
+    EXPECT_NEAR(ltp_cart.origin_geo().lon(), getOrigin().lon(), LAT_LON_TOLERANCE);
+    EXPECT_NEAR(ltp_cart.origin_geo().alt(), getOrigin().alt(), LINEAR_POSITION_TOLERANCE);
+}
+
+TEST_F(TestLocalTangentPlane, CanConvertGeo2NED)
+{
+    mc::LocalTangentPlane ltp(mc::WGS84::ellipsoid, getOrigin());
+
+    // origin itself
+    mc::Vector3_m pos_ned = ltp.convertGeo2NED(getOrigin());
+    EXPECT_NEAR(pos_ned.x()(), 0.0, LINEAR_POSITION_TOLERANCE);
+    EXPECT_NEAR(pos_ned.y()(), 0.0, LINEAR_POSITION_TOLERANCE);
+    EXPECT_NEAR(pos_ned.z()(), 0.0, LINEAR_POSITION_TOLERANCE);
+
+    // straight above the origin
+    mc::Geo above = getOrigin();
+    above.alt += 1000.0_m;
+    pos_ned = ltp.convertGeo2NED(above);
+    EXPECT_NEAR(pos_ned.x()(),     0.0, LINEAR_POSITION_TOLERANCE);
+    EXPECT_NEAR(pos_ned.y()(),     0.0, LINEAR_POSITION_TOLERANCE);
+    EXPECT_NEAR(pos_ned.z()(), -1000.0, LINEAR_POSITION_TOLERANCE);
+
+    // the same as chaining ECEF conversion, subtraction and rotation
+    mc::ECEF ecef(mc::WGS84::ellipsoid);
+    ecef.setPosition(getOrigin());
+
+    std::vector<units::angle::radian_t> lat;
+    std::vector<units::angle::radian_t> lon;
+    std::vector<units::length::meter_t> alt;
+    makeGeoPoints(50, &lat, &lon, &alt);
+
+    for ( size_t i = 0; i < lat.size(); ++i )
+    {
+        mc::Geo pos_geo;
+        pos_geo.lat = lat[i];
+        pos_geo.lon = lon[i];
+        pos_geo.alt = alt[i];
+
+        pos_ned = ltp.convertGeo2NED(pos_geo);
+        mc::Vector3_m pos_ned_ref = ecef.ecef2ned() * (ecef.convertGeo2Cart(pos_geo) - ecef.pos_cart());
+
+        EXPECT_NEAR(pos_ned.x()(), pos_ned_ref.x()(), LINEAR_POSITION_TOLERANCE);
+        EXPECT_NEAR(pos_ned.y()(), pos_ned_ref.y()(), LINEAR_POSITION_TOLERANCE);
+        EXPECT_NEAR(pos_ned.z()(), pos_ned_ref.z()(), LINEAR_POSITION_TOLERANCE);
+    }
+}
+
+TEST_F(TestLocalTangentPlane, CanConvertNED2Geo)
+{
+    mc::LocalTangentPlane ltp(mc::WGS84::ellipsoid, getOrigin());
+
+    mc::Geo pos_geo = ltp.convertNED2Geo(mc::Vector3_m(0.0_m, 0.0_m, -1000.0_m));
+    EXPECT_NEAR(pos_geo.lat(), getOrigin().lat(), LAT_LON_TOLERANCE);
+    EXPECT_NEAR(pos_geo.lon(), getOrigin().lon(), LAT_LON_TOLERANCE);
+    EXPECT_NEAR(pos_geo.alt(), getOrigin().alt() + 1000.0, LINEAR_POSITION_TOLERANCE);
+
+    // round trip
+    std::vector<units::angle::radian_t> lat;
+    std::vector<units::angle::radian_t> lon;
+    std::vector<units::length::meter_t> alt;
+    makeGeoPoints(50, &lat, &lon, &alt);
+
+    for ( size_t i = 0; i < lat.size(); ++i )
+    {
+        mc::Geo pos_geo_ref;
+        pos_geo_ref.lat = lat[i];
+        pos_geo_ref.lon = lon[i];
+        pos_geo_ref.alt = alt[i];
+
+        pos_geo = ltp.convertNED2Geo(ltp.convertGeo2NED(pos_geo_ref));
+
+        EXPECT_NEAR(pos_geo.lat(), pos_geo_ref.lat(), LAT_LON_TOLERANCE);
+        EXPECT_NEAR(pos_geo.lon(), pos_geo_ref.lon(), LAT_LON_TOLERANCE);
+        EXPECT_NEAR(pos_geo.alt(), pos_geo_ref.alt(), LINEAR_POSITION_TOLERANCE);
+    }
+}
+
+TEST_F(TestLocalTangentPlane, CanConvertECEF2ENU)
+{
+    mc::LocalTangentPlane ltp(mc::WGS84::ellipsoid, getOrigin());
+
+    mc::ECEF ecef(mc::WGS84::ellipsoid);
+    ecef.setPosition(getOrigin());
+
+    mc::Geo pos_geo = getOrigin();
+    pos_geo.lat += 0.01_rad;
+    pos_geo.lon -= 0.02_rad;
+    pos_geo.alt += 5000.0_m;
+    mc::Vector3_m pos_cart = ecef.convertGeo2Cart(pos_geo);
+
+    mc::Vector3_m pos_enu = ltp.convertECEF2ENU(pos_cart);
+    mc::Vector3_m pos_enu_ref = ecef.ecef2enu() * (pos_cart - ecef.pos_cart());
+
+    EXPECT_NEAR(pos_enu.x()(), pos_enu_ref.x()(), LINEAR_POSITION_TOLERANCE);
+    EXPECT_NEAR(pos_enu.y()(), pos_enu_ref.y()(), LINEAR_POSITION_TOLERANCE);
+    EXPECT_NEAR(pos_enu.z()(), pos_enu_ref.z()(), LINEAR_POSITION_TOLERANCE);
+
+    // north-west and above
+    EXPECT_LT(pos_enu.x()(), 0.0);
+    EXPECT_GT(pos_enu.y()(), 0.0);
+}
+
+TEST_F(TestLocalTangentPlane, CanConvertGeo2NEDBatch)
+{
+    mc::LocalTangentPlane ltp(mc::WGS84::ellipsoid, getOrigin());
+
+    for ( unsigned int threads : { 1, 3 } )
+    {
+        // count not being a multiple of the block size
+        const size_t count = 1001;
+
+        std::vector<units::angle::radian_t> lat;
+        std::vector<units::angle::radian_t> lon;
+        std::vector<units::length::meter_t> alt;
+        makeGeoPoints(count, &lat, &lon, &alt);
+
+        std::vector<units::length::meter_t> n(count);
+        std::vector<units::length::meter_t> e(count);
+        std::vector<units::length::meter_t> d(count);
+        ltp.convertGeo2NED(lat, lon, alt, n, e, d, threads);
+
+        std::vector<units::angle::radian_t> lat_1(count);
+        std::vector<units::angle::radian_t> lon_1(count);
+        std::vector<units::length::meter_t> alt_1(count);
+        ltp.convertNED2Geo(n, e, d, lat_1, lon_1, alt_1, threads);
+
+        for ( size_t i = 0; i < count; ++i )
+        {
+            mc::Geo pos_geo;
+            pos_geo.lat = lat[i];
+            pos_geo.lon = lon[i];
+            pos_geo.alt = alt[i];
+            mc::Vector3_m pos_ned = ltp.convertGeo2NED(pos_geo);
+
+            EXPECT_NEAR(n[i](), pos_ned.x()(), LINEAR_POSITION_TOLERANCE);
+            EXPECT_NEAR(e[i](), pos_ned.y()(), LINEAR_POSITION_TOLERANCE);
+            EXPECT_NEAR(d[i](), pos_ned.z()(), LINEAR_POSITION_TOLERANCE);
+
+            EXPECT_NEAR(lat_1[i](), lat[i](), LAT_LON_TOLERANCE);
+            EXPECT_NEAR(lon_1[i](), lon[i](), LAT_LON_TOLERANCE);
+            EXPECT_NEAR(alt_1[i](), alt[i](), LINEAR_POSITION_TOLERANCE);
+        }
+    }
+}
+
+TEST_F(TestLocalTangentPlane, CanConvertECEF2ENUBatch)
+{
+    mc::LocalTangentPlane ltp(mc::WGS84::ellipsoid, getOrigin());
+
+    const size_t count = 77;
+
+    std::vector<units::angle::radian_t> lat;
+    std::vector<units::angle::radian_t> lon;
+    std::vector<units::length::meter_t> alt;
+    makeGeoPoints(count, &lat, &lon, &alt);
+
+    std::vector<units::length::meter_t> x(count);
+    std::vector<units::length::meter_t> y(count);
+    std::vector<units::length::meter_t> z(count);
+    ltp.ecef().convertGeo2Cart(lat, lon, alt, x, y, z);
+
+    std::vector<units::length::meter_t> e(count);
+    std::vector<units::length::meter_t> n(count);
+    std::vector<units::length::meter_t> u(count);
+    ltp.convertECEF2ENU(x, y, z, e, n, u);
+
+    for ( size_t i = 0; i < count; ++i )
+    {
+        mc::Vector3_m pos_enu = ltp.convertECEF2ENU(mc::Vector3_m(x[i], y[i], z[i]));
+
+        EXPECT_NEAR(e[i](), pos_enu.x()(), LINEAR_POSITION_TOLERANCE);
+        EXPECT_NEAR(n[i](), pos_enu.y()(), LINEAR_POSITION_TOLERANCE);
+        EXPECT_NEAR(u[i](), pos_enu.z()(), LINEAR_POSITION_TOLERANCE);
+    }
+}
+
+TEST_F(TestLocalTangentPlane, CanConvertEmptyBatch)
+{
+    mc::LocalTangentPlane ltp(mc::WGS84::ellipsoid, getOrigin());
+
+    std::vector<units::angle::radian_t> lat;
+    std::vector<units::angle::radian_t> lon;
+    std::vector<units::length::meter_t> alt;
+    std::vector<units::length::meter_t> n;
+    std::vector<units::length::meter_t> e;
+    std::vector<units::length::meter_t> d;
+
+    ltp.convertGeo2NED(lat, lon, alt, n, e, d, 4);
+    ltp.convertNED2Geo(n, e, d, lat, lon, alt, 4);
+    ltp.convertECEF2ENU(n, e, d, n, e, d);
+
+    EXPECT_TRUE(n.empty());
+}
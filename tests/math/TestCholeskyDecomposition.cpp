@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <mcutils/math/CholeskyDecomposition.h>
+
+class TestCholeskyDecomposition : public ::testing::Test
+{
+protected:
+    TestCholeskyDecomposition() {}
+    virtual ~TestCholeskyDecomposition() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestCholeskyDecomposition, CanInstantiate)
+{
+    mc::CholeskyDecomposition<double, 3> ch;
+    EXPECT_FALSE(ch.isValid());
+}
+
+TEST_F(TestCholeskyDecomposition, CanDecompose)
+{
+    // https://en.wikipedia.org/wiki/Cholesky_decomposition#Example
+    mc::MatrixNxN<double, 3> m;
+    m(0,0) =   4.0;
+    m(0,1) =  12.0;
+    m(0,2) = -16.0;
+
+    m(1,0) =  12.0;
+    m(1,1) =  37.0;
+    m(1,2) = -43.0;
+
+    m(2,0) = -16.0;
+    m(2,1) = -43.0;
+    m(2,2) =  98.0;
+
+    mc::CholeskyDecomposition<double, 3> ch(m);
+    EXPECT_TRUE(ch.isValid());
+
+    const mc::MatrixNxN<double, 3>& l = ch.getL();
+    EXPECT_NEAR(l(0,0),  2.0, 1.0e-12);
+    EXPECT_NEAR(l(0,1),  0.0, 1.0e-12);
+    EXPECT_NEAR(l(0,2),  0.0, 1.0e-12);
+    EXPECT_NEAR(l(1,0),  6.0, 1.0e-12);
+    EXPECT_NEAR(l(1,1),  1.0, 1.0e-12);
+    EXPECT_NEAR(l(1,2),  0.0, 1.0e-12);
+    EXPECT_NEAR(l(2,0), -8.0, 1.0e-12);
+    EXPECT_NEAR(l(2,1),  5.0, 1.0e-12);
+    EXPECT_NEAR(l(2,2),  3.0, 1.0e-12);
+
+    EXPECT_NEAR(ch.getDeterminant(), 36.0, 1.0e-9);
+}
+
+TEST_F(TestCholeskyDecomposition, CanSolve)
+{
+    mc::MatrixNxN<double, 3> m;
+    m(0,0) =   4.0;
+    m(0,1) =  12.0;
+    m(0,2) = -16.0;
+
+    m(1,0) =  12.0;
+    m(1,1) =  37.0;
+    m(1,2) = -43.0;
+
+    m(2,0) = -16.0;
+    m(2,1) = -43.0;
+    m(2,2) =  98.0;
+
+    mc::CholeskyDecomposition<double, 3> ch(m);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        mc::VectorN<double, 3> x_ref;
+        x_ref(0) = 1.0 * i;
+        x_ref(1) = 2.0 - i;
+        x_ref(2) = 0.5 * i + 1.0;
+
+        mc::VectorN<double, 3> x;
+        EXPECT_EQ(ch.solve(m * x_ref, &x), mc::Result::Success);
+
+        EXPECT_NEAR(x(0), x_ref(0), 1.0e-9);
+        EXPECT_NEAR(x(1), x_ref(1), 1.0e-9);
+        EXPECT_NEAR(x(2), x_ref(2), 1.0e-9);
+    }
+}
+
+TEST_F(TestCholeskyDecomposition, CanGetInverse)
+{
+    mc::MatrixNxN<double, 3> m;
+    m(0,0) =   4.0;
+    m(0,1) =  12.0;
+    m(0,2) = -16.0;
+
+    m(1,0) =  12.0;
+    m(1,1) =  37.0;
+    m(1,2) = -43.0;
+
+    m(2,0) = -16.0;
+    m(2,1) = -43.0;
+    m(2,2) =  98.0;
+
+    mc::MatrixNxN<double, 3> inv;
+    mc::CholeskyDecomposition<double, 3> ch(m);
+    EXPECT_EQ(ch.getInverse(&inv), mc::Result::Success);
+
+    mc::MatrixNxN<double, 3> p = m * inv;
+    for (unsigned int r = 0; r < 3; ++r)
+    {
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            EXPECT_NEAR(p(r,c), r == c ? 1.0 : 0.0, 1.0e-9);
+        }
+    }
+}
+
+TEST_F(TestCholeskyDecomposition, CanDetectNotPositiveDefiniteMatrix)
+{
+    mc::MatrixNxN<double, 2> m;
+    m(0,0) = 1.0;
+    m(0,1) = 2.0;
+    m(1,0) = 2.0;
+    m(1,1) = 1.0;
+
+    mc::CholeskyDecomposition<double, 2> ch;
+    EXPECT_EQ(ch.decompose(m), mc::Result::Failure);
+    EXPECT_FALSE(ch.isValid());
+
+    mc::VectorN<double, 2> x;
+    EXPECT_EQ(ch.solve(mc::VectorN<double, 2>(), &x), mc::Result::Failure);
+}
@@ -57,3 +57,49 @@ TEST_F(TestEulerRect, CanSetDerivFun)
     } ));
     EXPECT_TRUE(static_cast<bool>(er.fun()));
 }
+
+TEST_F(TestEulerRect, CanSolveWithTemplatedDerivFun)
+{
+    // mass-spring-damper, see DiffEquationSolver
+    const double k = 1.0;
+    const double c = 1.0;
+    auto deriv = [k, c](const mc::Vector3d& state)
+    {
+        mc::Vector3d result;
+        result(0) = state(1);
+        result(1) = -k * state(0) - c * state(1);
+        return result;
+    };
+
+    mc::EulerRect<mc::Vector3d, double> er1;
+    er1.setFun(deriv);
+
+    mc::EulerRect<mc::Vector3d, double, decltype(deriv)> er2(deriv);
+
+    mc::Vector3d s1(1.0, 0.0, 0.0);
+    mc::Vector3d s2(1.0, 0.0, 0.0);
+    for (int i = 0; i < 100; ++i)
+    {
+        s1 = er1.integrate(0.01, s1);
+        er2.integrate(0.01, &s2);
+    }
+
+    EXPECT_DOUBLE_EQ(s2.x(), s1.x());
+    EXPECT_DOUBLE_EQ(s2.y(), s1.y());
+    EXPECT_DOUBLE_EQ(s2.z(), s1.z());
+}
+
+TEST_F(TestEulerRect, CanIntegrateWithDerivFunWritingResult)
+{
+    // dy/dx = 2, y(0) = 1
+    auto deriv = [](const double&, double* dy) { *dy = 2.0; };
+    mc::EulerRect<double, double, decltype(deriv)> er(deriv);
+
+    double y = 1.0;
+    for (int i = 0; i < 10; ++i)
+    {
+        er.integrate(0.1, &y);
+    }
+
+    EXPECT_NEAR(y, 3.0, 1.0e-9);
+}
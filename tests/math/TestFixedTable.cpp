@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <units.h>
+
+#include <mcutils/math/FixedTable.h>
+
+using namespace units::literals;
+
+namespace {
+
+// y = x^2 - 1
+constexpr mc::FixedTable<double,double,8> kTable(
+    { -2.0, -1.5, -1.0,  0.0,  0.5,  1.0,  2.0,  3.0 },
+    {  3.0,  1.25, 0.0, -1.0, -0.75, 0.0,  3.0,  8.0 }
+);
+
+} // namespace
+
+class TestFixedTable : public ::testing::Test
+{
+protected:
+    TestFixedTable() {}
+    virtual ~TestFixedTable() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestFixedTable, CanGetValueAtCompileTime)
+{
+    static_assert(kTable.size() == 8);
+    static_assert(kTable.isValid());
+    static_assert(kTable.getValue(-3.0) ==  3.0);
+    static_assert(kTable.getValue(-2.0) ==  3.0);
+    static_assert(kTable.getValue( 0.0) == -1.0);
+    static_assert(kTable.getValue( 1.5) ==  1.5);
+    static_assert(kTable.getValue( 4.0) ==  8.0);
+    static_assert(kTable.getKeyByIndex(3) == 0.0);
+    static_assert(kTable.getValueByIndex(7) == 8.0);
+    static_assert(kTable.getFirstValue() == 3.0);
+    static_assert(kTable.getLastValue() == 8.0);
+
+    constexpr mc::FixedTable tab_deduced({ 0.0, 1.0 }, { 1.0, 3.0 });
+    static_assert(tab_deduced.size() == 2);
+    static_assert(tab_deduced.getValue(0.5) == 2.0);
+
+    constexpr mc::FixedTable tab_invalid({ 0.0, 0.0 }, { 1.0, 3.0 });
+    static_assert(!tab_invalid.isValid());
+
+    EXPECT_TRUE(kTable.isValid());
+}
+
+TEST_F(TestFixedTable, CanGetValueAsTable)
+{
+    std::vector<double> key_values { -2.0, -1.5, -1.0,  0.0,  0.5,  1.0,  2.0,  3.0 };
+    std::vector<double> table_data {  3.0,  1.25, 0.0, -1.0, -0.75, 0.0,  3.0,  8.0 };
+
+    mc::Table<double,double> tab(key_values, table_data);
+
+    for (double x = -3.0; x <= 4.0; x += 0.05)
+    {
+        EXPECT_DOUBLE_EQ(kTable.getValue(x), tab.getValue(x)) << "x= " << x;
+    }
+
+    EXPECT_TRUE(std::isnan(kTable.getKeyByIndex(8)));
+    EXPECT_TRUE(std::isnan(kTable.getValueByIndex(8)));
+}
+
+TEST_F(TestFixedTable, CanConvertToTable)
+{
+    mc::Table<double,double> tab = kTable.toTable();
+
+    EXPECT_EQ(tab.size(), 8);
+    EXPECT_TRUE(tab.isValid());
+
+    for (double x = -3.0; x <= 4.0; x += 0.05)
+    {
+        EXPECT_DOUBLE_EQ(tab.getValue(x), kTable.getValue(x)) << "x= " << x;
+    }
+
+    // table copies records only when modified
+    tab.multiplyValues(2.0);
+    EXPECT_DOUBLE_EQ(tab.getValue(1.5), 3.0);
+    EXPECT_DOUBLE_EQ(kTable.getValue(1.5), 1.5);
+}
+
+TEST_F(TestFixedTable, CanGetValueWithUnits)
+{
+    const mc::FixedTable<units::length::meter_t,units::velocity::meters_per_second_t,3> tab(
+        { 0.0_m, 1.0_m, 2.0_m },
+        { 0.0_mps, 2.0_mps, 6.0_mps }
+    );
+
+    EXPECT_TRUE(tab.isValid());
+    EXPECT_DOUBLE_EQ(tab.getValue(0.5_m)(), 1.0);
+    EXPECT_DOUBLE_EQ(tab.getValue(1.5_m)(), 4.0);
+    EXPECT_DOUBLE_EQ(tab.getValue(3.0_m)(), 6.0);
+}
@@ -115,3 +115,33 @@ TEST_F(TestGaussJordan, CanSolveWithZerosAtDiagonal)
     EXPECT_NEAR(x(1), 1.0, 1.0e-9);
     EXPECT_NEAR(x(2), 2.0, 1.0e-9);
 }
+
+TEST_F(TestGaussJordan, CanSolveDynamicSize)
+{
+    // x = 1
+    // y = 1
+    // z = 2
+    //      y + z = 3
+    //  x     + z = 3
+    //  x + y     = 2
+
+    mc::MatrixX<double> m(3, 3);
+    m.setFromStdVector({
+        0.0, 1.0, 1.0,
+        1.0, 0.0, 1.0,
+        1.0, 1.0, 0.0
+    });
+
+    mc::VectorX<double> rhs(std::vector<double>{ 3.0, 3.0, 2.0 });
+
+    mc::VectorX<double> x;
+    EXPECT_EQ(mc::solveGaussJordan(m, rhs, &x), mc::Result::Success);
+
+    ASSERT_EQ(x.size(), 3);
+    EXPECT_NEAR(x(0), 1.0, 1.0e-9);
+    EXPECT_NEAR(x(1), 1.0, 1.0e-9);
+    EXPECT_NEAR(x(2), 2.0, 1.0e-9);
+
+    mc::MatrixX<double> m_not_square(2, 3);
+    EXPECT_EQ(mc::solveGaussJordan(m_not_square, rhs, &x), mc::Result::Failure);
+}
@@ -0,0 +1,216 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include <mcutils/math/GaussJordan.h>
+#include <mcutils/math/GaussJordanBatch.h>
+
+class TestGaussJordanBatch : public ::testing::Test
+{
+protected:
+    TestGaussJordanBatch() {}
+    virtual ~TestGaussJordanBatch() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    template <unsigned int SIZE>
+    static void makeSystems(unsigned int count, unsigned int seed,
+                            std::vector<mc::MatrixNxN<double, SIZE>>* mtr,
+                            std::vector<mc::VectorN<double, SIZE>>* rhs)
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+        mtr->resize(count);
+        rhs->resize(count);
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            for (unsigned int r = 0; r < SIZE; ++r)
+            {
+                for (unsigned int c = 0; c < SIZE; ++c)
+                {
+                    (*mtr)[i](r,c) = dist(gen) + (r == c ? 2.0 : 0.0);
+                }
+                (*rhs)[i](r) = dist(gen);
+            }
+        }
+    }
+
+    template <unsigned int SIZE>
+    static void checkBatch(unsigned int count, unsigned int threads)
+    {
+        std::vector<mc::MatrixNxN<double, SIZE>> mtr;
+        std::vector<mc::VectorN<double, SIZE>> rhs;
+        makeSystems<SIZE>(count, SIZE, &mtr, &rhs);
+
+        std::vector<mc::VectorN<double, SIZE>> x(count);
+        std::vector<mc::Result> results(count, mc::Result::Failure);
+        EXPECT_EQ(mc::solveGaussJordanBatch(mtr.data(), rhs.data(), x.data(), count,
+                                            results.data(), 1.0e-9, threads),
+                  mc::Result::Success);
+
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            mc::VectorN<double, SIZE> x_ref;
+            mc::solveGaussJordan(mtr[i], rhs[i], &x_ref);
+
+            EXPECT_EQ(results[i], mc::Result::Success);
+            for (unsigned int r = 0; r < SIZE; ++r)
+            {
+                EXPECT_NEAR(x[i](r), x_ref(r), 1.0e-9);
+            }
+        }
+    }
+};
+
+TEST_F(TestGaussJordanBatch, CanSolve)
+{
+    // x = 1
+    // y = 1
+    // z = 2
+    //  x +  y + z = 4
+    // 2x +  y + z = 5
+    // 2x + 2y + z = 6
+
+    mc::MatrixNxN<double, 3> m;
+    m(0,0) = 1.0;
+    m(0,1) = 1.0;
+    m(0,2) = 1.0;
+
+    m(1,0) = 2.0;
+    m(1,1) = 1.0;
+    m(1,2) = 1.0;
+
+    m(2,0) = 2.0;
+    m(2,1) = 2.0;
+    m(2,2) = 1.0;
+
+    mc::VectorN<double, 3> rhs;
+    rhs(0) = 4.0;
+    rhs(1) = 5.0;
+    rhs(2) = 6.0;
+
+    mc::VectorN<double, 3> x;
+    EXPECT_EQ(mc::solveGaussJordanBatch(&m, &rhs, &x, 1), mc::Result::Success);
+
+    EXPECT_NEAR(x(0), 1.0, 1.0e-9);
+    EXPECT_NEAR(x(1), 1.0, 1.0e-9);
+    EXPECT_NEAR(x(2), 2.0, 1.0e-9);
+}
+
+TEST_F(TestGaussJordanBatch, CanSolveWithZerosAtDiagonal)
+{
+    // x = 1
+    // y = 1
+    // z = 2
+    //      y + z = 3
+    //  x     + z = 3
+    //  x + y     = 2
+
+    mc::MatrixNxN<double, 3> m;
+    m(0,0) = 0.0;
+    m(0,1) = 1.0;
+    m(0,2) = 1.0;
+
+    m(1,0) = 1.0;
+    m(1,1) = 0.0;
+    m(1,2) = 1.0;
+
+    m(2,0) = 1.0;
+    m(2,1) = 1.0;
+    m(2,2) = 0.0;
+
+    mc::VectorN<double, 3> rhs;
+    rhs(0) = 3.0;
+    rhs(1) = 3.0;
+    rhs(2) = 2.0;
+
+    mc::VectorN<double, 3> x;
+    EXPECT_EQ(mc::solveGaussJordanBatch(&m, &rhs, &x, 1), mc::Result::Success);
+
+    EXPECT_NEAR(x(0), 1.0, 1.0e-9);
+    EXPECT_NEAR(x(1), 1.0, 1.0e-9);
+    EXPECT_NEAR(x(2), 2.0, 1.0e-9);
+}
+
+TEST_F(TestGaussJordanBatch, CanSolveMany)
+{
+    // counts not being multiples of the block size
+    checkBatch<3>(37, 1);
+    checkBatch<4>(8, 1);
+    checkBatch<5>(3, 1);
+    checkBatch<6>(100, 1);
+}
+
+TEST_F(TestGaussJordanBatch, CanSolveManyMultithreaded)
+{
+    checkBatch<3>(1001, 4);
+    checkBatch<6>(250, 3);
+
+    // more threads than blocks
+    checkBatch<4>(10, 8);
+}
+
+TEST_F(TestGaussJordanBatch, CanSolveStdVector)
+{
+    std::vector<mc::MatrixNxN<double, 4>> mtr;
+    std::vector<mc::VectorN<double, 4>> rhs;
+    makeSystems<4>(20, 1, &mtr, &rhs);
+
+    std::vector<mc::VectorN<double, 4>> x;
+    std::vector<mc::Result> results;
+    EXPECT_EQ(mc::solveGaussJordanBatch(mtr, rhs, &x, &results), mc::Result::Success);
+
+    ASSERT_EQ(x.size(), 20);
+    ASSERT_EQ(results.size(), 20);
+    for (unsigned int i = 0; i < x.size(); ++i)
+    {
+        mc::VectorN<double, 4> x_ref;
+        mc::solveGaussJordan(mtr[i], rhs[i], &x_ref);
+        for (unsigned int r = 0; r < 4; ++r)
+        {
+            EXPECT_NEAR(x[i](r), x_ref(r), 1.0e-9);
+        }
+    }
+
+    rhs.pop_back();
+    EXPECT_EQ(mc::solveGaussJordanBatch(mtr, rhs, &x), mc::Result::Failure);
+}
+
+TEST_F(TestGaussJordanBatch, CanDetectSingularSystems)
+{
+    std::vector<mc::MatrixNxN<double, 3>> mtr;
+    std::vector<mc::VectorN<double, 3>> rhs;
+    makeSystems<3>(11, 2, &mtr, &rhs);
+
+    // rows 0 and 2 linearly dependent
+    for (unsigned int c = 0; c < 3; ++c)
+    {
+        mtr[5](2,c) = 2.0 * mtr[5](0,c);
+    }
+
+    std::vector<mc::VectorN<double, 3>> x;
+    std::vector<mc::Result> results;
+    EXPECT_EQ(mc::solveGaussJordanBatch(mtr, rhs, &x, &results), mc::Result::Failure);
+
+    ASSERT_EQ(results.size(), 11);
+    for (unsigned int i = 0; i < results.size(); ++i)
+    {
+        EXPECT_EQ(results[i], i == 5 ? mc::Result::Failure : mc::Result::Success);
+    }
+
+    // systems solved together with the singular one are not affected
+    for (unsigned int i = 0; i < results.size(); ++i)
+    {
+        if (i != 5)
+        {
+            mc::VectorN<double, 3> x_ref;
+            mc::solveGaussJordan(mtr[i], rhs[i], &x_ref);
+            for (unsigned int r = 0; r < 3; ++r)
+            {
+                EXPECT_NEAR(x[i](r), x_ref(r), 1.0e-9);
+            }
+        }
+    }
+}
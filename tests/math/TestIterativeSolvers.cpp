@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include <mcutils/math/GaussJordan.h>
+#include <mcutils/math/IterativeSolvers.h>
+
+class TestIterativeSolvers : public ::testing::Test
+{
+protected:
+    TestIterativeSolvers() {}
+    virtual ~TestIterativeSolvers() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    // 2D Poisson problem 5-point stencil on k x k grid, symmetric positive-definite
+    static mc::SparseMatrixCSR<double> makeLaplacian(unsigned int k)
+    {
+        const unsigned int n = k * k;
+        std::vector<mc::SparseEntry<double>> entries;
+        for (unsigned int i = 0; i < k; ++i)
+        {
+            for (unsigned int j = 0; j < k; ++j)
+            {
+                const unsigned int row = i * k + j;
+                entries.push_back({ row, row, 4.0 });
+                if (i > 0)     entries.push_back({ row, row - k, -1.0 });
+                if (i < k - 1) entries.push_back({ row, row + k, -1.0 });
+                if (j > 0)     entries.push_back({ row, row - 1, -1.0 });
+                if (j < k - 1) entries.push_back({ row, row + 1, -1.0 });
+            }
+        }
+        return mc::SparseMatrixCSR<double>(n, n, entries);
+    }
+
+    // 1D convection-diffusion, nonsymmetric
+    static mc::SparseMatrixCSR<double> makeConvectionDiffusion(unsigned int n)
+    {
+        std::vector<mc::SparseEntry<double>> entries;
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            entries.push_back({ i, i, 3.0 });
+            if (i > 0)     entries.push_back({ i, i - 1, -1.5 });
+            if (i < n - 1) entries.push_back({ i, i + 1, -0.5 });
+        }
+        return mc::SparseMatrixCSR<double>(n, n, entries);
+    }
+
+    static mc::VectorX<double> makeRhs(unsigned int n)
+    {
+        mc::VectorX<double> rhs(n);
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            rhs(i) = 1.0 + 0.1 * (i % 7);
+        }
+        return rhs;
+    }
+};
+
+TEST_F(TestIterativeSolvers, CanSolveConjugateGradient)
+{
+    mc::SparseMatrixCSR<double> a = makeLaplacian(8);
+    mc::VectorX<double> b = makeRhs(a.rows());
+
+    mc::VectorX<double> x_ref;
+    EXPECT_EQ(mc::solveGaussJordan(a.getMatrixX(), b, &x_ref), mc::Result::Success);
+
+    mc::VectorX<double> x;
+    unsigned int iterations = 0;
+    EXPECT_EQ(mc::solveConjugateGradient(a, b, &x, 1.0e-12, 1000,
+                                         mc::Preconditioner::Jacobi, &iterations),
+              mc::Result::Success);
+
+    ASSERT_EQ(x.size(), b.size());
+    EXPECT_GT(iterations, 0);
+    EXPECT_LE(iterations, a.rows());
+    for (unsigned int i = 0; i < x.size(); ++i)
+    {
+        EXPECT_NEAR(x(i), x_ref(i), 1.0e-9);
+    }
+}
+
+TEST_F(TestIterativeSolvers, CanSolveConjugateGradientCSC)
+{
+    mc::SparseMatrixCSC<double> a(makeLaplacian(5));
+    mc::VectorX<double> b = makeRhs(a.rows());
+
+    mc::VectorX<double> x;
+    EXPECT_EQ(mc::solveConjugateGradient(a, b, &x, 1.0e-12), mc::Result::Success);
+
+    mc::VectorX<double> r = b - a * x;
+    EXPECT_LT(r.getLength(), 1.0e-10);
+}
+
+TEST_F(TestIterativeSolvers, CanSolveConjugateGradientDense)
+{
+    mc::MatrixX<double> a = makeLaplacian(4).getMatrixX();
+    mc::VectorX<double> b = makeRhs(a.rows());
+
+    mc::VectorX<double> x;
+    EXPECT_EQ(mc::solveConjugateGradient(a, b, &x, 1.0e-12, 1000, mc::Preconditioner::None),
+              mc::Result::Success);
+
+    mc::VectorX<double> r = b - a * x;
+    EXPECT_LT(r.getLength(), 1.0e-10);
+}
+
+TEST_F(TestIterativeSolvers, CanSolveConjugateGradientWithInitialGuess)
+{
+    mc::SparseMatrixCSR<double> a = makeLaplacian(6);
+    mc::VectorX<double> b = makeRhs(a.rows());
+
+    mc::VectorX<double> x;
+    EXPECT_EQ(mc::solveConjugateGradient(a, b, &x, 1.0e-12), mc::Result::Success);
+
+    // starting from the solution should not require any iteration
+    unsigned int iterations = 1;
+    EXPECT_EQ(mc::solveConjugateGradient(a, b, &x, 1.0e-9, 1000,
+                                         mc::Preconditioner::Jacobi, &iterations),
+              mc::Result::Success);
+    EXPECT_EQ(iterations, 0);
+}
+
+TEST_F(TestIterativeSolvers, CanSolveBiCGSTAB)
+{
+    mc::SparseMatrixCSR<double> a = makeConvectionDiffusion(50);
+    mc::VectorX<double> b = makeRhs(a.rows());
+
+    mc::VectorX<double> x_ref;
+    EXPECT_EQ(mc::solveGaussJordan(a.getMatrixX(), b, &x_ref), mc::Result::Success);
+
+    mc::VectorX<double> x;
+    EXPECT_EQ(mc::solveBiCGSTAB(a, b, &x, 1.0e-12), mc::Result::Success);
+
+    ASSERT_EQ(x.size(), b.size());
+    for (unsigned int i = 0; i < x.size(); ++i)
+    {
+        EXPECT_NEAR(x(i), x_ref(i), 1.0e-9);
+    }
+
+    mc::VectorX<double> x_none;
+    EXPECT_EQ(mc::solveBiCGSTAB(a, b, &x_none, 1.0e-12, 1000, mc::Preconditioner::None),
+              mc::Result::Success);
+    for (unsigned int i = 0; i < x_none.size(); ++i)
+    {
+        EXPECT_NEAR(x_none(i), x_ref(i), 1.0e-9);
+    }
+}
+
+TEST_F(TestIterativeSolvers, CanSolveBiCGSTABSymmetric)
+{
+    mc::SparseMatrixCSR<double> a = makeLaplacian(8);
+    mc::VectorX<double> b = makeRhs(a.rows());
+
+    mc::VectorX<double> x;
+    EXPECT_EQ(mc::solveBiCGSTAB(a, b, &x, 1.0e-12), mc::Result::Success);
+
+    mc::VectorX<double> r = b - a * x;
+    EXPECT_LT(r.getLength(), 1.0e-10);
+}
+
+TEST_F(TestIterativeSolvers, CanDetectFailure)
+{
+    mc::SparseMatrixCSR<double> a = makeLaplacian(8);
+    mc::VectorX<double> b = makeRhs(a.rows());
+
+    // not enough iterations
+    mc::VectorX<double> x;
+    EXPECT_EQ(mc::solveConjugateGradient(a, b, &x, 1.0e-12, 2), mc::Result::Failure);
+    EXPECT_EQ(mc::solveBiCGSTAB(a, b, &x, 1.0e-12, 1), mc::Result::Failure);
+
+    // not positive-definite
+    std::vector<mc::SparseEntry<double>> entries = { { 0, 0, -1.0 }, { 1, 1, -2.0 } };
+    mc::SparseMatrixCSR<double> neg(2, 2, entries);
+    mc::VectorX<double> b2(std::vector<double>{ 1.0, 1.0 });
+    EXPECT_EQ(mc::solveConjugateGradient(neg, b2, &x, 1.0e-12, 100, mc::Preconditioner::None),
+              mc::Result::Failure);
+
+    // size mismatch
+    EXPECT_EQ(mc::solveConjugateGradient(a, b2, &x), mc::Result::Failure);
+    EXPECT_EQ(mc::solveBiCGSTAB(a, b2, &x), mc::Result::Failure);
+}
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include <mcutils/math/LUDecomposition.h>
+
+class TestLUDecomposition : public ::testing::Test
+{
+protected:
+    TestLUDecomposition() {}
+    virtual ~TestLUDecomposition() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestLUDecomposition, CanInstantiate)
+{
+    mc::LUDecomposition<double, 3> lu;
+    EXPECT_FALSE(lu.isValid());
+}
+
+TEST_F(TestLUDecomposition, CanSolve)
+{
+    // x = 1
+    // y = 1
+    // z = 2
+    //  x +  y + z = 4
+    // 2x +  y + z = 5
+    // 2x + 2y + z = 6
+
+    mc::MatrixNxN<double, 3> m;
+    m(0,0) = 1.0;
+    m(0,1) = 1.0;
+    m(0,2) = 1.0;
+
+    m(1,0) = 2.0;
+    m(1,1) = 1.0;
+    m(1,2) = 1.0;
+
+    m(2,0) = 2.0;
+    m(2,1) = 2.0;
+    m(2,2) = 1.0;
+
+    mc::VectorN<double, 3> rhs;
+    rhs(0) = 4.0;
+    rhs(1) = 5.0;
+    rhs(2) = 6.0;
+
+    mc::LUDecomposition<double, 3> lu(m);
+    EXPECT_TRUE(lu.isValid());
+
+    mc::VectorN<double, 3> x;
+    EXPECT_EQ(lu.solve(rhs, &x), mc::Result::Success);
+
+    EXPECT_NEAR(x(0), 1.0, 1.0e-9);
+    EXPECT_NEAR(x(1), 1.0, 1.0e-9);
+    EXPECT_NEAR(x(2), 2.0, 1.0e-9);
+}
+
+TEST_F(TestLUDecomposition, CanSolveManyRightHandSides)
+{
+    mc::MatrixNxN<double, 3> m;
+    m(0,0) = 0.0;
+    m(0,1) = 1.0;
+    m(0,2) = 1.0;
+
+    m(1,0) = 1.0;
+    m(1,1) = 0.0;
+    m(1,2) = 1.0;
+
+    m(2,0) = 1.0;
+    m(2,1) = 1.0;
+    m(2,2) = 0.0;
+
+    mc::LUDecomposition<double, 3> lu(m);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        mc::VectorN<double, 3> x_ref;
+        x_ref(0) = 1.0 * i;
+        x_ref(1) = 2.0 - i;
+        x_ref(2) = 0.5 * i + 1.0;
+
+        mc::VectorN<double, 3> x;
+        EXPECT_EQ(lu.solve(m * x_ref, &x), mc::Result::Success);
+
+        EXPECT_NEAR(x(0), x_ref(0), 1.0e-9);
+        EXPECT_NEAR(x(1), x_ref(1), 1.0e-9);
+        EXPECT_NEAR(x(2), x_ref(2), 1.0e-9);
+    }
+}
+
+TEST_F(TestLUDecomposition, CanGetDeterminant)
+{
+    mc::MatrixNxN<double, 3> m;
+    m(0,0) =  2.0;
+    m(0,1) = -3.0;
+    m(0,2) =  1.0;
+
+    m(1,0) =  2.0;
+    m(1,1) =  0.0;
+    m(1,2) = -1.0;
+
+    m(2,0) =  1.0;
+    m(2,1) =  4.0;
+    m(2,2) =  5.0;
+
+    mc::LUDecomposition<double, 3> lu(m);
+    EXPECT_NEAR(lu.getDeterminant(), 49.0, 1.0e-9);
+    EXPECT_NEAR(mc::calculateDeterminant(m), 49.0, 1.0e-9);
+}
+
+TEST_F(TestLUDecomposition, CanGetInverse)
+{
+    mc::MatrixNxN<double, 3> m;
+    m(0,0) =  2.0;
+    m(0,1) = -3.0;
+    m(0,2) =  1.0;
+
+    m(1,0) =  2.0;
+    m(1,1) =  0.0;
+    m(1,2) = -1.0;
+
+    m(2,0) =  1.0;
+    m(2,1) =  4.0;
+    m(2,2) =  5.0;
+
+    mc::MatrixNxN<double, 3> inv;
+    mc::LUDecomposition<double, 3> lu(m);
+    EXPECT_EQ(lu.getInverse(&inv), mc::Result::Success);
+
+    mc::MatrixNxN<double, 3> inv2;
+    EXPECT_EQ(mc::invertMatrix(m, &inv2), mc::Result::Success);
+
+    mc::MatrixNxN<double, 3> p = m * inv;
+    for (unsigned int r = 0; r < 3; ++r)
+    {
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            EXPECT_NEAR(p(r,c), r == c ? 1.0 : 0.0, 1.0e-9);
+            EXPECT_NEAR(inv2(r,c), inv(r,c), 1.0e-12);
+        }
+    }
+}
+
+TEST_F(TestLUDecomposition, CanDetectSingularMatrix)
+{
+    mc::MatrixNxN<double, 3> m;
+    m(0,0) = 1.0;
+    m(0,1) = 2.0;
+    m(0,2) = 3.0;
+
+    m(1,0) = 2.0;
+    m(1,1) = 4.0;
+    m(1,2) = 6.0;
+
+    m(2,0) = 1.0;
+    m(2,1) = 1.0;
+    m(2,2) = 1.0;
+
+    mc::LUDecomposition<double, 3> lu;
+    EXPECT_EQ(lu.decompose(m), mc::Result::Failure);
+    EXPECT_FALSE(lu.isValid());
+    EXPECT_DOUBLE_EQ(lu.getDeterminant(), 0.0);
+
+    mc::VectorN<double, 3> x;
+    EXPECT_EQ(lu.solve(mc::VectorN<double, 3>(), &x), mc::Result::Failure);
+
+    mc::MatrixNxN<double, 3> inv;
+    EXPECT_EQ(mc::invertMatrix(m, &inv), mc::Result::Failure);
+}
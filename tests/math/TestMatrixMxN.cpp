@@ -836,3 +836,33 @@ TEST_F(TestMatrixMxN, CanMultiplyNumberByMatrix)
         }
     }
 }
+
+TEST_F(TestMatrixMxN, CanEvaluateLazyExpression)
+{
+    std::vector<TYPE> x1
+    {
+        1.0, 2.0, 3.0,
+        4.0, 5.0, 6.0
+    };
+    mc::MatrixMxN<TYPE,2,3> m1;
+    m1.setFromStdVector(x1);
+
+    std::vector<TYPE> x2
+    {
+        6.0, 5.0, 4.0,
+        3.0, 2.0, 1.0
+    };
+    mc::MatrixMxN<TYPE,2,3> m2;
+    m2.setFromStdVector(x2);
+
+    mc::MatrixMxN<TYPE,2,3> mr = mc::lazy(m1) * 2.0 - m2 / 2.0;
+
+    for ( int r = 0; r < 2; ++r )
+    {
+        for ( int c = 0; c < 3; ++c )
+        {
+            double ref_value = x1[r*3 + c] * 2.0 - x2[r*3 + c] / 2.0;
+            EXPECT_DOUBLE_EQ(mr(r,c), ref_value) << "Error at row " << r << " and col " << c;
+        }
+    }
+}
@@ -403,3 +403,69 @@ TEST_F(TestMatrixNxN, CanMultiplyNumberByMatrix)
         }
     }
 }
+
+TEST_F(TestMatrixNxN, CanMultiply4x4ByMatrix)
+{
+    std::vector<TYPE> x1
+    {
+         1.0,  2.0,  3.0,  4.0,
+         5.0,  6.0,  7.0,  8.0,
+         9.0, 10.0, 11.0, 12.0,
+        13.0, 14.0, 15.0, 16.0
+    };
+    mc::MatrixNxN<TYPE,4> m1;
+    m1.setFromStdVector(x1);
+
+    std::vector<TYPE> x2
+    {
+        2.0, 0.0, 1.0, 3.0,
+        1.0, 4.0, 0.0, 2.0,
+        0.0, 1.0, 5.0, 1.0,
+        3.0, 2.0, 1.0, 0.0
+    };
+    mc::MatrixNxN<TYPE,4> m2;
+    m2.setFromStdVector(x2);
+
+    mc::MatrixNxN<TYPE,4> mr = m1 * m2;
+
+    std::vector<TYPE> ref
+    {
+        16.0,  19.0,  20.0, 10.0,
+        40.0,  47.0,  48.0, 34.0,
+        64.0,  75.0,  76.0, 58.0,
+        88.0, 103.0, 104.0, 82.0
+    };
+
+    for ( int r = 0; r < 4; ++r )
+    {
+        for ( int c = 0; c < 4; ++c )
+        {
+            EXPECT_DOUBLE_EQ(mr(r,c), ref[r*4 + c]) << "Error at row " << r << " and col " << c;
+        }
+    }
+}
+
+TEST_F(TestMatrixNxN, CanMultiply4x4ByVector)
+{
+    std::vector<TYPE> x
+    {
+         1.0,  2.0,  3.0,  4.0,
+         5.0,  6.0,  7.0,  8.0,
+         9.0, 10.0, 11.0, 12.0,
+        13.0, 14.0, 15.0, 16.0
+    };
+    mc::MatrixNxN<TYPE,4> m;
+    m.setFromStdVector(x);
+
+    mc::VectorN<TYPE,4> v;
+    v(0) = 1.0;
+    v(1) = 2.0;
+    v(2) = 3.0;
+    v(3) = 4.0;
+
+    mc::VectorN<TYPE,4> vr = m * v;
+    EXPECT_DOUBLE_EQ(vr(0),  30.0);
+    EXPECT_DOUBLE_EQ(vr(1),  70.0);
+    EXPECT_DOUBLE_EQ(vr(2), 110.0);
+    EXPECT_DOUBLE_EQ(vr(3), 150.0);
+}
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <mcutils/math/MatrixX.h>
+
+class TestMatrixX : public ::testing::Test
+{
+protected:
+    TestMatrixX() {}
+    virtual ~TestMatrixX() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static mc::MatrixX<double> makeRandomMatrix(unsigned int rows, unsigned int cols, unsigned int seed)
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+        mc::MatrixX<double> m(rows, cols);
+        for (unsigned int i = 0; i < m.size(); ++i)
+        {
+            m(i) = dist(gen);
+        }
+        return m;
+    }
+};
+
+TEST_F(TestMatrixX, CanInstantiate)
+{
+    mc::MatrixX<double> m1;
+    EXPECT_EQ(m1.rows(), 0);
+    EXPECT_EQ(m1.cols(), 0);
+
+    mc::MatrixX<double> m2(2, 3);
+    EXPECT_EQ(m2.rows(), 2);
+    EXPECT_EQ(m2.cols(), 3);
+    EXPECT_EQ(m2.size(), 6);
+    for (unsigned int i = 0; i < m2.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(m2(i), 0.0);
+    }
+}
+
+TEST_F(TestMatrixX, CanGetIdentityMatrix)
+{
+    mc::MatrixX<double> m = mc::MatrixX<double>::getIdentityMatrix(3);
+    for (unsigned int r = 0; r < 3; ++r)
+    {
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            EXPECT_DOUBLE_EQ(m(r,c), r == c ? 1.0 : 0.0);
+        }
+    }
+}
+
+TEST_F(TestMatrixX, CanConvertToAndFromMatrixMxN)
+{
+    mc::MatrixMxN<double, 2, 3> mn;
+    mn.setFromStdVector({ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 });
+
+    mc::MatrixX<double> mx = mn;
+    EXPECT_EQ(mx.rows(), 2);
+    EXPECT_EQ(mx.cols(), 3);
+    EXPECT_DOUBLE_EQ(mx(0,0), 1.0);
+    EXPECT_DOUBLE_EQ(mx(0,2), 3.0);
+    EXPECT_DOUBLE_EQ(mx(1,0), 4.0);
+    EXPECT_DOUBLE_EQ(mx(1,2), 6.0);
+
+    mc::MatrixMxN<double, 2, 3> mn2 = mx.getMatrixMxN<2, 3>();
+    EXPECT_TRUE(mn2 == mn);
+}
+
+TEST_F(TestMatrixX, CanTranspose)
+{
+    mc::MatrixX<double> m(2, 3);
+    m.setFromStdVector({ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 });
+
+    mc::MatrixX<double> mt = m.getTransposed();
+    EXPECT_EQ(mt.rows(), 3);
+    EXPECT_EQ(mt.cols(), 2);
+    for (unsigned int r = 0; r < 2; ++r)
+    {
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            EXPECT_DOUBLE_EQ(mt(c,r), m(r,c));
+        }
+    }
+}
+
+TEST_F(TestMatrixX, CanSwapRows)
+{
+    mc::MatrixX<double> m(2, 2);
+    m.setFromStdVector({ 1.0, 2.0, 3.0, 4.0 });
+    m.swapRows(0, 1);
+    EXPECT_DOUBLE_EQ(m(0,0), 3.0);
+    EXPECT_DOUBLE_EQ(m(0,1), 4.0);
+    EXPECT_DOUBLE_EQ(m(1,0), 1.0);
+    EXPECT_DOUBLE_EQ(m(1,1), 2.0);
+}
+
+TEST_F(TestMatrixX, CanAddAndSubtract)
+{
+    mc::MatrixX<double> m1 = makeRandomMatrix(5, 7, 1);
+    mc::MatrixX<double> m2 = makeRandomMatrix(5, 7, 2);
+
+    mc::MatrixX<double> ms = m1 + m2;
+    mc::MatrixX<double> md = m1 - m2;
+    mc::MatrixX<double> mn = -m1;
+
+    for (unsigned int i = 0; i < m1.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(ms(i), m1(i) + m2(i));
+        EXPECT_DOUBLE_EQ(md(i), m1(i) - m2(i));
+        EXPECT_DOUBLE_EQ(mn(i), -m1(i));
+    }
+
+    m1 += m2;
+    EXPECT_TRUE(m1 == ms);
+}
+
+TEST_F(TestMatrixX, CanMultiplyAndDivideByScalar)
+{
+    mc::MatrixX<double> m = makeRandomMatrix(3, 4, 1);
+
+    mc::MatrixX<double> m1 = m * 2.0;
+    mc::MatrixX<double> m2 = 2.0 * m;
+    mc::MatrixX<double> m3 = m / 2.0;
+
+    for (unsigned int i = 0; i < m.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(m1(i), m(i) * 2.0);
+        EXPECT_DOUBLE_EQ(m2(i), m(i) * 2.0);
+        EXPECT_DOUBLE_EQ(m3(i), m(i) / 2.0);
+    }
+}
+
+TEST_F(TestMatrixX, CanMultiplyByVector)
+{
+    mc::MatrixX<double> m(2, 3);
+    m.setFromStdVector({ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 });
+
+    mc::VectorX<double> v(std::vector<double>{ 1.0, 0.5, -1.0 });
+    mc::VectorX<double> r = m * v;
+
+    EXPECT_EQ(r.size(), 2);
+    EXPECT_DOUBLE_EQ(r(0), -1.0);
+    EXPECT_DOUBLE_EQ(r(1),  0.5);
+}
+
+TEST_F(TestMatrixX, CanMultiplyByMatrix)
+{
+    // sizes not being multiples of the block size
+    mc::MatrixX<double> m1 = makeRandomMatrix(70, 130, 1);
+    mc::MatrixX<double> m2 = makeRandomMatrix(130, 65, 2);
+
+    mc::MatrixX<double> mr = m1 * m2;
+    EXPECT_EQ(mr.rows(), 70);
+    EXPECT_EQ(mr.cols(), 65);
+
+    for (unsigned int i = 0; i < mr.rows(); ++i)
+    {
+        for (unsigned int j = 0; j < mr.cols(); ++j)
+        {
+            double ref = 0.0;
+            for (unsigned int k = 0; k < m1.cols(); ++k)
+            {
+                ref += m1(i,k) * m2(k,j);
+            }
+            EXPECT_NEAR(mr(i,j), ref, 1.0e-12) << "Error at " << i << "," << j;
+        }
+    }
+}
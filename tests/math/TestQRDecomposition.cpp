@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include <mcutils/math/QRDecomposition.h>
+
+class TestQRDecomposition : public ::testing::Test
+{
+protected:
+    TestQRDecomposition() {}
+    virtual ~TestQRDecomposition() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestQRDecomposition, CanInstantiate)
+{
+    mc::QRDecomposition<double, 3> qr;
+    EXPECT_FALSE(qr.isValid());
+}
+
+TEST_F(TestQRDecomposition, CanDecompose)
+{
+    // https://en.wikipedia.org/wiki/QR_decomposition#Example_2
+    mc::MatrixNxN<double, 3> m;
+    m(0,0) =  12.0;
+    m(0,1) = -51.0;
+    m(0,2) =   4.0;
+
+    m(1,0) =   6.0;
+    m(1,1) = 167.0;
+    m(1,2) = -68.0;
+
+    m(2,0) =  -4.0;
+    m(2,1) =  24.0;
+    m(2,2) = -41.0;
+
+    mc::QRDecomposition<double, 3> qr(m);
+    EXPECT_TRUE(qr.isValid());
+
+    mc::MatrixNxN<double, 3> q = qr.getQ();
+    mc::MatrixNxN<double, 3> r = qr.getR();
+
+    // R diagonal is unique up to the signs
+    EXPECT_NEAR(fabs(r(0,0)),  14.0, 1.0e-9);
+    EXPECT_NEAR(fabs(r(1,1)), 175.0, 1.0e-9);
+    EXPECT_NEAR(fabs(r(2,2)),  35.0, 1.0e-9);
+    EXPECT_NEAR(r(1,0), 0.0, 1.0e-12);
+    EXPECT_NEAR(r(2,0), 0.0, 1.0e-12);
+    EXPECT_NEAR(r(2,1), 0.0, 1.0e-12);
+
+    mc::MatrixNxN<double, 3> qr_prod = q * r;
+    mc::MatrixNxN<double, 3> qtq = q.getTransposed() * q;
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        for (unsigned int j = 0; j < 3; ++j)
+        {
+            EXPECT_NEAR(qr_prod(i,j), m(i,j), 1.0e-9);
+            EXPECT_NEAR(qtq(i,j), i == j ? 1.0 : 0.0, 1.0e-12);
+        }
+    }
+}
+
+TEST_F(TestQRDecomposition, CanSolve)
+{
+    mc::MatrixNxN<double, 3> m;
+    m(0,0) = 0.0;
+    m(0,1) = 1.0;
+    m(0,2) = 1.0;
+
+    m(1,0) = 1.0;
+    m(1,1) = 0.0;
+    m(1,2) = 1.0;
+
+    m(2,0) = 1.0;
+    m(2,1) = 1.0;
+    m(2,2) = 0.0;
+
+    mc::QRDecomposition<double, 3> qr(m);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        mc::VectorN<double, 3> x_ref;
+        x_ref(0) = 1.0 * i;
+        x_ref(1) = 2.0 - i;
+        x_ref(2) = 0.5 * i + 1.0;
+
+        mc::VectorN<double, 3> x;
+        EXPECT_EQ(qr.solve(m * x_ref, &x), mc::Result::Success);
+
+        EXPECT_NEAR(x(0), x_ref(0), 1.0e-9);
+        EXPECT_NEAR(x(1), x_ref(1), 1.0e-9);
+        EXPECT_NEAR(x(2), x_ref(2), 1.0e-9);
+    }
+}
+
+TEST_F(TestQRDecomposition, CanGetDeterminant)
+{
+    mc::MatrixNxN<double, 3> m;
+    m(0,0) =  2.0;
+    m(0,1) = -3.0;
+    m(0,2) =  1.0;
+
+    m(1,0) =  2.0;
+    m(1,1) =  0.0;
+    m(1,2) = -1.0;
+
+    m(2,0) =  1.0;
+    m(2,1) =  4.0;
+    m(2,2) =  5.0;
+
+    mc::QRDecomposition<double, 3> qr(m);
+    EXPECT_NEAR(qr.getDeterminant(), 49.0, 1.0e-9);
+}
+
+TEST_F(TestQRDecomposition, CanGetInverse)
+{
+    mc::MatrixNxN<double, 3> m;
+    m(0,0) =  2.0;
+    m(0,1) = -3.0;
+    m(0,2) =  1.0;
+
+    m(1,0) =  2.0;
+    m(1,1) =  0.0;
+    m(1,2) = -1.0;
+
+    m(2,0) =  1.0;
+    m(2,1) =  4.0;
+    m(2,2) =  5.0;
+
+    mc::MatrixNxN<double, 3> inv;
+    mc::QRDecomposition<double, 3> qr(m);
+    EXPECT_EQ(qr.getInverse(&inv), mc::Result::Success);
+
+    mc::MatrixNxN<double, 3> p = m * inv;
+    for (unsigned int r = 0; r < 3; ++r)
+    {
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            EXPECT_NEAR(p(r,c), r == c ? 1.0 : 0.0, 1.0e-9);
+        }
+    }
+}
+
+TEST_F(TestQRDecomposition, CanDetectSingularMatrix)
+{
+    mc::MatrixNxN<double, 3> m;
+    m(0,0) = 1.0;
+    m(0,1) = 2.0;
+    m(0,2) = 3.0;
+
+    m(1,0) = 2.0;
+    m(1,1) = 4.0;
+    m(1,2) = 6.0;
+
+    m(2,0) = 1.0;
+    m(2,1) = 1.0;
+    m(2,2) = 1.0;
+
+    mc::QRDecomposition<double, 3> qr;
+    EXPECT_EQ(qr.decompose(m), mc::Result::Failure);
+    EXPECT_FALSE(qr.isValid());
+
+    mc::VectorN<double, 3> x;
+    EXPECT_EQ(qr.solve(mc::VectorN<double, 3>(), &x), mc::Result::Failure);
+}
@@ -55,3 +55,74 @@ TEST_F(TestRungeKutta4, CanSetDerivFun)
     } ));
     EXPECT_TRUE(static_cast<bool>(rk.fun()));
 }
+
+TEST_F(TestRungeKutta4, CanSolveWithTemplatedDerivFun)
+{
+    // mass-spring-damper, see DiffEquationSolver
+    const double k = 1.0;
+    const double c = 1.0;
+    auto deriv = [k, c](const mc::Vector3d& state)
+    {
+        mc::Vector3d result;
+        result(0) = state(1);
+        result(1) = -k * state(0) - c * state(1);
+        return result;
+    };
+
+    mc::RungeKutta4<mc::Vector3d, double> rk1;
+    rk1.setFun(deriv);
+
+    mc::RungeKutta4<mc::Vector3d, double, decltype(deriv)> rk2(deriv);
+
+    mc::Vector3d s1(1.0, 0.0, 0.0);
+    mc::Vector3d s2(1.0, 0.0, 0.0);
+    for (int i = 0; i < 100; ++i)
+    {
+        s1 = rk1.integrate(0.01, s1);
+        s2 = rk2.integrate(0.01, s2);
+    }
+
+    EXPECT_DOUBLE_EQ(s2.x(), s1.x());
+    EXPECT_DOUBLE_EQ(s2.y(), s1.y());
+    EXPECT_DOUBLE_EQ(s2.z(), s1.z());
+}
+
+TEST_F(TestRungeKutta4, CanIntegrateInPlace)
+{
+    // dy/dx = y, y(0) = 1
+    auto deriv = [](const double& y) { return y; };
+    mc::RungeKutta4<double, double, decltype(deriv)> rk(deriv);
+
+    double y1 = 1.0;
+    double y2 = 1.0;
+    for (int i = 0; i < 100; ++i)
+    {
+        y1 = rk.integrate(0.01, y1);
+        rk.integrate(0.01, &y2);
+    }
+
+    EXPECT_DOUBLE_EQ(y2, y1);
+    EXPECT_NEAR(y2, exp(1.0), 1.0e-9);
+}
+
+TEST_F(TestRungeKutta4, CanIntegrateWithDerivFunWritingResult)
+{
+    // dy/dx = -y, y(0) = 1
+    auto deriv = [](const mc::VectorN<double, 2>& y, mc::VectorN<double, 2>* dy)
+    {
+        (*dy)(0) = -y(0);
+        (*dy)(1) = -2.0 * y(1);
+    };
+    mc::RungeKutta4<mc::VectorN<double, 2>, double, decltype(deriv)> rk(deriv);
+
+    mc::VectorN<double, 2> y;
+    y(0) = 1.0;
+    y(1) = 1.0;
+    for (int i = 0; i < 100; ++i)
+    {
+        rk.integrate(0.01, &y);
+    }
+
+    EXPECT_NEAR(y(0), exp(-1.0), 1.0e-9);
+    EXPECT_NEAR(y(1), exp(-2.0), 1.0e-9);
+}
@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+
+#include <mcutils/math/RungeKutta45.h>
+
+#include <DiffEquationSolver.h>
+
+class TestRungeKutta45 : public ::testing::Test
+{
+protected:
+    TestRungeKutta45() {}
+    virtual ~TestRungeKutta45() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestRungeKutta45, CanInstantiate)
+{
+    mc::RungeKutta45<double,double> rk;
+    EXPECT_FALSE(static_cast<bool>(rk.fun()));
+    EXPECT_EQ(rk.getEvaluations(), 0);
+}
+
+TEST_F(TestRungeKutta45, CanSolve)
+{
+    mc::RungeKutta45<mc::Vector3d, double> rk1;
+    DiffEquationSolver<mc::RungeKutta45<mc::Vector3d, double>> des1(1.0, 1.0, 3.0, &rk1);
+    EXPECT_TRUE(des1.Solve(0.0, 1.0));
+
+    mc::RungeKutta45<mc::Vector3d, double> rk2;
+    DiffEquationSolver<mc::RungeKutta45<mc::Vector3d, double>> des2(1.0, 1.0, 3.0, &rk2);
+    EXPECT_TRUE(des2.Solve(1.0, 0.0));
+
+    mc::RungeKutta45<mc::Vector3d, double> rk3;
+    DiffEquationSolver<mc::RungeKutta45<mc::Vector3d, double>> des3(1.0, 1.0, 3.0, &rk3);
+    EXPECT_TRUE(des3.Solve(1.0, 1.0));
+
+    mc::RungeKutta45<mc::Vector3d, double> rk4;
+    DiffEquationSolver<mc::RungeKutta45<mc::Vector3d, double>> des4(1.0, 1.0, 1.0, &rk4);
+    EXPECT_TRUE(des4.Solve(0.0, 1.0));
+
+    mc::RungeKutta45<mc::Vector3d, double> rk5;
+    DiffEquationSolver<mc::RungeKutta45<mc::Vector3d, double>> des5(1.0, 1.0, 1.0, &rk5);
+    EXPECT_TRUE(des5.Solve(1.0, 0.0));
+
+    mc::RungeKutta45<mc::Vector3d, double> rk6;
+    DiffEquationSolver<mc::RungeKutta45<mc::Vector3d, double>> des6(1.0, 1.0, 1.0, &rk6);
+    EXPECT_TRUE(des6.Solve(1.0, 1.0));
+}
+
+TEST_F(TestRungeKutta45, CanSetDerivFun)
+{
+    mc::RungeKutta45<double,double> rk;
+    EXPECT_NO_THROW(rk.setFun([](const double&)
+    {
+        return 1.0;
+    } ));
+    EXPECT_TRUE(static_cast<bool>(rk.fun()));
+}
+
+TEST_F(TestRungeKutta45, CanIntegrateWithinTolerance)
+{
+    // harmonic oscillator, x(t) = cos(t)
+    auto deriv = [](const mc::VectorN<double, 2>& y)
+    {
+        mc::VectorN<double, 2> result;
+        result(0) =  y(1);
+        result(1) = -y(0);
+        return result;
+    };
+    mc::RungeKutta45<mc::VectorN<double, 2>, double, decltype(deriv)> rk(deriv);
+
+    for (double tol : { 1.0e-6, 1.0e-9 })
+    {
+        rk.setTolerances(tol, tol);
+        rk.setStep(0.0);
+        rk.resetStats();
+
+        mc::VectorN<double, 2> y;
+        y(0) = 1.0;
+        rk.integrate(10.0, &y);
+
+        EXPECT_NEAR(y(0), cos(10.0), 100.0 * tol);
+        EXPECT_NEAR(y(1), -sin(10.0), 100.0 * tol);
+        EXPECT_GT(rk.getAcceptedSteps(), 1);
+
+        // last stage of each step is reused as the first stage of the next one
+        EXPECT_EQ(rk.getEvaluations(), 1 + 6 * (rk.getAcceptedSteps() + rk.getRejectedSteps()));
+    }
+}
+
+TEST_F(TestRungeKutta45, CanReuseDerivativeBetweenCalls)
+{
+    // harmonic oscillator, x(t) = cos(t)
+    auto deriv = [](const mc::VectorN<double, 2>& y)
+    {
+        mc::VectorN<double, 2> result;
+        result(0) =  y(1);
+        result(1) = -y(0);
+        return result;
+    };
+    mc::RungeKutta45<mc::VectorN<double, 2>, double, decltype(deriv)> rk(deriv);
+    rk.setTolerances(1.0e-6, 1.0e-6);
+
+    mc::VectorN<double, 2> y;
+    y(0) = 1.0;
+    for (int i = 0; i < 100; ++i)
+    {
+        rk.integrate(0.1, &y);
+    }
+
+    EXPECT_NEAR(y(0), cos(10.0), 1.0e-4);
+    EXPECT_GE(rk.getAcceptedSteps(), 100);
+
+    // derivative is evaluated once for the first step only
+    EXPECT_EQ(rk.getEvaluations(), 1 + 6 * (rk.getAcceptedSteps() + rk.getRejectedSteps()));
+}
+
+TEST_F(TestRungeKutta45, CanRejectTooLargeStep)
+{
+    auto deriv = [](const double& y) { return -50.0 * y; };
+    mc::RungeKutta45<double, double, decltype(deriv)> rk(deriv);
+    rk.setTolerances(1.0e-9, 1.0e-9);
+
+    double y = 1.0;
+    double h_next = 0.0;
+    EXPECT_FALSE(rk.tryStep(1.0, &y, &h_next));
+    EXPECT_DOUBLE_EQ(y, 1.0);
+    EXPECT_LT(h_next, 1.0);
+    EXPECT_EQ(rk.getRejectedSteps(), 1);
+
+    rk.integrate(1.0, &y);
+    EXPECT_NEAR(y, exp(-50.0), 1.0e-9);
+}
+
+TEST_F(TestRungeKutta45, CanGetDenseOutput)
+{
+    // dy/dx = y, y(0) = 1
+    auto deriv = [](const double& y) { return y; };
+    mc::RungeKutta45<double, double, decltype(deriv)> rk(deriv);
+    rk.setTolerances(1.0e-3, 1.0e-3);
+
+    double y = 1.0;
+    double h_next = 0.0;
+    ASSERT_TRUE(rk.tryStep(0.2, &y, &h_next));
+
+    EXPECT_DOUBLE_EQ(rk.getDenseOutput(0.0), 1.0);
+    EXPECT_DOUBLE_EQ(rk.getDenseOutput(1.0), y);
+    for (double theta = 0.0; theta <= 1.0; theta += 0.1)
+    {
+        EXPECT_NEAR(rk.getDenseOutput(theta), exp(0.2 * theta), 1.0e-6);
+    }
+
+    // dense output does not need any more derivative evaluations
+    EXPECT_EQ(rk.getEvaluations(), 7);
+}
+
+TEST_F(TestRungeKutta45, CanStopOnNonFiniteError)
+{
+    // derivative is NaN for negative values
+    auto deriv = [](const double& y) { return sqrt(y); };
+    mc::RungeKutta45<double, double, decltype(deriv)> rk(deriv);
+
+    double y = -1.0;
+    rk.integrate(1.0, &y);
+    EXPECT_TRUE(std::isnan(y));
+    EXPECT_EQ(rk.getAcceptedSteps(), 1);
+
+    // solver is still usable after that
+    y = 1.0;
+    rk.integrate(1.0, &y);
+    EXPECT_NEAR(y, 2.25, 1.0e-5);
+}
+
+TEST_F(TestRungeKutta45, CanChangeDerivFun)
+{
+    mc::RungeKutta45<double, double> rk([](const double&) { return 0.0; });
+
+    double y = 0.0;
+    rk.integrate(0.1, &y);
+    EXPECT_DOUBLE_EQ(y, 0.0);
+
+    // derivative cached by the previous call must not be reused
+    rk.setFun([](const double&) { return 1.0; });
+    y = 0.0;
+    rk.integrate(0.1, &y);
+    EXPECT_DOUBLE_EQ(y, 0.1);
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <mcutils/math/RungeKutta78.h>
+
+#include <DiffEquationSolver.h>
+
+class TestRungeKutta78 : public ::testing::Test
+{
+protected:
+    TestRungeKutta78() {}
+    virtual ~TestRungeKutta78() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestRungeKutta78, CanInstantiate)
+{
+    mc::RungeKutta78<double,double> rk;
+    EXPECT_FALSE(static_cast<bool>(rk.fun()));
+    EXPECT_EQ(rk.getEvaluations(), 0);
+}
+
+TEST_F(TestRungeKutta78, CanSolve)
+{
+    mc::RungeKutta78<mc::Vector3d, double> rk1;
+    DiffEquationSolver<mc::RungeKutta78<mc::Vector3d, double>> des1(1.0, 1.0, 3.0, &rk1);
+    EXPECT_TRUE(des1.Solve(0.0, 1.0));
+
+    mc::RungeKutta78<mc::Vector3d, double> rk2;
+    DiffEquationSolver<mc::RungeKutta78<mc::Vector3d, double>> des2(1.0, 1.0, 3.0, &rk2);
+    EXPECT_TRUE(des2.Solve(1.0, 0.0));
+
+    mc::RungeKutta78<mc::Vector3d, double> rk3;
+    DiffEquationSolver<mc::RungeKutta78<mc::Vector3d, double>> des3(1.0, 1.0, 3.0, &rk3);
+    EXPECT_TRUE(des3.Solve(1.0, 1.0));
+
+    mc::RungeKutta78<mc::Vector3d, double> rk4;
+    DiffEquationSolver<mc::RungeKutta78<mc::Vector3d, double>> des4(1.0, 1.0, 1.0, &rk4);
+    EXPECT_TRUE(des4.Solve(0.0, 1.0));
+
+    mc::RungeKutta78<mc::Vector3d, double> rk5;
+    DiffEquationSolver<mc::RungeKutta78<mc::Vector3d, double>> des5(1.0, 1.0, 1.0, &rk5);
+    EXPECT_TRUE(des5.Solve(1.0, 0.0));
+
+    mc::RungeKutta78<mc::Vector3d, double> rk6;
+    DiffEquationSolver<mc::RungeKutta78<mc::Vector3d, double>> des6(1.0, 1.0, 1.0, &rk6);
+    EXPECT_TRUE(des6.Solve(1.0, 1.0));
+}
+
+TEST_F(TestRungeKutta78, CanSetDerivFun)
+{
+    mc::RungeKutta78<double,double> rk;
+    EXPECT_NO_THROW(rk.setFun([](const double&)
+    {
+        return 1.0;
+    } ));
+    EXPECT_TRUE(static_cast<bool>(rk.fun()));
+}
+
+TEST_F(TestRungeKutta78, CanIntegrateWithinTolerance)
+{
+    // harmonic oscillator, x(t) = cos(t)
+    auto deriv = [](const mc::VectorN<double, 2>& y)
+    {
+        mc::VectorN<double, 2> result;
+        result(0) =  y(1);
+        result(1) = -y(0);
+        return result;
+    };
+    mc::RungeKutta78<mc::VectorN<double, 2>, double, decltype(deriv)> rk(deriv);
+
+    for (double tol : { 1.0e-6, 1.0e-12 })
+    {
+        rk.setTolerances(tol, tol);
+        rk.setStep(0.0);
+        rk.resetStats();
+
+        mc::VectorN<double, 2> y;
+        y(0) = 1.0;
+        rk.integrate(10.0, &y);
+
+        EXPECT_NEAR(y(0), cos(10.0), 100.0 * tol);
+        EXPECT_NEAR(y(1), -sin(10.0), 100.0 * tol);
+        EXPECT_GT(rk.getAcceptedSteps(), 1);
+
+        // first stage is reused after a rejected step
+        EXPECT_EQ(rk.getEvaluations(), 13 * rk.getAcceptedSteps() + 12 * rk.getRejectedSteps());
+    }
+}
+
+TEST_F(TestRungeKutta78, CanIntegrateBackwards)
+{
+    auto deriv = [](const double& y) { return y; };
+    mc::RungeKutta78<double, double, decltype(deriv)> rk(deriv);
+    rk.setTolerances(1.0e-12, 1.0e-12);
+
+    double y = 1.0;
+    rk.integrate(2.0, &y);
+    EXPECT_NEAR(y, exp(2.0), 1.0e-9);
+
+    rk.integrate(-2.0, &y);
+    EXPECT_NEAR(y, 1.0, 1.0e-9);
+}
+
+TEST_F(TestRungeKutta78, CanGetDenseOutput)
+{
+    // dy/dx = y, y(0) = 1
+    auto deriv = [](const double& y) { return y; };
+    mc::RungeKutta78<double, double, decltype(deriv)> rk(deriv);
+
+    double y = 1.0;
+    double h_next = 0.0;
+    ASSERT_TRUE(rk.tryStep(0.1, &y, &h_next));
+
+    EXPECT_DOUBLE_EQ(rk.getDenseOutput(0.0), 1.0);
+    EXPECT_DOUBLE_EQ(rk.getDenseOutput(1.0), y);
+    for (double theta = 0.0; theta <= 1.0; theta += 0.1)
+    {
+        EXPECT_NEAR(rk.getDenseOutput(theta), exp(0.1 * theta), 1.0e-6);
+    }
+
+    // derivative at the step end is evaluated once and reused by the next step
+    EXPECT_EQ(rk.getEvaluations(), 14);
+    ASSERT_TRUE(rk.tryStep(0.1, &y, &h_next));
+    EXPECT_EQ(rk.getEvaluations(), 26);
+}
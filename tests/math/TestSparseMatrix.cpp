@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <mcutils/math/SparseMatrix.h>
+
+class TestSparseMatrix : public ::testing::Test
+{
+protected:
+    TestSparseMatrix() {}
+    virtual ~TestSparseMatrix() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static mc::MatrixX<double> makeRandomSparseMatrix(unsigned int rows, unsigned int cols, unsigned int seed)
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<double> dist(-1.0, 1.0);
+        std::uniform_int_distribution<int> fill(0, 3);
+
+        mc::MatrixX<double> m(rows, cols);
+        for (unsigned int i = 0; i < m.size(); ++i)
+        {
+            const double value = dist(gen);
+            m(i) = fill(gen) == 0 ? value : 0.0;
+        }
+        return m;
+    }
+};
+
+TEST_F(TestSparseMatrix, CanInstantiate)
+{
+    mc::SparseMatrixCSR<double> csr;
+    EXPECT_EQ(csr.rows(), 0);
+    EXPECT_EQ(csr.cols(), 0);
+    EXPECT_EQ(csr.getNonZeros(), 0);
+
+    mc::SparseMatrixCSC<double> csc;
+    EXPECT_EQ(csc.rows(), 0);
+    EXPECT_EQ(csc.cols(), 0);
+    EXPECT_EQ(csc.getNonZeros(), 0);
+}
+
+TEST_F(TestSparseMatrix, CanInstantiateFromEntries)
+{
+    // 1 0 2
+    // 0 0 3
+    // 4 5 0
+    std::vector<mc::SparseEntry<double>> entries = {
+        { 2, 1, 5.0 },
+        { 0, 2, 2.0 },
+        { 1, 2, 3.0 },
+        { 0, 0, 1.0 },
+        { 2, 0, 3.0 },
+        { 2, 0, 1.0 }  // duplicated entry
+    };
+
+    mc::SparseMatrixCSR<double> csr(3, 3, entries);
+    EXPECT_EQ(csr.rows(), 3);
+    EXPECT_EQ(csr.cols(), 3);
+    EXPECT_EQ(csr.getNonZeros(), 5);
+
+    std::vector<unsigned int> row_ptr = { 0, 2, 3, 5 };
+    std::vector<unsigned int> col_idx = { 0, 2, 2, 0, 1 };
+    std::vector<double> values = { 1.0, 2.0, 3.0, 4.0, 5.0 };
+    EXPECT_EQ(csr.getRowPtr(), row_ptr);
+    EXPECT_EQ(csr.getColIndices(), col_idx);
+    EXPECT_EQ(csr.getValues(), values);
+
+    mc::SparseMatrixCSC<double> csc(3, 3, entries);
+    EXPECT_EQ(csc.getNonZeros(), 5);
+
+    std::vector<unsigned int> col_ptr = { 0, 2, 3, 5 };
+    std::vector<unsigned int> row_idx = { 0, 2, 2, 0, 1 };
+    std::vector<double> csc_values = { 1.0, 4.0, 5.0, 2.0, 3.0 };
+    EXPECT_EQ(csc.getColPtr(), col_ptr);
+    EXPECT_EQ(csc.getRowIndices(), row_idx);
+    EXPECT_EQ(csc.getValues(), csc_values);
+}
+
+TEST_F(TestSparseMatrix, CanAccessElements)
+{
+    mc::MatrixX<double> m = makeRandomSparseMatrix(7, 5, 1);
+    mc::SparseMatrixCSR<double> csr(m);
+    mc::SparseMatrixCSC<double> csc(csr);
+
+    EXPECT_EQ(csr.getNonZeros(), csc.getNonZeros());
+
+    for (unsigned int r = 0; r < m.rows(); ++r)
+    {
+        for (unsigned int c = 0; c < m.cols(); ++c)
+        {
+            EXPECT_DOUBLE_EQ(csr(r,c), m(r,c));
+            EXPECT_DOUBLE_EQ(csc(r,c), m(r,c));
+        }
+    }
+}
+
+TEST_F(TestSparseMatrix, CanGetDiagonal)
+{
+    mc::MatrixX<double> m = makeRandomSparseMatrix(6, 6, 2);
+    m(3,3) = 0.0;
+
+    mc::VectorX<double> d_csr = mc::SparseMatrixCSR<double>(m).getDiagonal();
+    mc::VectorX<double> d_csc = mc::SparseMatrixCSC<double>(mc::SparseMatrixCSR<double>(m)).getDiagonal();
+
+    ASSERT_EQ(d_csr.size(), 6);
+    ASSERT_EQ(d_csc.size(), 6);
+    for (unsigned int i = 0; i < 6; ++i)
+    {
+        EXPECT_DOUBLE_EQ(d_csr(i), m(i,i));
+        EXPECT_DOUBLE_EQ(d_csc(i), m(i,i));
+    }
+}
+
+TEST_F(TestSparseMatrix, CanGetMatrixX)
+{
+    mc::MatrixX<double> m = makeRandomSparseMatrix(4, 9, 3);
+    mc::SparseMatrixCSR<double> csr(m);
+    mc::SparseMatrixCSC<double> csc(csr);
+
+    mc::MatrixX<double> m_csr = csr.getMatrixX();
+    mc::MatrixX<double> m_csc = csc.getMatrixX();
+
+    ASSERT_EQ(m_csr.rows(), 4);
+    ASSERT_EQ(m_csr.cols(), 9);
+    ASSERT_EQ(m_csc.rows(), 4);
+    ASSERT_EQ(m_csc.cols(), 9);
+    for (unsigned int i = 0; i < m.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(m_csr(i), m(i));
+        EXPECT_DOUBLE_EQ(m_csc(i), m(i));
+    }
+}
+
+TEST_F(TestSparseMatrix, CanSkipSmallElements)
+{
+    mc::MatrixX<double> m(2, 2);
+    m.setFromStdVector({
+        1.0,    1.0e-12,
+        -1.0e-12, 2.0
+    });
+
+    EXPECT_EQ(mc::SparseMatrixCSR<double>(m).getNonZeros(), 4);
+    EXPECT_EQ(mc::SparseMatrixCSR<double>(m, 1.0e-9).getNonZeros(), 2);
+}
+
+TEST_F(TestSparseMatrix, CanMultiplyByVector)
+{
+    mc::MatrixX<double> m = makeRandomSparseMatrix(11, 8, 4);
+    mc::SparseMatrixCSR<double> csr(m);
+    mc::SparseMatrixCSC<double> csc(csr);
+
+    mc::VectorX<double> v(8);
+    for (unsigned int i = 0; i < v.size(); ++i)
+    {
+        v(i) = 0.5 * i - 1.0;
+    }
+
+    mc::VectorX<double> expected = m * v;
+    mc::VectorX<double> r_csr = csr * v;
+    mc::VectorX<double> r_csc = csc * v;
+
+    ASSERT_EQ(r_csr.size(), 11);
+    ASSERT_EQ(r_csc.size(), 11);
+    for (unsigned int i = 0; i < expected.size(); ++i)
+    {
+        EXPECT_NEAR(r_csr(i), expected(i), 1.0e-12);
+        EXPECT_NEAR(r_csc(i), expected(i), 1.0e-12);
+    }
+}
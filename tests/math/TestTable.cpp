@@ -1,11 +1,15 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <memory_resource>
+#include <thread>
 
 #include <units.h>
 
 #include <mcutils/math/Table.h>
 
+#include <CountingResource.h>
+
 using namespace units::literals;
 
 class TestTable : public ::testing::Test
@@ -214,6 +218,289 @@ TEST_F(TestTable, CanGetValueOutOfRange)
     EXPECT_DOUBLE_EQ(tab.getValue(  9.0 ), 8.0);
 }
 
+TEST_F(TestTable, CanDetectUniformKeys)
+{
+    std::vector<double> k1 { -2.0, -1.0,  0.0,  1.0,  2.0,  3.0 };
+    std::vector<double> v1 {  1.0,  0.0, -1.0,  0.0,  3.0,  8.0 };
+    mc::Table<double,double> t1(k1, v1);
+    EXPECT_EQ(t1.getSearch(), mc::TableSearch::Uniform);
+
+    std::vector<double> k2 { -2.0, -1.0,  0.0,  1.5,  2.0,  3.0 };
+    std::vector<double> v2 {  1.0,  0.0, -1.0,  0.0,  3.0,  8.0 };
+    mc::Table<double,double> t2(k2, v2);
+    EXPECT_EQ(t2.getSearch(), mc::TableSearch::Binary);
+}
+
+TEST_F(TestTable, CanGetValueWithAnySearch)
+{
+    // y = x^2 - 1
+    std::vector<double> key_values { -2.0, -1.5, -1.0,  0.0,  0.5,  1.0,  2.0,  3.0 };
+    std::vector<double> table_data {  3.0,  1.25, 0.0, -1.0, -0.75, 0.0,  3.0,  8.0 };
+
+    mc::Table<double,double> tab(key_values, table_data);
+    mc::Table<double,double> tab_linear(tab);
+    mc::Table<double,double> tab_binary(tab);
+    mc::Table<double,double> tab_uniform(tab);
+
+    tab_linear.setSearch(mc::TableSearch::Linear);
+    tab_binary.setSearch(mc::TableSearch::Binary);
+    tab_uniform.setSearch(mc::TableSearch::Uniform);
+
+    // both ascending and descending order to miss previous index
+    for (double x = -3.0; x <= 4.0; x += 0.05)
+    {
+        EXPECT_DOUBLE_EQ(tab_binary.getValue(x), tab_linear.getValue(x));
+        EXPECT_DOUBLE_EQ(tab_uniform.getValue(x), tab_linear.getValue(x));
+    }
+
+    for (double x = 4.0; x >= -3.0; x -= 0.35)
+    {
+        EXPECT_DOUBLE_EQ(tab_binary.getValue(x), tab_linear.getValue(x));
+        EXPECT_DOUBLE_EQ(tab_uniform.getValue(x), tab_linear.getValue(x));
+    }
+
+    for (unsigned int i = 0; i < key_values.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(tab_linear.getValue(key_values[i]), table_data[i]);
+        EXPECT_DOUBLE_EQ(tab_binary.getValue(key_values[i]), table_data[i]);
+        EXPECT_DOUBLE_EQ(tab_uniform.getValue(key_values[i]), table_data[i]);
+    }
+}
+
+TEST_F(TestTable, CanGetValueWithCursor)
+{
+    // y = x^2 - 1
+    std::vector<double> key_values { -2.0, -1.5, -1.0,  0.0,  0.5,  1.0,  2.0,  3.0 };
+    std::vector<double> table_data {  3.0,  1.25, 0.0, -1.0, -0.75, 0.0,  3.0,  8.0 };
+
+    const mc::Table<double,double> tab(key_values, table_data);
+
+    mc::TableCursor cursor;
+
+    for (double x = -3.0; x <= 4.0; x += 0.05)
+    {
+        EXPECT_DOUBLE_EQ(tab.getValue(x, cursor), tab.getValue(x));
+    }
+
+    for (double x = 4.0; x >= -3.0; x -= 0.35)
+    {
+        EXPECT_DOUBLE_EQ(tab.getValue(x, cursor), tab.getValue(x));
+    }
+
+    // cursor used with a larger table
+    cursor.index = 100;
+    EXPECT_DOUBLE_EQ(tab.getValue(2.5, cursor), 5.5);
+    EXPECT_EQ(cursor.index, 6);
+}
+
+TEST_F(TestTable, CanGetValueConcurrently)
+{
+    std::vector<double> key_values;
+    std::vector<double> table_data;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        double x = 0.1 * i * i;
+        key_values.push_back(x);
+        table_data.push_back(x * x);
+    }
+
+    const mc::Table<double,double> tab(key_values, table_data);
+
+    std::vector<std::thread> threads;
+    std::vector<int> failures(4, 0);
+
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&tab, &key_values, &table_data, &failures, t]()
+        {
+            mc::TableCursor cursor;
+            for (int n = 0; n < 100; ++n)
+            {
+                for (unsigned int i = t; i < key_values.size(); i += 4)
+                {
+                    if (tab.getValue(key_values[i]) != table_data[i]) ++failures[t];
+                    if (tab.getValue(key_values[i], cursor) != table_data[i]) ++failures[t];
+                }
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int f : failures)
+    {
+        EXPECT_EQ(f, 0);
+    }
+}
+
+TEST_F(TestTable, CanGetValues)
+{
+    // y = x^2 - 1
+    std::vector<double> key_values { -2.0, -1.5, -1.0,  0.0,  0.5,  1.0,  2.0,  3.0 };
+    std::vector<double> table_data {  3.0,  1.25, 0.0, -1.0, -0.75, 0.0,  3.0,  8.0 };
+
+    mc::Table<double,double> tab(key_values, table_data);
+
+    std::vector<double> keys;
+    for (double x = -3.0; x <= 4.0; x += 0.05)
+    {
+        keys.push_back(x);
+    }
+    keys.insert(keys.end(), key_values.begin(), key_values.end());
+
+    std::vector<double> values(keys.size());
+    tab.getValues(keys, values);
+
+    for (unsigned int i = 0; i < keys.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(values[i], tab.getValue(keys[i])) << "x= " << keys[i];
+    }
+}
+
+TEST_F(TestTable, CanGetValuesFromSingleRowAndEmptyTable)
+{
+    std::vector<double> keys { -1.0, 0.0, 1.0, 2.0, 3.0 };
+    std::vector<double> values(keys.size());
+
+    mc::Table<double,double> tab1(2.0, 1.0);
+    tab1.getValues(keys, values);
+    for (double value : values)
+    {
+        EXPECT_DOUBLE_EQ(value, 2.0);
+    }
+
+    std::vector<double> key_values;
+    std::vector<double> table_data;
+    mc::Table<double,double> tab0(key_values, table_data);
+    tab0.getValues(keys, values);
+    for (double value : values)
+    {
+        EXPECT_TRUE(std::isnan(value));
+    }
+}
+
+TEST_F(TestTable, CanInterpolateWithCubicSpline)
+{
+    std::vector<double> key_values { 0.0, 1.0, 2.0 };
+    std::vector<double> table_data { 0.0, 1.0, 0.0 };
+
+    mc::Table<double,double> tab(key_values, table_data);
+    tab.setInterpolation(mc::TableInterpolation::CubicSpline);
+    EXPECT_EQ(tab.getInterpolation(), mc::TableInterpolation::CubicSpline);
+
+    // natural spline: 1.5x - 0.5x^3 for x in [0,1], symmetric around x=1
+    EXPECT_DOUBLE_EQ(tab.getValue(0.0), 0.0);
+    EXPECT_DOUBLE_EQ(tab.getValue(0.5), 0.6875);
+    EXPECT_DOUBLE_EQ(tab.getValue(1.0), 1.0);
+    EXPECT_DOUBLE_EQ(tab.getValue(1.5), 0.6875);
+    EXPECT_DOUBLE_EQ(tab.getValue(2.0), 0.0);
+
+    // clamped outside of the keys range
+    EXPECT_DOUBLE_EQ(tab.getValue(-1.0), 0.0);
+    EXPECT_DOUBLE_EQ(tab.getValue( 3.0), 0.0);
+
+    // interpolation method is kept when data is set
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = 0; i <= 20; ++i)
+    {
+        x.push_back(0.1 * M_PI * i);
+        y.push_back(std::sin(x.back()));
+    }
+    tab.setData(x, y);
+    EXPECT_EQ(tab.getInterpolation(), mc::TableInterpolation::CubicSpline);
+
+    mc::Table<double,double> tab_lin(x, y);
+
+    double err_max = 0.0;
+    double err_max_lin = 0.0;
+    for (double key = 0.0; key <= 2.0 * M_PI; key += 0.01)
+    {
+        err_max     = std::max(err_max    , std::fabs(tab.getValue(key)     - std::sin(key)));
+        err_max_lin = std::max(err_max_lin, std::fabs(tab_lin.getValue(key) - std::sin(key)));
+    }
+    EXPECT_LT(err_max, 1.0e-3);
+    EXPECT_LT(err_max, 0.1 * err_max_lin);
+}
+
+TEST_F(TestTable, CanInterpolateWithPchip)
+{
+    std::vector<double> key_values { 0.0, 1.0, 2.0 };
+    std::vector<double> table_data { 0.0, 1.0, 0.0 };
+
+    mc::Table<double,double> tab(key_values, table_data);
+    tab.setInterpolation(mc::TableInterpolation::Pchip);
+    EXPECT_EQ(tab.getInterpolation(), mc::TableInterpolation::Pchip);
+
+    EXPECT_DOUBLE_EQ(tab.getValue(0.0), 0.0);
+    EXPECT_DOUBLE_EQ(tab.getValue(0.5), 0.75);
+    EXPECT_DOUBLE_EQ(tab.getValue(1.0), 1.0);
+    EXPECT_DOUBLE_EQ(tab.getValue(1.5), 0.75);
+    EXPECT_DOUBLE_EQ(tab.getValue(2.0), 0.0);
+
+    // monotone data, spline overshoots, pchip doesn't
+    std::vector<double> x { 0.0, 1.0, 2.0, 3.0, 4.0 };
+    std::vector<double> y { 0.0, 0.0, 1.0, 1.0, 1.0 };
+
+    mc::Table<double,double> tab_spline(x, y);
+    tab_spline.setInterpolation(mc::TableInterpolation::CubicSpline);
+    tab.setData(x, y);
+
+    double val_min_spline = 0.0;
+    double val_prev = 0.0;
+    for (double key = 0.0; key <= 4.0; key += 0.01)
+    {
+        double val = tab.getValue(key);
+        EXPECT_GE(val, val_prev) << "x= " << key;
+        EXPECT_LE(val, 1.0) << "x= " << key;
+        val_prev = val;
+
+        val_min_spline = std::min(val_min_spline, tab_spline.getValue(key));
+    }
+    EXPECT_LT(val_min_spline, 0.0);
+}
+
+TEST_F(TestTable, CanGetValuesWithAnyInterpolation)
+{
+    std::vector<double> key_values { -2.0, -1.5, -1.0,  0.0,  0.5,  1.0,  2.0,  3.0 };
+    std::vector<double> table_data {  3.0,  1.25, 0.0, -1.0, -0.75, 0.0,  3.0,  8.0 };
+
+    std::vector<double> keys;
+    for (double x = -3.0; x <= 4.0; x += 0.05)
+    {
+        keys.push_back(x);
+    }
+    std::vector<double> values(keys.size());
+
+    for (mc::TableInterpolation interpolation : { mc::TableInterpolation::Linear,
+                                                  mc::TableInterpolation::CubicSpline,
+                                                  mc::TableInterpolation::Pchip })
+    {
+        mc::Table<double,double> tab(key_values, table_data);
+        tab.setInterpolation(interpolation);
+
+        // copy keeps interpolation method
+        mc::Table<double,double> tab2(tab);
+        EXPECT_EQ(tab2.getInterpolation(), interpolation);
+
+        tab2.getValues(keys, values);
+
+        for (unsigned int i = 0; i < keys.size(); ++i)
+        {
+            EXPECT_NEAR(values[i], tab.getValue(keys[i]), 1.0e-12) << "x= " << keys[i];
+        }
+
+        for (unsigned int i = 0; i < key_values.size(); ++i)
+        {
+            EXPECT_NEAR(tab.getValue(key_values[i]), table_data[i], 1.0e-12);
+        }
+    }
+}
+
 TEST_F(TestTable, CanGetValueByIndex)
 {
     mc::Table<double,double> tab0;
@@ -442,6 +729,35 @@ TEST_F(TestTable, CanSetFromString)
     EXPECT_FALSE(tab2.isValid());
 }
 
+TEST_F(TestTable, CanReportSetFromStringErrors)
+{
+    mc::Table<double,double> tab;
+
+    mc::str::ParseResult result = tab.setFromString("0.0 1.0\n1.0 2.0\n");
+    EXPECT_TRUE(result.valid);
+    EXPECT_EQ(tab.size(), 2);
+    EXPECT_DOUBLE_EQ(tab.getValue(0.5), 1.5);
+
+    // invalid value
+    result = tab.setFromString("0.0 1.0\n1.0 2,0\n");
+    EXPECT_FALSE(result.valid);
+    EXPECT_EQ(result.line, 2);
+    EXPECT_EQ(result.column, 5);
+    EXPECT_FALSE(tab.isValid());
+    EXPECT_EQ(tab.size(), 1);
+
+    // missing value
+    result = tab.setFromString("0.0 1.0\n1.0\n");
+    EXPECT_FALSE(result.valid);
+    EXPECT_EQ(result.offset, 12);
+    EXPECT_FALSE(tab.isValid());
+
+    // empty string
+    result = tab.setFromString("   ");
+    EXPECT_FALSE(result.valid);
+    EXPECT_FALSE(tab.isValid());
+}
+
 TEST_F(TestTable, CanAdd)
 {
     mc::Table<double,double> tab;
@@ -462,6 +778,35 @@ TEST_F(TestTable, CanAdd)
     }
 }
 
+TEST_F(TestTable, CanKeepInterpolationWhenAddingAndMultiplying)
+{
+    std::vector<double> k0 { -2.0, -1.0,  0.0,  1.0,  2.0,  3.0 };
+    std::vector<double> t1 {  1.0,  0.0, -1.0,  0.0,  3.0,  8.0 };
+    std::vector<double> t2 { -2.0, -1.0,  0.0,  1.0,  2.0,  3.0 };
+    std::vector<double> ts {  2.0,  0.0, -2.0,  0.0,  6.0, 16.0 };
+
+    mc::Table<double,double> tab1(k0, t1);
+    mc::Table<double,double> tab2(k0, t2);
+    tab1.setInterpolation(mc::TableInterpolation::Pchip);
+
+    mc::Table<double,double> tab_sum = tab1 + tab2;
+    EXPECT_EQ(tab_sum.getInterpolation(), mc::TableInterpolation::Pchip);
+
+    mc::Table<double,double> tab_scaled_1 = tab1 * 2.0;
+    mc::Table<double,double> tab_scaled_2 = 2.0 * tab1;
+    EXPECT_EQ(tab_scaled_1.getInterpolation(), mc::TableInterpolation::Pchip);
+    EXPECT_EQ(tab_scaled_2.getInterpolation(), mc::TableInterpolation::Pchip);
+
+    mc::Table<double,double> tab_scaled_ref(k0, ts);
+    tab_scaled_ref.setInterpolation(mc::TableInterpolation::Pchip);
+
+    for ( double key = -2.0; key <= 3.0; key += 0.25 )
+    {
+        EXPECT_DOUBLE_EQ(tab_scaled_1.getValue(key), tab_scaled_ref.getValue(key));
+        EXPECT_DOUBLE_EQ(tab_scaled_2.getValue(key), tab_scaled_ref.getValue(key));
+    }
+}
+
 TEST_F(TestTable, CanAssign)
 {
     // y = x^2 - 1
@@ -492,4 +837,37 @@ TEST_F(TestTable, CanAssignAndMove)
     {
         EXPECT_DOUBLE_EQ(tab.getValue(key_values[i]), table_data[i]);
     }
-}
\ No newline at end of file
+}
+
+TEST_F(TestTable, CanUseCustomAllocator)
+{
+    using PmrTable = mc::Table<double,double,std::pmr::polymorphic_allocator<std::byte>>;
+
+    std::vector<double> x { 0.0, 1.0, 2.0, 3.0 };
+    std::vector<double> y { 0.0, 2.0, 4.0, 6.0 };
+
+    CountingResource res1;
+    CountingResource res2;
+
+    {
+        PmrTable tab(x, y, &res1);
+        EXPECT_EQ(res1.allocations, 1);
+        EXPECT_DOUBLE_EQ(tab.getValue(1.5), 3.0);
+
+        // moving between different resources copies data
+        PmrTable tab2(0.0, 0.0, &res2);
+        tab2 = std::move(tab);
+        EXPECT_EQ(res2.allocations, 2);
+        EXPECT_DOUBLE_EQ(tab2.getValue(2.5), 5.0);
+        EXPECT_DOUBLE_EQ(tab.getValue(2.5), 5.0);
+
+        // moving within the same resource takes over memory
+        PmrTable tab3(0.0, 0.0, &res1);
+        tab3 = std::move(tab);
+        EXPECT_EQ(res1.allocations, 2);
+        EXPECT_DOUBLE_EQ(tab3.getValue(0.5), 1.0);
+    }
+
+    EXPECT_EQ(res1.allocations, res1.deallocations);
+    EXPECT_EQ(res2.allocations, res2.deallocations);
+}
@@ -1,9 +1,12 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <memory_resource>
 
 #include <mcutils/math/Table2.h>
 
+#include <CountingResource.h>
+
 class TestTable2 : public ::testing::Test
 {
 protected:
@@ -276,6 +279,112 @@ TEST_F(TestTable2, CanGetValueOutOfRange)
     EXPECT_DOUBLE_EQ(tab.getValue(  0.0, -1.0 ), -1.0);
 }
 
+TEST_F(TestTable2, CanGetValueWithCursor)
+{
+    // z = x^2 + y - 1
+    std::vector<double> r { -1.0,  0.0,  1.0,  2.0 };
+    std::vector<double> c {  0.0,  1.0,  2.0 };
+    std::vector<double> v {  0.0,  1.0,  2.0,
+                            -1.0,  0.0,  1.0,
+                             0.0,  1.0,  2.0,
+                             3.0,  4.0,  5.0 };
+
+    const mc::Table2<double,double,double> tab(r, c, v);
+
+    mc::Table2Cursor cursor;
+
+    for (double x = -1.5; x <= 2.5; x += 0.1)
+    {
+        for (double y = -0.5; y <= 2.5; y += 0.3)
+        {
+            EXPECT_DOUBLE_EQ(tab.getValue(x, y, cursor), tab.getValue(x, y)) << "x= " << x << " y= " << y;
+        }
+    }
+
+    // cursor used with a larger table
+    cursor.row.index = 10;
+    cursor.col.index = 10;
+    EXPECT_DOUBLE_EQ(tab.getValue(0.5, 0.5, cursor), tab.getValue(0.5, 0.5));
+}
+
+TEST_F(TestTable2, CanGetValues)
+{
+    // z = x^2 + y - 1
+    std::vector<double> r { -1.0,  0.0,  1.0,  2.0 };
+    std::vector<double> c {  0.0,  1.0,  2.0 };
+    std::vector<double> v {  0.0,  1.0,  2.0,
+                            -1.0,  0.0,  1.0,
+                             0.0,  1.0,  2.0,
+                             3.0,  4.0,  5.0 };
+
+    mc::Table2<double,double,double> tab(r, c, v);
+
+    std::vector<double> rows;
+    std::vector<double> cols;
+
+    for (double x = -1.5; x <= 2.5; x += 0.1)
+    {
+        for (double y = -0.5; y <= 2.5; y += 0.3)
+        {
+            rows.push_back(x);
+            cols.push_back(y);
+        }
+    }
+
+    std::vector<double> values(rows.size());
+    tab.getValues(rows, cols, values);
+
+    for (unsigned int i = 0; i < values.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(values[i], tab.getValue(rows[i], cols[i])) << "x= " << rows[i] << " y= " << cols[i];
+    }
+
+    mc::Table2<double,double,double> tab1(1.1, 2.2, 3.3);
+    tab1.getValues(rows, cols, values);
+    for (double value : values)
+    {
+        EXPECT_DOUBLE_EQ(value, 1.1);
+    }
+}
+
+TEST_F(TestTable2, CanGetValueFromLargeTable)
+{
+    // z = x*y + x + y is reproduced exactly by the bilinear interpolation
+    auto fun = [](double x, double y){ return x*y + x + y; };
+
+    std::vector<double> r;
+    std::vector<double> c;
+    std::vector<double> v;
+
+    for (int i = 0; i < 50; ++i) r.push_back(0.1 * i * i);
+    for (int i = 0; i < 40; ++i) c.push_back(0.5 * i + 0.01 * i * i);
+
+    for (double x : r)
+    {
+        for (double y : c)
+        {
+            v.push_back(fun(x, y));
+        }
+    }
+
+    mc::Table2<double,double,double> tab(r, c, v);
+    mc::Table2Cursor cursor;
+
+    for (double x = 0.0; x <= r.back(); x += 3.3)
+    {
+        for (double y = 0.0; y <= c.back(); y += 0.7)
+        {
+            EXPECT_NEAR(tab.getValue(x, y), fun(x, y), 1.0e-9) << "x= " << x << " y= " << y;
+            EXPECT_NEAR(tab.getValue(x, y, cursor), fun(x, y), 1.0e-9) << "x= " << x << " y= " << y;
+        }
+    }
+
+    EXPECT_DOUBLE_EQ(tab.getValue(-1.0, -1.0), fun(r.front(), c.front()));
+    EXPECT_DOUBLE_EQ(tab.getValue(-1.0, 1.0e3), fun(r.front(), c.back()));
+    EXPECT_DOUBLE_EQ(tab.getValue(1.0e3, -1.0), fun(r.back(), c.front()));
+    EXPECT_DOUBLE_EQ(tab.getValue(1.0e3, 1.0e3), fun(r.back(), c.back()));
+}
+
 TEST_F(TestTable2, CanGetValueByIndex)
 {
     mc::Table2<double,double,double> tab0;
@@ -482,6 +591,34 @@ TEST_F(TestTable2, CanSetDataFromString)
     EXPECT_FALSE(tab2.isValid());
 }
 
+TEST_F(TestTable2, CanReportSetFromStringErrors)
+{
+    mc::Table2<double,double,double> tab;
+
+    mc::str::ParseResult result = tab.setFromString("\n  1.0 2.0\n1.0 2.0 3.0\n2.0 3.0 4.0\n");
+    EXPECT_TRUE(result.valid);
+    EXPECT_EQ(tab.rows(), 2);
+    EXPECT_EQ(tab.cols(), 2);
+    EXPECT_DOUBLE_EQ(tab.getValue(1.5, 1.5), 3.0);
+
+    // invalid value
+    result = tab.setFromString("1.0 2.0\n1.0 2.0 3.0\n2.0 3.0 x\n");
+    EXPECT_FALSE(result.valid);
+    EXPECT_EQ(result.line, 3);
+    EXPECT_EQ(result.column, 9);
+    EXPECT_STREQ(result.error, "invalid number");
+    EXPECT_FALSE(tab.isValid());
+    EXPECT_EQ(tab.rows(), 1);
+    EXPECT_EQ(tab.cols(), 1);
+
+    // incomplete row
+    result = tab.setFromString("1.0 2.0\n1.0 2.0 3.0\n2.0 3.0\n");
+    EXPECT_FALSE(result.valid);
+    EXPECT_EQ(result.line, 4);
+    EXPECT_STREQ(result.error, "unexpected end of data");
+    EXPECT_FALSE(tab.isValid());
+}
+
 TEST_F(TestTable2, CanConvertToString)
 {
     // z = x^2 + y - 1
@@ -552,3 +689,41 @@ TEST_F(TestTable2, CanAssignAndMove)
     EXPECT_EQ(tab.rows(), 4);
     EXPECT_EQ(tab.cols(), 2);
 }
+
+TEST_F(TestTable2, CanUseCustomAllocator)
+{
+    using PmrTable2 = mc::Table2<double,double,double,std::pmr::polymorphic_allocator<std::byte>>;
+
+    // z = x^2 + y - 1
+    std::vector<double> r { -1.0,  0.0,  1.0,  2.0 };
+    std::vector<double> c {  0.0,  1.0 };
+    std::vector<double> v {  0.0,  1.0,
+                            -1.0,  0.0,
+                             0.0,  1.0,
+                             3.0,  4.0 };
+
+    CountingResource res1;
+    CountingResource res2;
+
+    {
+        // rows keys, columns keys and table data share a single allocation
+        PmrTable2 tab(r, c, v, &res1);
+        EXPECT_EQ(res1.allocations, 1);
+        EXPECT_DOUBLE_EQ(tab.getValue(1.5, 0.5), 2.0);
+
+        PmrTable2 tab2(0.0, 0.0, 0.0, &res2);
+        tab2 = std::move(tab);
+        EXPECT_EQ(res2.allocations, 2);
+        EXPECT_DOUBLE_EQ(tab2.getValue(1.5, 0.5), 2.0);
+
+        PmrTable2 tab3(0.0, 0.0, 0.0, &res1);
+        tab3 = std::move(tab);
+        EXPECT_EQ(res1.allocations, 2);
+        EXPECT_EQ(tab3.rows(), 4);
+        EXPECT_EQ(tab3.cols(), 2);
+        EXPECT_DOUBLE_EQ(tab3.getValue(1.5, 0.5), 2.0);
+    }
+
+    EXPECT_EQ(res1.allocations, res1.deallocations);
+    EXPECT_EQ(res2.allocations, res2.deallocations);
+}
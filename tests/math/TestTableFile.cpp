@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include <mcutils/math/TableFile.h>
+
+#define TEMP_TABLE_FILE "temp.tab"
+
+class TestTableFile : public ::testing::Test
+{
+protected:
+    TestTableFile() {}
+    virtual ~TestTableFile() {}
+    void SetUp() override {}
+    void TearDown() override
+    {
+        // remove temporary file temp.tab
+        std::remove(TEMP_TABLE_FILE);
+    }
+};
+
+TEST_F(TestTableFile, CanWriteAndReadTables)
+{
+    // y = x^2 - 1
+    std::vector<double> key_values { -2.0, -1.5, -1.0,  0.0,  0.5,  1.0,  2.0,  3.0 };
+    std::vector<double> table_data {  3.0,  1.25, 0.0, -1.0, -0.75, 0.0,  3.0,  8.0 };
+
+    mc::Table<double,double> tab1(key_values, table_data);
+    mc::Table<double,double> tab1s(key_values, table_data);
+    tab1s.setInterpolation(mc::TableInterpolation::CubicSpline);
+
+    // z = x^2 + y - 1
+    std::vector<double> r { -1.0,  0.0,  1.0,  2.0 };
+    std::vector<double> c {  0.0,  1.0 };
+    std::vector<double> v {  0.0,  1.0,
+                            -1.0,  0.0,
+                             0.0,  1.0,
+                             3.0,  4.0 };
+
+    mc::Table2<double,double,double> tab2(r, c, v);
+
+    mc::TableFileWriter writer;
+    writer.addTable("linear", tab1);
+    writer.addTable("spline", tab1s);
+    writer.addTable("table2", tab2);
+    EXPECT_EQ(writer.writeFile(TEMP_TABLE_FILE), mc::Result::Success);
+
+    mc::TableFile file(TEMP_TABLE_FILE);
+    ASSERT_TRUE(file.isOpen());
+    EXPECT_EQ(file.count(), 3);
+
+    EXPECT_EQ(file.getName(0), "linear");
+    EXPECT_EQ(file.getName(2), "table2");
+    EXPECT_EQ(file.findTable("spline"), 1);
+    EXPECT_EQ(file.findTable("lorem"), -1);
+
+    EXPECT_EQ(file.getType(0), mc::TableFileType::Table);
+    EXPECT_EQ(file.getType(2), mc::TableFileType::Table2);
+
+    mc::Table<double,double> tab1_read = file.getTable<double,double>(0);
+    mc::Table<double,double> tab1s_read = file.getTable<double,double>(1);
+    mc::Table2<double,double,double> tab2_read = file.getTable2<double,double,double>(2);
+
+    EXPECT_EQ(tab1_read.size(), tab1.size());
+    EXPECT_EQ(tab1_read.getSearch(), tab1.getSearch());
+    EXPECT_EQ(tab1s_read.getInterpolation(), mc::TableInterpolation::CubicSpline);
+
+    for (double x = -3.0; x <= 4.0; x += 0.05)
+    {
+        EXPECT_DOUBLE_EQ(tab1_read.getValue(x), tab1.getValue(x)) << "x= " << x;
+        EXPECT_DOUBLE_EQ(tab1s_read.getValue(x), tab1s.getValue(x)) << "x= " << x;
+    }
+
+    EXPECT_EQ(tab2_read.rows(), 4);
+    EXPECT_EQ(tab2_read.cols(), 2);
+
+    for (double x = -2.0; x <= 3.0; x += 0.1)
+    {
+        for (double y = -1.0; y <= 2.0; y += 0.1)
+        {
+            EXPECT_DOUBLE_EQ(tab2_read.getValue(x, y), tab2.getValue(x, y)) << "x= " << x << " y= " << y;
+        }
+    }
+}
+
+TEST_F(TestTableFile, CanModifyTablesReadFromFile)
+{
+    std::vector<double> key_values { 0.0, 1.0, 2.0 };
+    std::vector<double> table_data { 0.0, 2.0, 4.0 };
+
+    std::vector<double> r { 0.0, 1.0 };
+    std::vector<double> c { 0.0, 1.0 };
+    std::vector<double> v { 0.0, 1.0,
+                            1.0, 2.0 };
+
+    mc::TableFileWriter writer;
+    writer.addTable("table", mc::Table<double,double>(key_values, table_data));
+    writer.addTable("table2", mc::Table2<double,double,double>(r, c, v));
+    EXPECT_EQ(writer.writeFile(TEMP_TABLE_FILE), mc::Result::Success);
+
+    mc::TableFile file(TEMP_TABLE_FILE);
+    ASSERT_TRUE(file.isOpen());
+
+    // modified tables copy file data, file remains unchanged
+    mc::Table<double,double> tab = file.getTable<double,double>(0);
+    tab.multiplyValues(2.0);
+    EXPECT_DOUBLE_EQ(tab.getValue(1.5), 6.0);
+    EXPECT_DOUBLE_EQ((file.getTable<double,double>(0).getValue(1.5)), 3.0);
+
+    mc::Table2<double,double,double> tab2 = file.getTable2<double,double,double>(1);
+    tab2.multiplyCols(2.0);
+    EXPECT_DOUBLE_EQ(tab2.getValue(1.0, 1.0), 1.5);
+    EXPECT_DOUBLE_EQ((file.getTable2<double,double,double>(1).getValue(1.0, 1.0)), 2.0);
+
+    // copies own their data
+    mc::Table<double,double> tab_copy = file.getTable<double,double>(0);
+    mc::Table<double,double> tab_copy2(tab_copy);
+    file.closeFile();
+    EXPECT_DOUBLE_EQ(tab_copy2.getValue(0.5), 1.0);
+    EXPECT_DOUBLE_EQ(tab.getValue(0.5), 2.0);
+}
+
+TEST_F(TestTableFile, CanHandleInvalidEntries)
+{
+    std::vector<double> key_values { 0.0, 1.0 };
+    std::vector<double> table_data { 0.0, 1.0 };
+
+    mc::TableFileWriter writer;
+    writer.addTable("table", mc::Table<double,double>(key_values, table_data));
+    EXPECT_EQ(writer.writeFile(TEMP_TABLE_FILE), mc::Result::Success);
+
+    mc::TableFile file(TEMP_TABLE_FILE);
+    ASSERT_TRUE(file.isOpen());
+
+    // wrong type
+    EXPECT_FALSE((file.getTable2<double,double,double>(0).isValid()));
+
+    // index out of range
+    EXPECT_FALSE((file.getTable<double,double>(1).isValid()));
+    EXPECT_EQ(file.getName(1), "");
+}
+
+TEST_F(TestTableFile, CanHandleOverflowingTable2Size)
+{
+    std::vector<double> r { 0.0, 1.0 };
+    std::vector<double> c { 0.0, 1.0 };
+    std::vector<double> v { 0.0, 1.0, 2.0, 3.0 };
+
+    mc::TableFileWriter writer;
+    writer.addTable("table2", mc::Table2<double,double,double>(r, c, v));
+    std::vector<std::byte> bytes = writer.toBytes();
+
+    // number of cells wraps around to the original one in 32 bits
+    mc::TableFileEntry entry;
+    std::memcpy(&entry, bytes.data() + sizeof(mc::TableFileHeader), sizeof(entry));
+    entry.rows = 2;
+    entry.cols = 0x80000002;
+    std::memcpy(bytes.data() + sizeof(mc::TableFileHeader), &entry, sizeof(entry));
+    {
+        std::ofstream ofs(TEMP_TABLE_FILE, std::ios::binary);
+        ofs.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    }
+
+    mc::TableFile file(TEMP_TABLE_FILE);
+    ASSERT_TRUE(file.isOpen());
+    EXPECT_FALSE((file.getTable2<double,double,double>(0).isValid()));
+}
+
+TEST_F(TestTableFile, CannotOpenInvalidFile)
+{
+    mc::TableFile file;
+    EXPECT_EQ(file.openFile("lorem_ipsum.tab"), mc::Result::Failure);
+    EXPECT_FALSE(file.isOpen());
+    EXPECT_EQ(file.count(), 0);
+
+    {
+        std::ofstream ofs(TEMP_TABLE_FILE);
+        ofs << "lorem ipsum dolor sit amet, consectetur adipiscing elit";
+    }
+    EXPECT_EQ(file.openFile(TEMP_TABLE_FILE), mc::Result::Failure);
+    EXPECT_FALSE(file.isOpen());
+
+    // truncated file
+    std::vector<double> key_values { 0.0, 1.0 };
+    std::vector<double> table_data { 0.0, 1.0 };
+
+    mc::TableFileWriter writer;
+    writer.addTable("table", mc::Table<double,double>(key_values, table_data));
+    std::vector<std::byte> bytes = writer.toBytes();
+    {
+        std::ofstream ofs(TEMP_TABLE_FILE, std::ios::binary);
+        ofs.write(reinterpret_cast<const char*>(bytes.data()), bytes.size() - 8);
+    }
+    EXPECT_EQ(file.openFile(TEMP_TABLE_FILE), mc::Result::Failure);
+    EXPECT_FALSE(file.isOpen());
+}
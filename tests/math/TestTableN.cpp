@@ -0,0 +1,227 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <units.h>
+
+#include <mcutils/math/Table2.h>
+#include <mcutils/math/TableN.h>
+
+using namespace units::literals;
+
+class TestTableN : public ::testing::Test
+{
+protected:
+    TestTableN() {}
+    virtual ~TestTableN() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestTableN, CanInstantiate)
+{
+    mc::Table3<double,double,double,double> tab;
+    EXPECT_EQ(tab.size(), 1);
+    EXPECT_EQ(tab.size(0), 1);
+    EXPECT_EQ(tab.size(1), 1);
+    EXPECT_EQ(tab.size(2), 1);
+    EXPECT_EQ(tab.size(3), 0);
+    EXPECT_DOUBLE_EQ(tab.getValue(0.0, 0.0, 0.0), 0.0);
+    EXPECT_DOUBLE_EQ(tab.getValue(1.0, 2.0, 3.0), 0.0);
+
+    mc::Table3<double,double,double,double> tab2(1.1);
+    EXPECT_DOUBLE_EQ(tab2.getValue(0.0, 0.0, 0.0), 1.1);
+    EXPECT_DOUBLE_EQ(tab2.getValue(1.0, 2.0, 3.0), 1.1);
+}
+
+TEST_F(TestTableN, CanGetValueFromEmptyTable)
+{
+    std::vector<double> k;
+    std::vector<double> v;
+    mc::TableN<double,double,double> tab(k, k, v);
+    EXPECT_EQ(tab.size(), 0);
+    EXPECT_TRUE(std::isnan(tab.getValue(0.0, 0.0)));
+    EXPECT_FALSE(tab.isValid());
+}
+
+TEST_F(TestTableN, CanGetValue1D)
+{
+    // y = x^2 - 1
+    std::vector<double> key_values { -2.0, -1.0,  0.0,  1.0,  2.0,  3.0 };
+    std::vector<double> table_data {  1.0,  0.0, -1.0,  0.0,  3.0,  8.0 };
+
+    mc::TableN<double,double> tab(key_values, table_data);
+    mc::Table<double,double> ref(key_values, table_data);
+
+    for (double x = -3.0; x <= 4.0; x += 0.1)
+    {
+        EXPECT_NEAR(tab.getValue(x), ref.getValue(x), 1.0e-12) << "x= " << x;
+    }
+}
+
+TEST_F(TestTableN, CanGetValue2D)
+{
+    // z = x^2 + y - 1
+    std::vector<double> r { -1.0,  0.0,  1.0,  2.0 };
+    std::vector<double> c {  0.0,  1.0,  2.0 };
+    std::vector<double> v {  0.0,  1.0,  2.0,
+                            -1.0,  0.0,  1.0,
+                             0.0,  1.0,  2.0,
+                             3.0,  4.0,  5.0 };
+
+    mc::TableN<double,double,double> tab(r, c, v);
+    mc::Table2<double,double,double> ref(r, c, v);
+
+    for (double x = -1.5; x <= 2.5; x += 0.1)
+    {
+        for (double y = -0.5; y <= 2.5; y += 0.3)
+        {
+            EXPECT_NEAR(tab.getValue(x, y), ref.getValue(x, y), 1.0e-12) << "x= " << x << " y= " << y;
+        }
+    }
+}
+
+TEST_F(TestTableN, CanGetValue3D)
+{
+    // w = x*y*z + x + 2*y + 3*z is reproduced exactly by the trilinear interpolation
+    auto fun = [](double x, double y, double z){ return x*y*z + x + 2.0*y + 3.0*z; };
+
+    std::vector<double> k0 { -1.0,  0.0,  0.5,  2.0 };
+    std::vector<double> k1 {  0.0,  1.0,  3.0 };
+    std::vector<double> k2 { -2.0, -1.0,  0.0,  1.0,  4.0 };
+    std::vector<double> v;
+
+    for (double x : k0)
+        for (double y : k1)
+            for (double z : k2)
+                v.push_back(fun(x, y, z));
+
+    mc::Table3<double,double,double,double> tab(k0, k1, k2, v);
+    EXPECT_TRUE(tab.isValid());
+    EXPECT_EQ(tab.size(), 60);
+
+    mc::Table3<double,double,double,double>::Cursor cursor;
+
+    for (double x = -1.0; x <= 2.0; x += 0.25)
+    {
+        for (double y = 0.0; y <= 3.0; y += 0.4)
+        {
+            for (double z = -2.0; z <= 4.0; z += 0.7)
+            {
+                EXPECT_NEAR(tab.getValue(x, y, z), fun(x, y, z), 1.0e-12);
+                EXPECT_NEAR(tab.getValue(x, y, z, cursor), fun(x, y, z), 1.0e-12);
+            }
+        }
+    }
+
+    EXPECT_DOUBLE_EQ(tab.getValue(-9.0, -9.0, -9.0), fun(-1.0, 0.0, -2.0));
+    EXPECT_DOUBLE_EQ(tab.getValue( 9.0,  9.0,  9.0), fun( 2.0, 3.0,  4.0));
+}
+
+TEST_F(TestTableN, CanGetValue4D)
+{
+    auto fun = [](double a, double b, double c, double d){ return a*b + c*d + a*d - 2.0*b; };
+
+    std::vector<double> k0 { 0.0, 1.0, 2.0 };
+    std::vector<double> k1 { 0.0, 0.5 };
+    std::vector<double> k2 { 0.0, 1.0, 3.0 };
+    std::vector<double> k3 { 1.0, 2.0, 4.0, 8.0 };
+    std::vector<double> v;
+
+    for (double a : k0)
+        for (double b : k1)
+            for (double c : k2)
+                for (double d : k3)
+                    v.push_back(fun(a, b, c, d));
+
+    mc::TableN<double,double,double,double,double> tab(k0, k1, k2, k3, v);
+
+    EXPECT_NEAR(tab.getValue(0.3, 0.2, 2.5, 5.0), fun(0.3, 0.2, 2.5, 5.0), 1.0e-12);
+    EXPECT_NEAR(tab.getValue(1.7, 0.4, 0.1, 1.5), fun(1.7, 0.4, 0.1, 1.5), 1.0e-12);
+}
+
+TEST_F(TestTableN, CanGetValueWithUnits)
+{
+    std::vector<units::angle::radian_t> k0 { 0_rad, 1_rad };
+    std::vector<units::length::meter_t> k1 { 0_m, 2_m };
+    std::vector<units::force::newton_t> v { 0_N, 2_N,
+                                            1_N, 3_N };
+
+    mc::TableN<units::force::newton_t, units::angle::radian_t, units::length::meter_t> tab(k0, k1, v);
+
+    EXPECT_DOUBLE_EQ(tab.getValue(0.5_rad, 1_m)(), 1.5);
+    EXPECT_DOUBLE_EQ(tab.getValue(2_rad, 1_m)(), 2.0);
+}
+
+TEST_F(TestTableN, CanGetValueWithSingleKeyAxis)
+{
+    std::vector<double> k0 { 0.0, 1.0 };
+    std::vector<double> k1 { 5.0 };
+    std::vector<double> k2 { 0.0, 2.0 };
+    std::vector<double> v { 0.0, 2.0,
+                            1.0, 3.0 };
+
+    mc::Table3<double,double,double,double> tab(k0, k1, k2, v);
+
+    EXPECT_DOUBLE_EQ(tab.getValue(0.5, 0.0, 1.0), 1.5);
+    EXPECT_DOUBLE_EQ(tab.getValue(0.5, 9.0, 1.0), 1.5);
+}
+
+TEST_F(TestTableN, CanGetKeyAndValueByIndex)
+{
+    std::vector<double> k0 { 0.0, 1.0 };
+    std::vector<double> k1 { 0.0, 1.0, 2.0 };
+    std::vector<double> v { 0.0, 1.0, 2.0,
+                            3.0, 4.0, 5.0 };
+
+    mc::TableN<double,double,double> tab(k0, k1, v);
+
+    EXPECT_DOUBLE_EQ(tab.getKeyByIndex<0>(1), 1.0);
+    EXPECT_DOUBLE_EQ(tab.getKeyByIndex<1>(2), 2.0);
+    EXPECT_TRUE(std::isnan(tab.getKeyByIndex<1>(3)));
+
+    EXPECT_DOUBLE_EQ(tab.getValueByIndex({ 1, 2 }), 5.0);
+    EXPECT_DOUBLE_EQ(tab.getValueByIndex({ 0, 1 }), 1.0);
+    EXPECT_TRUE(std::isnan(tab.getValueByIndex({ 2, 0 })));
+}
+
+TEST_F(TestTableN, CanValidate)
+{
+    std::vector<double> k0 { 0.0, 1.0 };
+    std::vector<double> k1 { 0.0, 1.0 };
+    std::vector<double> k2 { 1.0, 0.0 };
+    std::vector<double> v1 { 0.0, 1.0, 2.0, 3.0 };
+    std::vector<double> v2 { 0.0, 1.0, 2.0, std::numeric_limits<double>::quiet_NaN() };
+
+    EXPECT_TRUE ((mc::TableN<double,double,double>(k0, k1, v1).isValid()));
+    EXPECT_FALSE((mc::TableN<double,double,double>(k0, k2, v1).isValid()));
+    EXPECT_FALSE((mc::TableN<double,double,double>(k0, k1, v2).isValid()));
+}
+
+TEST_F(TestTableN, CanMultiplyKeysAndValues)
+{
+    std::vector<double> k0 { 0.0, 1.0 };
+    std::vector<double> k1 { 0.0, 1.0 };
+    std::vector<double> v { 0.0, 1.0, 2.0, 3.0 };
+
+    mc::TableN<double,double,double> tab(k0, k1, v);
+
+    tab.multiplyKeys<0>(2.0);
+    tab.multiplyValues(3.0);
+
+    EXPECT_DOUBLE_EQ(tab.getValue(1.0, 0.5), 4.5);
+    EXPECT_DOUBLE_EQ(tab.getKeyByIndex<0>(1), 2.0);
+}
+
+TEST_F(TestTableN, CanSetDataWithWrongSize)
+{
+    std::vector<double> k0 { 0.0, 1.0 };
+    std::vector<double> k1 { 0.0, 1.0 };
+    std::vector<double> v { 0.0, 1.0, 2.0 };
+
+    mc::TableN<double,double,double> tab;
+    tab.setData(k0, k1, v);
+
+    EXPECT_EQ(tab.size(), 0);
+    EXPECT_TRUE(std::isnan(tab.getValue(0.5, 0.5)));
+}
@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <mcutils/math/TrigKernels.h>
+
+class TestTrigKernels : public ::testing::Test
+{
+protected:
+    TestTrigKernels() {}
+    virtual ~TestTrigKernels() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    // error in units in the last place of the reference value
+    static double getUlpError(double value, double ref)
+    {
+        if ( value == ref ) return 0.0;
+        const double ulp = std::nextafter(std::fabs(ref), std::numeric_limits<double>::infinity()) - std::fabs(ref);
+        return std::fabs(value - ref) / ulp;
+    }
+
+    static std::vector<double> getArgs(double max, size_t count)
+    {
+        std::vector<double> x(count);
+        for ( size_t i = 0; i < count; ++i )
+        {
+            x[i] = -max + 2.0 * max * static_cast<double>(i) / static_cast<double>(count - 1) + 1.0e-3;
+        }
+        return x;
+    }
+};
+
+TEST_F(TestTrigKernels, CanComputeSinCos)
+{
+    for ( double max : { 1.0, 10.0, 1.0e3, 1.0e6 } )
+    {
+        for ( double x : getArgs(max, 10001) )
+        {
+            double s = 0.0;
+            double c = 0.0;
+            mc::math::sincos(x, &s, &c);
+
+            // standard library functions are accurate within 1 ULP
+            EXPECT_LE(getUlpError(s, std::sin(x)), 3.0) << "x= " << x;
+            EXPECT_LE(getUlpError(c, std::cos(x)), 3.0) << "x= " << x;
+        }
+    }
+}
+
+TEST_F(TestTrigKernels, CanComputeSinCosSpecialValues)
+{
+    double s = 1.0;
+    double c = 0.0;
+
+    mc::math::sincos(0.0, &s, &c);
+    EXPECT_EQ(s, 0.0);
+    EXPECT_EQ(c, 1.0);
+
+    mc::math::sincos(-0.0, &s, &c);
+    EXPECT_TRUE(std::signbit(s));
+
+    mc::math::sincos(M_PI_2, &s, &c);
+    EXPECT_DOUBLE_EQ(s, 1.0);
+    EXPECT_NEAR(c, 0.0, 1.0e-15);
+
+    mc::math::sincos(-M_PI, &s, &c);
+    EXPECT_NEAR(s, 0.0, 1.0e-15);
+    EXPECT_DOUBLE_EQ(c, -1.0);
+
+    // beyond the kernel range
+    mc::math::sincos(1.0e9, &s, &c);
+    EXPECT_DOUBLE_EQ(s, std::sin(1.0e9));
+    EXPECT_DOUBLE_EQ(c, std::cos(1.0e9));
+
+    mc::math::sincos(std::numeric_limits<double>::quiet_NaN(), &s, &c);
+    EXPECT_TRUE(std::isnan(s));
+    EXPECT_TRUE(std::isnan(c));
+
+    mc::math::sincos(std::numeric_limits<double>::infinity(), &s, &c);
+    EXPECT_TRUE(std::isnan(s));
+    EXPECT_TRUE(std::isnan(c));
+}
+
+TEST_F(TestTrigKernels, CanComputeSinCosBatch)
+{
+    // odd size and arguments beyond the kernel range
+    std::vector<double> x = getArgs(100.0, 1001);
+    x[10] = 1.0e9;
+    x[1000] = -2.0e7;
+
+    std::vector<double> s(x.size());
+    std::vector<double> c(x.size());
+    mc::math::sincos(x, s, c);
+
+    std::vector<double> s_only(x.size());
+    std::vector<double> c_only(x.size());
+    mc::math::sin(x, s_only);
+    mc::math::cos(x, c_only);
+
+    for ( size_t i = 0; i < x.size(); ++i )
+    {
+        double s_ref = 0.0;
+        double c_ref = 0.0;
+        mc::math::sincos(x[i], &s_ref, &c_ref);
+
+        EXPECT_DOUBLE_EQ(s[i], s_ref);
+        EXPECT_DOUBLE_EQ(c[i], c_ref);
+        EXPECT_DOUBLE_EQ(s_only[i], s_ref);
+        EXPECT_DOUBLE_EQ(c_only[i], c_ref);
+    }
+}
+
+TEST_F(TestTrigKernels, CanComputeAtan2)
+{
+    for ( double y : getArgs(10.0, 201) )
+    {
+        for ( double x : getArgs(10.0, 201) )
+        {
+            EXPECT_LE(getUlpError(mc::math::atan2(y, x), std::atan2(y, x)), 4.0)
+                    << "y= " << y << " x= " << x;
+        }
+    }
+
+    // very different magnitudes
+    EXPECT_LE(getUlpError(mc::math::atan2(1.0e-300, 1.0e300), std::atan2(1.0e-300, 1.0e300)), 4.0);
+    EXPECT_LE(getUlpError(mc::math::atan2(6.4e6, -1.0e-3), std::atan2(6.4e6, -1.0e-3)), 4.0);
+}
+
+TEST_F(TestTrigKernels, CanComputeAtan2SpecialValues)
+{
+    EXPECT_EQ(mc::math::atan2( 0.0,  0.0), std::atan2( 0.0,  0.0));
+    EXPECT_TRUE(std::signbit(mc::math::atan2(-0.0, 0.0)));
+    EXPECT_DOUBLE_EQ(mc::math::atan2( 0.0, -0.0),  M_PI);
+    EXPECT_DOUBLE_EQ(mc::math::atan2(-0.0, -0.0), -M_PI);
+    EXPECT_DOUBLE_EQ(mc::math::atan2( 0.0, -1.0),  M_PI);
+    EXPECT_DOUBLE_EQ(mc::math::atan2(-0.0, -1.0), -M_PI);
+    EXPECT_DOUBLE_EQ(mc::math::atan2( 1.0,  0.0),  M_PI_2);
+    EXPECT_DOUBLE_EQ(mc::math::atan2(-1.0,  0.0), -M_PI_2);
+    EXPECT_DOUBLE_EQ(mc::math::atan2( 1.0,  1.0),  M_PI_4);
+    EXPECT_DOUBLE_EQ(mc::math::atan2(-1.0, -1.0), -3.0 * M_PI_4);
+
+    const double inf = std::numeric_limits<double>::infinity();
+    EXPECT_EQ(mc::math::atan2(1.0, inf), 0.0);
+    EXPECT_TRUE(std::signbit(mc::math::atan2(-1.0, inf)));
+    EXPECT_DOUBLE_EQ(mc::math::atan2( 1.0, -inf),  M_PI);
+    EXPECT_DOUBLE_EQ(mc::math::atan2(-1.0, -inf), -M_PI);
+    EXPECT_DOUBLE_EQ(mc::math::atan2( inf,  1.0),  M_PI_2);
+    EXPECT_DOUBLE_EQ(mc::math::atan2(-inf,  1.0), -M_PI_2);
+    EXPECT_DOUBLE_EQ(mc::math::atan2( inf, -1.0),  M_PI_2);
+    EXPECT_DOUBLE_EQ(mc::math::atan2( inf,  0.0),  M_PI_2);
+    EXPECT_DOUBLE_EQ(mc::math::atan2(-inf, -0.0), -M_PI_2);
+    EXPECT_DOUBLE_EQ(mc::math::atan2( 0.0,  inf),  0.0);
+    EXPECT_DOUBLE_EQ(mc::math::atan2( 0.0, -inf),  M_PI);
+
+    // both arguments infinite
+    EXPECT_DOUBLE_EQ(mc::math::atan2( inf,  inf),  M_PI_4);
+    EXPECT_DOUBLE_EQ(mc::math::atan2(-inf,  inf), -M_PI_4);
+    EXPECT_DOUBLE_EQ(mc::math::atan2( inf, -inf),  3.0 * M_PI_4);
+    EXPECT_DOUBLE_EQ(mc::math::atan2(-inf, -inf), -3.0 * M_PI_4);
+
+    for ( double y : { inf, -inf, 1.0, -1.0, 0.0, -0.0 } )
+    {
+        for ( double x : { inf, -inf, 1.0, -1.0, 0.0, -0.0 } )
+        {
+            EXPECT_DOUBLE_EQ(mc::math::atan2(y, x), std::atan2(y, x)) << "y= " << y << " x= " << x;
+        }
+    }
+
+    EXPECT_TRUE(std::isnan(mc::math::atan2(std::numeric_limits<double>::quiet_NaN(), 1.0)));
+    EXPECT_TRUE(std::isnan(mc::math::atan2(1.0, std::numeric_limits<double>::quiet_NaN())));
+}
+
+TEST_F(TestTrigKernels, CanComputeAtan2Batch)
+{
+    std::vector<double> y = getArgs(5.0, 999);
+    std::vector<double> x = getArgs(3.0, 999);
+    std::reverse(x.begin(), x.end());
+
+    std::vector<double> result(y.size());
+    mc::math::atan2(y, x, result);
+
+    for ( size_t i = 0; i < y.size(); ++i )
+    {
+        EXPECT_DOUBLE_EQ(result[i], mc::math::atan2(y[i], x[i]));
+    }
+}
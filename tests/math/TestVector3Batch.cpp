@@ -0,0 +1,261 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <mcutils/math/Vector3Batch.h>
+
+using namespace units::literals;
+
+#define TOLERANCE 1.0e-12
+
+class TestVector3Batch : public ::testing::Test
+{
+protected:
+    TestVector3Batch() {}
+    virtual ~TestVector3Batch() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    std::vector<mc::Vector3d> _lhs
+    {
+        mc::Vector3d( 1.0,  2.0,  3.0),
+        mc::Vector3d(-4.0,  5.0, -6.0),
+        mc::Vector3d( 0.5, -1.5,  2.5),
+        mc::Vector3d( 0.0,  0.0,  0.0),
+        mc::Vector3d( 7.0,  8.0,  9.0)
+    };
+
+    std::vector<mc::Vector3d> _rhs
+    {
+        mc::Vector3d( 3.0, -2.0,  1.0),
+        mc::Vector3d( 1.0,  1.0,  1.0),
+        mc::Vector3d(-2.0,  4.0,  0.5),
+        mc::Vector3d( 1.0,  2.0,  3.0),
+        mc::Vector3d( 0.0, -1.0,  2.0)
+    };
+};
+
+TEST_F(TestVector3Batch, CanInstantiate)
+{
+    mc::Vector3Batch<double> b1;
+    EXPECT_EQ(b1.size(), 0);
+    EXPECT_TRUE(b1.empty());
+
+    mc::Vector3Batch<double> b2(4);
+    EXPECT_EQ(b2.size(), 4);
+    for (size_t i = 0; i < b2.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(b2.x()[i], 0.0);
+        EXPECT_DOUBLE_EQ(b2.y()[i], 0.0);
+        EXPECT_DOUBLE_EQ(b2.z()[i], 0.0);
+    }
+}
+
+TEST_F(TestVector3Batch, CanConvertToAndFromStdVector)
+{
+    mc::Vector3Batch<double> b(_lhs);
+    EXPECT_EQ(b.size(), _lhs.size());
+
+    for (size_t i = 0; i < _lhs.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(b.x()[i], _lhs[i].x());
+        EXPECT_DOUBLE_EQ(b.y()[i], _lhs[i].y());
+        EXPECT_DOUBLE_EQ(b.z()[i], _lhs[i].z());
+    }
+
+    std::vector<mc::Vector3d> v = b.getStdVector();
+    ASSERT_EQ(v.size(), _lhs.size());
+    for (size_t i = 0; i < _lhs.size(); ++i)
+    {
+        EXPECT_TRUE(v[i] == _lhs[i]) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestVector3Batch, CanGetAndSet)
+{
+    mc::Vector3Batch<double> b(2);
+    b.set(1, mc::Vector3d(1.0, 2.0, 3.0));
+    b.pushBack(mc::Vector3d(4.0, 5.0, 6.0));
+
+    EXPECT_EQ(b.size(), 3);
+    EXPECT_TRUE(b.get(0) == mc::Vector3d(0.0, 0.0, 0.0));
+    EXPECT_TRUE(b.get(1) == mc::Vector3d(1.0, 2.0, 3.0));
+    EXPECT_TRUE(b.get(2) == mc::Vector3d(4.0, 5.0, 6.0));
+
+    b.clear();
+    EXPECT_TRUE(b.empty());
+}
+
+TEST_F(TestVector3Batch, CanAdd)
+{
+    mc::Vector3Batch<double> b1(_lhs);
+    mc::Vector3Batch<double> b2(_rhs);
+
+    mc::Vector3Batch<double> br = b1 + b2;
+    b1 += b2;
+
+    for (size_t i = 0; i < _lhs.size(); ++i)
+    {
+        mc::Vector3d ref = _lhs[i] + _rhs[i];
+        EXPECT_DOUBLE_EQ(br.x()[i], ref.x());
+        EXPECT_DOUBLE_EQ(br.y()[i], ref.y());
+        EXPECT_DOUBLE_EQ(br.z()[i], ref.z());
+        EXPECT_TRUE(b1.get(i) == ref) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestVector3Batch, CanNegate)
+{
+    mc::Vector3Batch<double> b(_lhs);
+    mc::Vector3Batch<double> br = -b;
+
+    for (size_t i = 0; i < _lhs.size(); ++i)
+    {
+        EXPECT_TRUE(br.get(i) == -_lhs[i]) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestVector3Batch, CanSubtract)
+{
+    mc::Vector3Batch<double> b1(_lhs);
+    mc::Vector3Batch<double> b2(_rhs);
+
+    mc::Vector3Batch<double> br = b1 - b2;
+    b1 -= b2;
+
+    for (size_t i = 0; i < _lhs.size(); ++i)
+    {
+        mc::Vector3d ref = _lhs[i] - _rhs[i];
+        EXPECT_TRUE(br.get(i) == ref) << "Error at index " << i;
+        EXPECT_TRUE(b1.get(i) == ref) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestVector3Batch, CanMultiplyAndDivideByScalar)
+{
+    mc::Vector3Batch<double> b(_lhs);
+
+    mc::Vector3Batch<double> br1 = b * 2.0;
+    mc::Vector3Batch<double> br2 = 2.0 * b;
+    mc::Vector3Batch<double> br3 = b / 2.0;
+
+    for (size_t i = 0; i < _lhs.size(); ++i)
+    {
+        EXPECT_TRUE(br1.get(i) == _lhs[i] * 2.0) << "Error at index " << i;
+        EXPECT_TRUE(br2.get(i) == _lhs[i] * 2.0) << "Error at index " << i;
+        EXPECT_TRUE(br3.get(i) == _lhs[i] / 2.0) << "Error at index " << i;
+    }
+
+    b *= 4.0;
+    b /= 2.0;
+    for (size_t i = 0; i < _lhs.size(); ++i)
+    {
+        EXPECT_TRUE(b.get(i) == _lhs[i] * 2.0) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestVector3Batch, CanCalculateDotProducts)
+{
+    mc::Vector3Batch<double> b1(_lhs);
+    mc::Vector3Batch<double> b2(_rhs);
+
+    std::vector<double> dot = b1 * b2;
+
+    ASSERT_EQ(dot.size(), _lhs.size());
+    for (size_t i = 0; i < _lhs.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(dot[i], _lhs[i] * _rhs[i]) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestVector3Batch, CanCalculateCrossProducts)
+{
+    mc::Vector3Batch<double> b1(_lhs);
+    mc::Vector3Batch<double> b2(_rhs);
+
+    mc::Vector3Batch<double> br = b1 % b2;
+
+    for (size_t i = 0; i < _lhs.size(); ++i)
+    {
+        mc::Vector3d ref = _lhs[i] % _rhs[i];
+        EXPECT_DOUBLE_EQ(br.x()[i], ref.x());
+        EXPECT_DOUBLE_EQ(br.y()[i], ref.y());
+        EXPECT_DOUBLE_EQ(br.z()[i], ref.z());
+    }
+}
+
+TEST_F(TestVector3Batch, CanGetNormalized)
+{
+    mc::Vector3Batch<double> b(_lhs);
+    mc::Vector3Batch<double> br = b.getNormalized();
+
+    for (size_t i = 0; i < _lhs.size(); ++i)
+    {
+        mc::Vector3d ref = _lhs[i].getNormalized();
+        EXPECT_NEAR(br.x()[i], ref.x(), TOLERANCE);
+        EXPECT_NEAR(br.y()[i], ref.y(), TOLERANCE);
+        EXPECT_NEAR(br.z()[i], ref.z(), TOLERANCE);
+    }
+}
+
+TEST_F(TestVector3Batch, CanMultiplyByMatrix)
+{
+    mc::Matrix3x3d m(
+        1.0, 2.0, 3.0,
+        4.0, 5.0, 6.0,
+        7.0, 8.0, 9.0
+    );
+
+    mc::Vector3Batch<double> b(_lhs);
+    mc::Vector3Batch<double> br = m * b;
+
+    mc::RotMatrix rm(mc::Angles(0.1_rad, 0.2_rad, 0.3_rad));
+    mc::Vector3Batch<double> brm = rm * b;
+
+    for (size_t i = 0; i < _lhs.size(); ++i)
+    {
+        mc::Vector3d ref = m * _lhs[i];
+        EXPECT_DOUBLE_EQ(br.x()[i], ref.x());
+        EXPECT_DOUBLE_EQ(br.y()[i], ref.y());
+        EXPECT_DOUBLE_EQ(br.z()[i], ref.z());
+
+        mc::Vector3d ref_rm = rm * _lhs[i];
+        EXPECT_NEAR(brm.x()[i], ref_rm.x(), TOLERANCE);
+        EXPECT_NEAR(brm.y()[i], ref_rm.y(), TOLERANCE);
+        EXPECT_NEAR(brm.z()[i], ref_rm.z(), TOLERANCE);
+    }
+}
+
+TEST_F(TestVector3Batch, CanOperateWithUnits)
+{
+    mc::Vector3Batch<units::length::meter_t> r(2);
+    r.set(0, mc::Vector3_m(1.0_m, 2.0_m, 3.0_m));
+    r.set(1, mc::Vector3_m(-1.0_m, 0.5_m, 2.0_m));
+
+    mc::Vector3Batch<units::force::newton_t> f(2);
+    f.set(0, mc::Vector3_N(0.0_N, 1.0_N, 0.0_N));
+    f.set(1, mc::Vector3_N(2.0_N, 0.0_N, 1.0_N));
+
+    mc::Vector3Batch<units::torque::newton_meter_t> m = r % f;
+    auto w = r * f;
+    mc::Vector3Batch<units::velocity::meters_per_second_t> v = r / 2.0_s;
+    mc::Vector3Batch<units::length::meter_t> r2 = r + r * 2.0;
+
+    for (size_t i = 0; i < r.size(); ++i)
+    {
+        mc::Vector3_Nm m_ref = r.get(i) % f.get(i);
+        EXPECT_NEAR(m.x()[i](), m_ref.x()(), TOLERANCE);
+        EXPECT_NEAR(m.y()[i](), m_ref.y()(), TOLERANCE);
+        EXPECT_NEAR(m.z()[i](), m_ref.z()(), TOLERANCE);
+
+        EXPECT_NEAR(w[i](), (r.get(i) * f.get(i))(), TOLERANCE);
+
+        EXPECT_NEAR(v.x()[i](), r.x()[i]() / 2.0, TOLERANCE);
+        EXPECT_NEAR(v.y()[i](), r.y()[i]() / 2.0, TOLERANCE);
+        EXPECT_NEAR(v.z()[i](), r.z()[i]() / 2.0, TOLERANCE);
+
+        EXPECT_NEAR(r2.x()[i](), 3.0 * r.x()[i](), TOLERANCE);
+        EXPECT_NEAR(r2.y()[i](), 3.0 * r.y()[i](), TOLERANCE);
+        EXPECT_NEAR(r2.z()[i](), 3.0 * r.z()[i](), TOLERANCE);
+    }
+}
@@ -541,4 +541,31 @@ TEST_F(TestVectorN, CanMultiplyScalarByVector)
     {
         EXPECT_DOUBLE_EQ(vr(i), x[i] * val) << "Error at index " << i;
     }
-}
\ No newline at end of file
+}
+
+TEST_F(TestVectorN, CanEvaluateLazyExpression)
+{
+    mc::VectorN<double,SIZE> v1;
+    v1(0) = 1.0;
+    v1(1) = 2.0;
+    v1(2) = 3.0;
+
+    mc::VectorN<double,SIZE> v2;
+    v2(0) = 4.0;
+    v2(1) = 5.0;
+    v2(2) = 6.0;
+
+    mc::VectorN<double,SIZE> vr = mc::lazy(v1) + (mc::lazy(v2) - v1) * 2.0 + 3.0 * -mc::lazy(v2) / 2.0;
+    mc::VectorN<double,SIZE> vr_ref = v1 + (v2 - v1) * 2.0 - v2 * 1.5;
+
+    for ( int i = 0; i < SIZE; ++i )
+    {
+        EXPECT_DOUBLE_EQ(vr(i), vr_ref(i)) << "Error at index " << i;
+    }
+
+    // in-place update
+    v1 = mc::lazy(v1) + mc::lazy(v2) * 0.5;
+    EXPECT_DOUBLE_EQ(v1(0), 3.0);
+    EXPECT_DOUBLE_EQ(v1(1), 4.5);
+    EXPECT_DOUBLE_EQ(v1(2), 6.0);
+}
@@ -1514,4 +1514,28 @@ TEST_F(TestVectorNWithUnits, CanMultiplyDimensionlessScalarByVector)
     test::VectorN::CanMultiplyDimensionlessScalarByVector<units::angular_acceleration::degrees_per_second_squared_t>();
     test::VectorN::CanMultiplyDimensionlessScalarByVector<units::force::newton_t>();
     test::VectorN::CanMultiplyDimensionlessScalarByVector<units::torque::newton_meter_t>();
-}
\ No newline at end of file
+}
+
+TEST_F(TestVectorNWithUnits, CanEvaluateLazyExpression)
+{
+    mc::VectorN<units::length::meter_t,SIZE> r;
+    r(0) = 1.0_m;
+    r(1) = 2.0_m;
+    r(2) = 3.0_m;
+
+    mc::VectorN<units::velocity::meters_per_second_t,SIZE> v;
+    v(0) = 4.0_mps;
+    v(1) = 5.0_mps;
+    v(2) = 6.0_mps;
+
+    mc::VectorN<units::length::meter_t,SIZE> rr = mc::lazy(r) + mc::lazy(v) * 2.0_s - mc::lazy(r) / 2.0;
+    mc::VectorN<units::velocity::meters_per_second_t,SIZE> vr = mc::lazy(r) / 2.0_s + v;
+
+    EXPECT_NEAR(rr(0)(),  8.5, TOLERANCE);
+    EXPECT_NEAR(rr(1)(), 11.0, TOLERANCE);
+    EXPECT_NEAR(rr(2)(), 13.5, TOLERANCE);
+
+    EXPECT_NEAR(vr(0)(), 4.5, TOLERANCE);
+    EXPECT_NEAR(vr(1)(), 6.0, TOLERANCE);
+    EXPECT_NEAR(vr(2)(), 7.5, TOLERANCE);
+}
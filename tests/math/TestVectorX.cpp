@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include <mcutils/math/VectorX.h>
+
+class TestVectorX : public ::testing::Test
+{
+protected:
+    TestVectorX() {}
+    virtual ~TestVectorX() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestVectorX, CanInstantiate)
+{
+    mc::VectorX<double> v1;
+    EXPECT_EQ(v1.size(), 0);
+
+    mc::VectorX<double> v2(5);
+    EXPECT_EQ(v2.size(), 5);
+    for (unsigned int i = 0; i < v2.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(v2(i), 0.0);
+    }
+
+    mc::VectorX<double> v3(std::vector<double>{ 1.0, 2.0, 3.0 });
+    EXPECT_EQ(v3.size(), 3);
+    EXPECT_DOUBLE_EQ(v3(0), 1.0);
+    EXPECT_DOUBLE_EQ(v3(1), 2.0);
+    EXPECT_DOUBLE_EQ(v3(2), 3.0);
+}
+
+TEST_F(TestVectorX, CanConvertToAndFromVectorN)
+{
+    mc::VectorN<double, 4> vn;
+    vn(0) = 1.0;
+    vn(1) = 2.0;
+    vn(2) = 3.0;
+    vn(3) = 4.0;
+
+    mc::VectorX<double> vx = vn;
+    EXPECT_EQ(vx.size(), 4);
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        EXPECT_DOUBLE_EQ(vx(i), vn(i));
+    }
+
+    mc::VectorN<double, 4> vn2 = vx.getVectorN<4>();
+    EXPECT_TRUE(vn2 == vn);
+}
+
+TEST_F(TestVectorX, CanCopyAndMoveLargeVector)
+{
+    // larger than inline buffer, so allocated on the heap
+    mc::VectorX<double> v1(100);
+    for (unsigned int i = 0; i < v1.size(); ++i)
+    {
+        v1(i) = static_cast<double>(i);
+    }
+
+    mc::VectorX<double> v2 = v1;
+    EXPECT_TRUE(v2 == v1);
+    EXPECT_NE(v2.data(), v1.data());
+
+    const double* data = v1.data();
+    mc::VectorX<double> v3 = std::move(v1);
+    EXPECT_EQ(v3.data(), data);
+    EXPECT_TRUE(v3 == v2);
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(v3.data()) % 64, 0);
+
+    v3.resize(3);
+    EXPECT_EQ(v3.size(), 3);
+    EXPECT_DOUBLE_EQ(v3(2), 0.0);
+}
+
+TEST_F(TestVectorX, CanGetLength)
+{
+    mc::VectorX<double> v(std::vector<double>{ 1.0, 2.0, 2.0, 4.0 });
+    EXPECT_DOUBLE_EQ(v.getLengthSquared(), 25.0);
+    EXPECT_DOUBLE_EQ(v.getLength(), 5.0);
+
+    mc::VectorX<double> vn = v.getNormalized();
+    EXPECT_DOUBLE_EQ(vn(0), 0.2);
+    EXPECT_DOUBLE_EQ(vn(1), 0.4);
+    EXPECT_DOUBLE_EQ(vn(2), 0.4);
+    EXPECT_DOUBLE_EQ(vn(3), 0.8);
+}
+
+TEST_F(TestVectorX, CanSwapRows)
+{
+    mc::VectorX<double> v(std::vector<double>{ 1.0, 2.0, 3.0 });
+    v.swapRows(0, 2);
+    EXPECT_DOUBLE_EQ(v(0), 3.0);
+    EXPECT_DOUBLE_EQ(v(1), 2.0);
+    EXPECT_DOUBLE_EQ(v(2), 1.0);
+}
+
+TEST_F(TestVectorX, CanConvertToString)
+{
+    mc::VectorX<double> v(std::vector<double>{ 1.0, 2.0, 3.0 });
+    EXPECT_STREQ(v.toString().c_str(), "1\t2\t3");
+}
+
+TEST_F(TestVectorX, CanAddAndSubtract)
+{
+    mc::VectorX<double> v1(std::vector<double>{ 1.0, 2.0, 3.0 });
+    mc::VectorX<double> v2(std::vector<double>{ 4.0, 5.0, 6.0 });
+
+    mc::VectorX<double> vs = v1 + v2;
+    mc::VectorX<double> vd = v2 - v1;
+    mc::VectorX<double> vn = -v1;
+
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        EXPECT_DOUBLE_EQ(vs(i), v1(i) + v2(i));
+        EXPECT_DOUBLE_EQ(vd(i), v2(i) - v1(i));
+        EXPECT_DOUBLE_EQ(vn(i), -v1(i));
+    }
+
+    v1 += v2;
+    EXPECT_TRUE(v1 == vs);
+    v1 -= v2;
+    v1 -= v2;
+    EXPECT_TRUE(v1 == -vd);
+}
+
+TEST_F(TestVectorX, CanMultiplyAndDivideByScalar)
+{
+    mc::VectorX<double> v(std::vector<double>{ 1.0, 2.0, 3.0 });
+
+    mc::VectorX<double> v1 = v * 2.0;
+    mc::VectorX<double> v2 = 2.0 * v;
+    mc::VectorX<double> v3 = v / 2.0;
+
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        EXPECT_DOUBLE_EQ(v1(i), v(i) * 2.0);
+        EXPECT_DOUBLE_EQ(v2(i), v(i) * 2.0);
+        EXPECT_DOUBLE_EQ(v3(i), v(i) / 2.0);
+    }
+
+    v *= 4.0;
+    v /= 2.0;
+    EXPECT_TRUE(v == v1);
+}
+
+TEST_F(TestVectorX, CanCalculateDotProduct)
+{
+    mc::VectorX<double> v1(std::vector<double>{ 1.0, 2.0, 3.0 });
+    mc::VectorX<double> v2(std::vector<double>{ 4.0, 5.0, 6.0 });
+    EXPECT_DOUBLE_EQ(v1 * v2, 32.0);
+}
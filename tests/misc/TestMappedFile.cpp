@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include <mcutils/misc/MappedFile.h>
+
+#define TEMP_FILE "temp.bin"
+
+class TestMappedFile : public ::testing::Test
+{
+protected:
+    TestMappedFile() {}
+    virtual ~TestMappedFile() {}
+    void SetUp() override {}
+    void TearDown() override
+    {
+        // remove temporary file temp.bin
+        std::remove(TEMP_FILE);
+    }
+};
+
+TEST_F(TestMappedFile, CanMapFile)
+{
+    const char content[] = "lorem ipsum dolor sit amet";
+    {
+        std::ofstream ofs(TEMP_FILE, std::ios::binary);
+        ofs.write(content, sizeof(content));
+    }
+
+    mc::MappedFile file(TEMP_FILE);
+    ASSERT_TRUE(file.isOpen());
+    EXPECT_EQ(file.size(), sizeof(content));
+    EXPECT_EQ(std::memcmp(file.data(), content, sizeof(content)), 0);
+
+    mc::MappedFile file2(std::move(file));
+    EXPECT_FALSE(file.isOpen());
+    EXPECT_TRUE(file2.isOpen());
+    EXPECT_EQ(std::memcmp(file2.data(), content, sizeof(content)), 0);
+
+    file2.closeFile();
+    EXPECT_FALSE(file2.isOpen());
+    EXPECT_EQ(file2.data(), nullptr);
+    EXPECT_EQ(file2.size(), 0);
+}
+
+TEST_F(TestMappedFile, CannotMapMissingOrEmptyFile)
+{
+    mc::MappedFile file;
+    EXPECT_EQ(file.openFile("lorem_ipsum.bin"), mc::Result::Failure);
+    EXPECT_FALSE(file.isOpen());
+
+    {
+        std::ofstream ofs(TEMP_FILE, std::ios::binary);
+    }
+    EXPECT_EQ(file.openFile(std::string(TEMP_FILE)), mc::Result::Failure);
+    EXPECT_FALSE(file.isOpen());
+}
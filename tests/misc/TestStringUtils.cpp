@@ -131,6 +131,66 @@ TEST_F(TestStringUtils, CanConvertToDouble)
     EXPECT_DOUBLE_EQ(-2.1  , mc::str::toDouble(s3));
 }
 
+TEST_F(TestStringUtils, CanReadNumbers)
+{
+    std::string str = "  1.0 -2.5\n+3e2\t 4  \n\n 5.25 ";
+
+    mc::str::NumberReader reader(str);
+    EXPECT_EQ(reader.countNumbers(), 5);
+    EXPECT_EQ(reader.countNumbersInLine(), 2);
+
+    double expected[] = { 1.0, -2.5, 300.0, 4.0, 5.25 };
+    for (double val : expected)
+    {
+        double x = 0.0;
+        EXPECT_TRUE(reader.read(&x));
+        EXPECT_DOUBLE_EQ(x, val);
+    }
+
+    EXPECT_EQ(reader.countNumbers(), 0);
+    EXPECT_TRUE(reader.getResult().valid);
+
+    double x = 1.0;
+    EXPECT_FALSE(reader.read(&x));
+    EXPECT_DOUBLE_EQ(x, 1.0);
+
+    mc::str::ParseResult result = reader.getResult();
+    EXPECT_FALSE(result.valid);
+    EXPECT_EQ(result.offset, str.size());
+    EXPECT_EQ(result.line, 4);
+    EXPECT_STREQ(result.error, "unexpected end of data");
+}
+
+TEST_F(TestStringUtils, CanReportInvalidNumberPosition)
+{
+    std::string str = "1.0 2.0\n3.0 4.0x 5.0";
+
+    mc::str::NumberReader reader(str);
+    EXPECT_EQ(reader.countNumbers(), 5);
+
+    double x = 0.0;
+    EXPECT_TRUE(reader.read(&x));
+    EXPECT_TRUE(reader.read(&x));
+    EXPECT_TRUE(reader.read(&x));
+    EXPECT_FALSE(reader.read(&x));
+    EXPECT_FALSE(reader.read(&x));
+    EXPECT_DOUBLE_EQ(x, 3.0);
+
+    mc::str::ParseResult result = reader.getResult();
+    EXPECT_FALSE(result.valid);
+    EXPECT_FALSE(static_cast<bool>(result));
+    EXPECT_EQ(result.offset, 12);
+    EXPECT_EQ(result.line, 2);
+    EXPECT_EQ(result.column, 5);
+    EXPECT_STREQ(result.error, "invalid number");
+
+    for (const char* s : { "nan", "inf", "1e999", "abc", "--1" })
+    {
+        mc::str::NumberReader r(s);
+        EXPECT_FALSE(r.read(&x)) << s;
+    }
+}
+
 TEST_F(TestStringUtils, CanConvertIntToString)
 {
     int v0 =  0;